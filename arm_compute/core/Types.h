@@ -1275,6 +1275,9 @@ public:
      * @param[in] d_segment     Sentence segmentation size
      * @param[in] d_position    Maximum sentence postion encoding length
      * @param[in] pretrained    If use pretained positional encoding
+     * @param[in] c_policy      Convert policy
+     * @param[in] data_type     Data type of the embedding tables and of the output,
+     *                          DataType::UNKNOWN to use the data type of the input descriptor
      * 
      */
     EmbeddingLayerInfo(unsigned int d_model = 512U,
@@ -1282,13 +1285,15 @@ public:
                        unsigned int d_segment = 2U,
                        unsigned int d_position = 512U,
                        bool pretrained = false,
-                       ConvertPolicy c_policy = ConvertPolicy::SATURATE)
+                       ConvertPolicy c_policy = ConvertPolicy::SATURATE,
+                       DataType data_type = DataType::UNKNOWN)
         : _d_model(d_model),
           _d_vocab(d_vocab), 
           _d_segment(d_segment), 
           _d_position(d_position), 
           _pretrained(pretrained),
-          _c_policy(c_policy)
+          _c_policy(c_policy),
+          _data_type(data_type)
     {
     }
 
@@ -1316,11 +1321,23 @@ public:
         return _d_position;
     }
 
+    /* Get whether the position embeddings are a pretrained table rather than the sinusoidal encoding */
+    bool pretrained() const
+    {
+        return _pretrained;
+    }
+
     /* Get convert policy */
     ConvertPolicy c_policy() const
     {
         return _c_policy;
     }
+
+    /* Get data type of the embedding tables, DataType::UNKNOWN when it follows the input */
+    DataType data_type() const
+    {
+        return _data_type;
+    }
     
 private:
     unsigned int _d_model;
@@ -1329,6 +1346,7 @@ private:
     unsigned int _d_position;
     bool _pretrained;
     ConvertPolicy _c_policy;
+    DataType _data_type;
 };
 
 /** Positional Encoding Layer Information Class */
@@ -1363,16 +1381,31 @@ private:
     unsigned int _d_model;
 };
 
+/** Available attention mask types */
+enum class AttentionMaskType
+{
+    NONE,         /**< No mask, every key position is attended */
+    ADDITIVE,     /**< F32 bias of shape [seq_k, 1 or seq_q, 1 or batch] added to the scaled scores before the softmax */
+    VALID_LENGTH, /**< S32 vector of shape [batch] holding the number of valid tokens of each padded sequence */
+};
+
 /** Multi Head Attention Layer Information Class */
 class MultiHeadAttentionLayerInfo final
 {
 public:
     /** Constructor
      *
-     * @param[in] d_model   Model dimesion
-     * @param[in] h         Parallel attention dimesion
+     * @param[in] d_model       Model dimesion
+     * @param[in] h             Parallel attention dimesion
+     * @param[in] mask_type     (Optional) Type of the attention mask input. Defaults to @ref AttentionMaskType::NONE
+     * @param[in] max_cache_len (Optional) Capacity in tokens of the key/value cache used for incremental decoding.
+     *                          Defaults to 0, no cache: key and value hold the whole sequence on every run
      */
-    MultiHeadAttentionLayerInfo(unsigned int d_model = 512, unsigned int h = 8) : _d_model(d_model), _h(h)
+    MultiHeadAttentionLayerInfo(unsigned int      d_model       = 512,
+                                unsigned int      h             = 8,
+                                AttentionMaskType mask_type     = AttentionMaskType::NONE,
+                                unsigned int      max_cache_len = 0)
+        : _d_model(d_model), _h(h), _mask_type(mask_type), _max_cache_len(max_cache_len)
     {
     }
 
@@ -1388,9 +1421,23 @@ public:
         return _h;
     }
 
+    /* Get the type of the attention mask */
+    AttentionMaskType mask_type() const
+    {
+        return _mask_type;
+    }
+
+    /* Get the capacity of the key/value cache, 0 when decoding without cache */
+    unsigned int max_cache_len() const
+    {
+        return _max_cache_len;
+    }
+
 private:
-    unsigned int _d_model;
-    unsigned int _h;
+    unsigned int      _d_model;
+    unsigned int      _h;
+    AttentionMaskType _mask_type;
+    unsigned int      _max_cache_len;
 };
 
 /** Scale Dot Production Attention Layer Information Class*/
@@ -1401,9 +1448,15 @@ public:
      *
      * @param[in] d_model   Model dimesion
      * @param[in] h         Parallel attention dimesion
+     * @param[in] mask_type     (Optional) Type of the attention mask input. Defaults to @ref AttentionMaskType::NONE
+     * @param[in] max_cache_len (Optional) Capacity in tokens of the key/value cache used for incremental decoding.
+     *                          Defaults to 0, no cache: key and value hold the whole sequence on every run
      */
-    ScaleDotProductionAttentionLayerInfo(unsigned int d_model = 512, unsigned int h = 8) : _d_model(d_model), 
-                                                                                           _h(h)
+    ScaleDotProductionAttentionLayerInfo(unsigned int      d_model       = 512,
+                                         unsigned int      h             = 8,
+                                         AttentionMaskType mask_type     = AttentionMaskType::NONE,
+                                         unsigned int      max_cache_len = 0)
+        : _d_model(d_model), _h(h), _mask_type(mask_type), _max_cache_len(max_cache_len)
     {
     }
 
@@ -1412,7 +1465,9 @@ public:
      * @param[in] mha_info   MultiHeadAttentionLayerInfo
      */
     ScaleDotProductionAttentionLayerInfo(MultiHeadAttentionLayerInfo mha_info) : _d_model(mha_info.d_model()),
-                                                                                        _h(mha_info.h())
+                                                                                        _h(mha_info.h()),
+                                                                                        _mask_type(mha_info.mask_type()),
+                                                                                        _max_cache_len(mha_info.max_cache_len())
     {
     }
     
@@ -1429,9 +1484,23 @@ public:
         return _h;
     }
 
+    /* Get the type of the attention mask */
+    AttentionMaskType mask_type() const
+    {
+        return _mask_type;
+    }
+
+    /* Get the capacity of the key/value cache, 0 when decoding without cache */
+    unsigned int max_cache_len() const
+    {
+        return _max_cache_len;
+    }
+
 private:
-    unsigned int _d_model;
-    unsigned int _h;
+    unsigned int      _d_model;
+    unsigned int      _h;
+    AttentionMaskType _mask_type;
+    unsigned int      _max_cache_len;
 };
 
 /** Multi Head Linear Layer Information Class*/
@@ -1538,12 +1607,17 @@ public:
     /** Constructor
      * 
      * @param[in] d_d_linear_hidden Linear layer hidden depth
+     * @param[in] w_shape           (Optional) Weights shape
+     * @param[in] b_shape           (Optional) Bias shape
+     * @param[in] act_info          (Optional) Activation applied to the output of the projection
      */
     LinearLayerInfo(unsigned int d_linear_hidden = 2048U,
                     TensorShape w_shape = TensorShape(),
-                    TensorShape b_shape = TensorShape()): _d_linear_hidden(d_linear_hidden),
+                    TensorShape b_shape = TensorShape(),
+                    ActivationLayerInfo act_info = ActivationLayerInfo()): _d_linear_hidden(d_linear_hidden),
                                                           _w_shape(w_shape),
-                                                          _b_shape(b_shape)
+                                                          _b_shape(b_shape),
+                                                          _act_info(act_info)
     {
     }
 
@@ -1564,11 +1638,54 @@ public:
     {
         return  _b_shape;
     }
+
+    /** Get the activation applied to the output */
+    const ActivationLayerInfo &activation_info() const
+    {
+        return _act_info;
+    }
+
+    /** Set the activation applied to the output */
+    LinearLayerInfo &set_activation_info(const ActivationLayerInfo &act_info)
+    {
+        _act_info = act_info;
+        return *this;
+    }
+
+    /** Get the data type the projection is computed in after quantizing its operands on the fly,
+     *  DataType::UNKNOWN when it is computed in the data type of its input */
+    DataType dynamic_quantization_type() const
+    {
+        return _dynamic_quantization_type;
+    }
+
+    /** Set the data type the projection is computed in after quantizing its operands on the fly */
+    LinearLayerInfo &set_dynamic_quantization_type(DataType data_type)
+    {
+        _dynamic_quantization_type = data_type;
+        return *this;
+    }
+
+    /** Get if the GEMM may run in a faster, lower precision data type (BF16 for F32 operands) */
+    bool fast_math() const
+    {
+        return _fast_math;
+    }
+
+    /** Set if the GEMM may run in a faster, lower precision data type (BF16 for F32 operands) */
+    LinearLayerInfo &set_fast_math(bool fast_math)
+    {
+        _fast_math = fast_math;
+        return *this;
+    }
     
 private:
     unsigned int _d_linear_hidden;
     TensorShape _w_shape;
     TensorShape _b_shape;
+    ActivationLayerInfo _act_info;
+    DataType _dynamic_quantization_type{DataType::UNKNOWN};
+    bool _fast_math{false};
 
 };
 
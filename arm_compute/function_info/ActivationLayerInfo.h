@@ -55,7 +55,8 @@ enum class ActivationFunction
     IDENTITY,   /**< Identity ( \f$ f(x)= x \f$ ) */
     HARD_SWISH, /**< Hard-swish ( \f$ f(x) = (x \text{ReLU6}(x+3))/6 = x \min(\max(0,x+3),6)/6 \f$ ) */
     SWISH,      /**< Swish ( \f$ f(x) = \frac{x}{1 + e^{-ax}} = x \text{logistic}(ax) \f$ ) */
-    GELU        /**< GELU ( \f$ f(x) = x * 1/2 * 1 + erf(x / \sqrt{2}) \f$ ) */
+    GELU,       /**< GELU ( \f$ f(x) = x * 1/2 * 1 + erf(x / \sqrt{2}) \f$ ) */
+    GELU_TANH   /**< GELU, tanh approximation ( \f$ f(x) = x * 1/2 * (1 + tanh(\sqrt{2 / \pi} (x + 0.044715 x^3))) \f$ ) */
 };
 /** Activation Layer Information class */
 class ActivationLayerInfo
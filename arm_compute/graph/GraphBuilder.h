@@ -419,21 +419,36 @@ public:
      * @param[in] params    Common node parameters
      * @param[in] input     Input to the normalization layer node as a NodeID-Index pair
      * @param[in] mha_info  Multi-head attention layer info
+     * @param[in] mask      (Optional) Attention mask as a NodeID-Index pair, EmptyNodeID when mha_info has no mask type
      * 
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
-    static NodeID add_multi_head_attention_node(Graph &g, NodeParams params, NodeIdxPair input, MultiHeadAttentionLayerInfo mha_info);
+    static NodeID add_multi_head_attention_node(Graph                      &g,
+                                                NodeParams                  params,
+                                                NodeIdxPair                 input,
+                                                MultiHeadAttentionLayerInfo mha_info,
+                                                NodeIdxPair                 mask = {EmptyNodeID, 0});
     /** Adds a layer normalization layer node to the graph
      *
      * @param[in] g       Graph to add the node to
      * @param[in] params  Common node parameters
      * @param[in] input   Input to the normalization layer node as a NodeID-Index pair
      * @param[in] info    Layer normalization infomation
+     * @param[in] gamma   (Optional) Accessor to get the per-channel gamma tensor data from. Default: nullptr.
+     * @param[in] beta    (Optional) Accessor to get the per-channel beta tensor data from. Default: nullptr.
      *
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
-    static NodeID add_layer_norm_node(Graph &g, NodeParams params, NodeIdxPair input, LayerNormLayerInfo info);
+    static NodeID add_layer_norm_node(Graph              &g,
+                                      NodeParams          params,
+                                      NodeIdxPair         input,
+                                      LayerNormLayerInfo  info,
+                                      ITensorAccessorUPtr gamma = nullptr,
+                                      ITensorAccessorUPtr beta  = nullptr);
     /** Adds a linear layer computing Key, Value, Query to the graph
+     *
+     * The three projections run as a single GEMM over the concatenated weights, followed by a split
+     * node whose outputs 0, 1 and 2 are the query, key and value views of the fused result.
      *
      * @param[in] g             Graph to add the node to
      * @param[in] params        Common node parameters
@@ -536,6 +551,17 @@ public:
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
     static NodeID add_pooling_node(Graph &g, NodeParams params, NodeIdxPair input, PoolingLayerInfo pool_info);
+    /** Adds a sinusoidal positional encoding layer node to the graph
+     *
+     * @param[in] g       Graph to add the node to
+     * @param[in] params  Common node parameters
+     * @param[in] input   Input embeddings to the positional encoding node as a NodeID-Index pair
+     * @param[in] pe_info Positional encoding layer information
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
+    static NodeID
+    add_positional_encoding_node(Graph &g, NodeParams params, NodeIdxPair input, PositionalEncodingLayerInfo pe_info);
     /** Adds a prelu layer node to the graph
      *
      * @param[in] g      Graph to add the node to
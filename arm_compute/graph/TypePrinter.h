@@ -104,6 +104,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::EltwiseLayer:
             os << "EltwiseLayer";
             break;
+        case NodeType::EmbeddingLayer:
+            os << "EmbeddingLayer";
+            break;
         case NodeType::UnaryEltwiseLayer:
             os << "UnaryEltwiseLayer";
             break;
@@ -140,6 +143,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::PoolingLayer:
             os << "PoolingLayer";
             break;
+        case NodeType::PositionalEncodingLayer:
+            os << "PositionalEncodingLayer";
+            break;
         case NodeType::PReluLayer:
             os << "PReluLayer";
             break;
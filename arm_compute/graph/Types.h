@@ -154,6 +154,7 @@ enum class FastMathHint
 enum class NodeType
 {
     ActivationLayer,
+    AddLayerNormLayer,
     ArgMinMaxLayer,
     BatchNormalizationLayer,
     BoundingBoxTransformLayer,
@@ -167,6 +168,7 @@ enum class NodeType
     DetectionOutputLayer,
     DetectionPostProcessLayer,
     EltwiseLayer,
+    EmbeddingLayer,
     EmbeddingSumLayer,
     FeedForwardLayer,
     FlattenLayer,
@@ -188,6 +190,7 @@ enum class NodeType
     PReluLayer,
     PrintLayer,
     PriorBoxLayer,
+    QKVLinearLayer,
     QuantizationLayer,
     ReductionOperationLayer,
     ReorgLayer,
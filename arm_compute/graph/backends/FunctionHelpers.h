@@ -1765,6 +1765,39 @@ std::unique_ptr<IFunction> create_position_embedding_layer(PositionEmbeddingLaye
     return func;
 }
 
+/** Creates a backend sinusoidal positional encoding layer function
+ *
+ * @tparam PositionalEncodingLayerFunction Backend positional encoding function
+ * @tparam TargetInfo                      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend positional encoding layer function
+ */
+template <typename PositionalEncodingLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_positional_encoding_layer(PositionalEncodingNode &node)
+{
+    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<PositionalEncodingLayerFunction>();
+    func->configure(input, output, node.positional_encoding_info());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << input->info()->data_type()
+                                               << " Input shape: " << input->info()->tensor_shape()
+                                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Creates a backend embedding summing layer function
  *
  * @tparam EmbeddingSumLayerFunction  Backend position embedding function
@@ -1793,17 +1826,62 @@ std::unique_ptr<IFunction> create_embedding_sum_layer(EmbeddingSumLayerNode &nod
     return func;
 }
 
+/** Creates a backend fused embedding layer function
+ *
+ * @tparam EmbeddingLayerFunction Backend fused embedding function
+ * @tparam TargetInfo             Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused embedding layer function
+ */
+template <typename EmbeddingLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_embedding_layer(EmbeddingLayerNode &node)
+{
+    validate_node<TargetInfo>(node, 7 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *tokens         = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *segments       = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *token_table    = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *segment_table  = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *position_table = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *gamma          = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *beta           = get_backing_tensor<TargetInfo>(node.input(6));
+    typename TargetInfo::TensorType *output         = get_backing_tensor<TargetInfo>(node.output(0));
+
+    ARM_COMPUTE_ERROR_ON(tokens == nullptr || segments == nullptr);
+    // A missing position table selects the sinusoidal encoding
+    ARM_COMPUTE_ERROR_ON(token_table == nullptr || segment_table == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<EmbeddingLayerFunction>();
+    func->configure(tokens, segments, token_table, segment_table, position_table, gamma, beta, output,
+                    node.embedding_info(), node.has_fused_layer_norm(), node.fused_layer_norm_info());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << output->info()->data_type()
+                                               << " Input shape: " << tokens->info()->tensor_shape()
+                                               << " Output shape: " << output->info()->tensor_shape()
+                                               << (node.has_fused_layer_norm() ? " Fused LayerNorm" : "") << std::endl);
+
+    return func;
+}
+
 /** Creates a backend linear layer function
  *
  * @tparam LinearLayerFunction  Backend linear layer function
  * @tparam TargetInfo           Target-specific information
  *
  * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
  *
  * @return Backend linear layer function
  */
 template <typename LinearLayerFunction, typename TargetInfo>
-std::unique_ptr<IFunction> create_linear_layer(LinearLayerNode &node)
+std::unique_ptr<IFunction> create_linear_layer(LinearLayerNode &node, GraphContext &ctx)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
@@ -1816,12 +1894,59 @@ std::unique_ptr<IFunction> create_linear_layer(LinearLayerNode &node)
     const LinearLayerInfo linear_info         = node.linear_info();
 
     // Create function
-    auto func = std::make_unique<LinearLayerFunction>();
+    auto wm   = get_weights_manager(ctx, TargetInfo::TargetType);
+    auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
+    auto func = std::make_unique<LinearLayerFunction>(mm, wm.get());
     func->configure(input, weight, bias, output, linear_info);
 
     ARM_COMPUTE_LOG_GRAPH_INFO(
         "Instantiated " << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
-                        << " Data Type: " << input->info()->data_type() << "Input Shape: " << input->info()->tensor_shape() << std::endl);
+                        << " Data Type: " << input->info()->data_type() << "Input Shape: " << input->info()->tensor_shape()
+                        << (linear_info.activation_info().enabled()
+                                ? " " + to_string(linear_info.activation_info().activation())
+                                : "")
+                        << std::endl);
+
+    return func;
+}
+
+/** Creates a backend fused query, key and value linear layer function
+ *
+ * @tparam QKVLinearLayerFunction  Backend fused QKV linear layer function
+ * @tparam TargetInfo              Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused QKV linear layer function
+ */
+template <typename QKVLinearLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_qkv_linear_layer(QKVLinearLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 7 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input         = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *query_weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *query_bias    = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *key_weights   = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *key_bias      = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *value_weights = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *value_bias    = get_backing_tensor<TargetInfo>(node.input(6));
+    typename TargetInfo::TensorType *output        = get_backing_tensor<TargetInfo>(node.output(0));
+    const LinearLayerInfo            linear_info   = node.linear_info();
+
+    // Create function
+    auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
+    auto func = std::make_unique<QKVLinearLayerFunction>(mm);
+    func->configure(input, query_weights, query_bias, key_weights, key_bias, value_weights, value_bias, output,
+                    linear_info);
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: "
+                                               << input->info()->data_type() << " Input Shape: "
+                                               << input->info()->tensor_shape() << " Output Shape: "
+                                               << output->info()->tensor_shape() << std::endl);
 
     return func;
 }
@@ -1879,26 +2004,27 @@ std::unique_ptr<IFunction> create_simple_forward_layer(SimpleForwardLayerNode &n
 template <typename ScaleDotProductionLayerFunction, typename TargetInfo>
 std::unique_ptr<IFunction> create_scale_dot_production_layer(ScaleDotProductionAttentionNode &node, GraphContext &ctx)
 {
-    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+    validate_node<TargetInfo>(node, 4 /* expected inputs */, 1 /* expected outputs */);
 
      // Extract IO and info
     typename TargetInfo::TensorType *query   = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *key     = get_backing_tensor<TargetInfo>(node.input(1));
     typename TargetInfo::TensorType *value   = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *mask    = get_backing_tensor<TargetInfo>(node.input(3));
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
 
-    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(query == nullptr);
     ARM_COMPUTE_ERROR_ON(output == nullptr);
 
     // Create and configure function
     auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
     auto func = std::make_unique<ScaleDotProductionLayerFunction>(mm);
-    func->configure(query,key,value,output,node.sdpa_info());
+    func->configure(query,key,value,mask,output,node.sdpa_info());
 
     // Log info
     ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
-                                               << TargetInfo::TargetType << " Data Type: " << input->info()->data_type()
-                                               << " Input shape: " << input->info()->tensor_shape()
+                                               << TargetInfo::TargetType << " Data Type: " << query->info()->data_type()
+                                               << " Input shape: " << query->info()->tensor_shape()
                                                << " Output shape: " << output->info()->tensor_shape() << std::endl);
 
     return func;
@@ -1916,10 +2042,12 @@ std::unique_ptr<IFunction> create_scale_dot_production_layer(ScaleDotProductionA
 template <typename LayerNormLayerFunction, typename TargetInfo>
 std::unique_ptr<IFunction> create_layer_norm_layer(LayerNormNode &node)
 {
-    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
 
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *gamma   = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *beta    = get_backing_tensor<TargetInfo>(node.input(2));
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
 
     ARM_COMPUTE_ERROR_ON(input == nullptr);
@@ -1927,7 +2055,7 @@ std::unique_ptr<IFunction> create_layer_norm_layer(LayerNormNode &node)
 
     // Create and configure function
     auto func = std::make_unique<LayerNormLayerFunction>();
-    func->configure(input,output,node.layer_norm_info());
+    func->configure(input, gamma, beta, output, node.layer_norm_info());
 
     // Log info
     ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
@@ -1938,6 +2066,46 @@ std::unique_ptr<IFunction> create_layer_norm_layer(LayerNormNode &node)
     return func;
 }
 
+/** Creates a backend residual addition + layer normalization function
+ *
+ * @tparam AddLayerNormLayerFunction Backend fused addition and layer normalization function
+ * @tparam TargetInfo                Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused addition and layer normalization function
+ */
+template <typename AddLayerNormLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_add_layer_norm_layer(AddLayerNormNode &node)
+{
+    validate_node<TargetInfo>(node, 4 /* expected inputs */, node.num_outputs() /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input1 = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *input2 = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *gamma  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *beta   = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    typename TargetInfo::TensorType *sum =
+        node.num_outputs() > 1 ? get_backing_tensor<TargetInfo>(node.output(1)) : nullptr;
+
+    ARM_COMPUTE_ERROR_ON(input1 == nullptr);
+    ARM_COMPUTE_ERROR_ON(input2 == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<AddLayerNormLayerFunction>();
+    func->configure(input1, input2, gamma, beta, output, sum, node.layer_norm_info());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << input1->info()->data_type()
+                                               << " Input shape: " << input1->info()->tensor_shape()
+                                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 } // namespace detail
 } // namespace backends
 } // namespace graph
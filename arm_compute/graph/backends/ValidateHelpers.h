@@ -628,6 +628,36 @@ Status validate_roi_align_layer(ROIAlignLayerNode &node)
     return ROIAlignLayer::validate(input, rois, output, pool_info);
 }
 
+/** Validates a Scale dot production attention node
+ *
+ * Rejects at graph validation the configurations that no attention path runs, such as batched inputs whose head
+ * depth only the single-sequence unfused fallback handles.
+ *
+ * @tparam ScaleDotProductionLayer Scale dot production attention function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename ScaleDotProductionLayer>
+Status validate_scale_dot_production_layer(ScaleDotProductionAttentionNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating ScaleDotProductionAttentionLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *query  = detail::get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *key    = detail::get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *value  = detail::get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *mask   = detail::get_backing_tensor_info(node.input(3));
+    arm_compute::ITensorInfo *output = detail::get_backing_tensor_info(node.output(0));
+
+    // Validate function
+    return ScaleDotProductionLayer::validate(query, key, value, mask, output, node.sdpa_info());
+}
+
 /** Validates a Slice layer node
  *
  * @tparam SliceLayer Slice layer function type
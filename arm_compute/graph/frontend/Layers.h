@@ -27,10 +27,12 @@
 #include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/frontend/ILayer.h"
 #include "arm_compute/graph/frontend/IStream.h"
+#include "arm_compute/graph/frontend/IStreamOperators.h"
 #include "arm_compute/graph/frontend/SubStream.h"
 #include "arm_compute/graph/GraphBuilder.h"
 #include "arm_compute/graph/Types.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -718,7 +720,9 @@ public:
     {
         NodeParams  common_params = {name(), s.hints().target_hint};
         NodeIdxPair input         = {s.tail_node(), 0};
-        return GraphBuilder::add_linear_node(s.graph(), common_params, input, _info, std::move( _ff_weights), std::move(_ff_bias));
+        LinearLayerInfo info          = _info;
+        info.set_fast_math(s.hints().fast_math_hint == FastMathHint::Enabled);
+        return GraphBuilder::add_linear_node(s.graph(), common_params, input, info, std::move( _ff_weights), std::move(_ff_bias));
     }
 
 private:
@@ -888,8 +892,12 @@ class LayerNormLayer final : public ILayer
 public:
     /** Construct a layer norm layer.
      *
+     * @param[in] info  Layer normalization information.
+     * @param[in] gamma (Optional) Accessor to get the per-channel gamma tensor data from. Default: nullptr.
+     * @param[in] beta  (Optional) Accessor to get the per-channel beta tensor data from. Default: nullptr.
      */
-    LayerNormLayer(LayerNormLayerInfo info) : _info(info)
+    LayerNormLayer(LayerNormLayerInfo info, ITensorAccessorUPtr gamma = nullptr, ITensorAccessorUPtr beta = nullptr)
+        : _info(info), _gamma(std::move(gamma)), _beta(std::move(beta))
     {
     }
 
@@ -897,11 +905,14 @@ public:
     {
         NodeParams  common_params = {name(), s.hints().target_hint};
         NodeIdxPair input         = {s.tail_node(), 0};
-        return GraphBuilder::add_layer_norm_node(s.graph(), common_params, input, _info);
+        return GraphBuilder::add_layer_norm_node(s.graph(), common_params, input, _info, std::move(_gamma),
+                                                 std::move(_beta));
     }
 
 private:
-    LayerNormLayerInfo _info;
+    LayerNormLayerInfo  _info;
+    ITensorAccessorUPtr _gamma;
+    ITensorAccessorUPtr _beta;
 };
 
 /** Multi Head Linear Layer */
@@ -931,7 +942,9 @@ public:
     {
         NodeParams  common_params = {name(), s.hints().target_hint};
         NodeIdxPair input         = {s.tail_node(), 0};
-        return GraphBuilder::add_multi_head_linear_layer(s.graph(), common_params, input, _info,
+        LinearLayerInfo info          = _info;
+        info.set_fast_math(s.hints().fast_math_hint == FastMathHint::Enabled);
+        return GraphBuilder::add_multi_head_linear_layer(s.graph(), common_params, input, info,
                                                                              std::move(_query_weights),
                                                                              std::move(_query_bias),
                                                                              std::move(_key_weights),
@@ -981,10 +994,23 @@ class MultiHeadAttentionLayer final: public ILayer
 {
 public:
     /** Construct a multi-head attention layer.
+     *
+     * @note With mha_info.max_cache_len() set every run of the graph decodes one token, whose query, key and value
+     *       are [d_model, 1, batch], against the keys and values of the previous runs. The caches span the lifetime
+     *       of the finalized graph: decode a new sequence with a new graph.
      *
      * @param[in] mha_info      Multi head attention layer information
      */
-    MultiHeadAttentionLayer(const MultiHeadAttentionLayerInfo &mha_info) : _mha_info(mha_info)
+    MultiHeadAttentionLayer(const MultiHeadAttentionLayerInfo &mha_info) : _mha_info(mha_info), _mask(nullptr)
+    {
+    }
+    /** Construct a multi-head attention layer with an attention mask.
+     *
+     * @param[in] mha_info      Multi head attention layer information, its mask type describes @p mask
+     * @param[in] mask          Graph sub-stream producing the additive or valid-length attention mask
+     */
+    MultiHeadAttentionLayer(const MultiHeadAttentionLayerInfo &mha_info, SubStream &&mask)
+        : _mha_info(mha_info), _mask(std::make_unique<SubStream>(std::move(mask)))
     {
     }
 
@@ -992,12 +1018,13 @@ public:
     {
         NodeParams  common_params = {name(), s.hints().target_hint};
         NodeIdxPair input         = {s.tail_node(), 0};
-        return GraphBuilder::add_multi_head_attention_node(s.graph(), common_params, input, _mha_info);
+        NodeIdxPair mask          = {(_mask != nullptr) ? _mask->tail_node() : EmptyNodeID, 0};
+        return GraphBuilder::add_multi_head_attention_node(s.graph(), common_params, input, _mha_info, mask);
     }
 
 private:
-    const MultiHeadAttentionLayerInfo &_mha_info;
-
+    MultiHeadAttentionLayerInfo _mha_info;
+    std::unique_ptr<SubStream>  _mask;
 };
 
 /** Normalization Layer */
@@ -1132,11 +1159,12 @@ private:
 class PositionalEncodingLayer final : public ILayer
 {
 public:
-    /** Construct a positional encoding layer.
+    /** Construct a sinusoidal positional encoding layer.
      *
-     * @param[in] 
+     * @param[in] position_encode_info Positional encoding layer information
      */
-    PositionalEncodingLayer(PositionalEncodingLayerInfo position_encode_info, TensorShape shape) : _shape(shape), _position_encode_info(position_encode_info) 
+    PositionalEncodingLayer(PositionalEncodingLayerInfo position_encode_info)
+        : _position_encode_info(position_encode_info)
     {
     }
 
@@ -1144,11 +1172,10 @@ public:
     {
         NodeParams  common_params = {name(), s.hints().target_hint};
         NodeIdxPair input         = {s.tail_node(), 0};
-        return GraphBuilder::add_dummy_node(s.graph(), common_params, input, _shape);
+        return GraphBuilder::add_positional_encoding_node(s.graph(), common_params, input, _position_encode_info);
     }
 
 private:
-    TensorShape _shape;
     PositionalEncodingLayerInfo _position_encode_info;
 };
 
@@ -1630,6 +1657,132 @@ private:
     StridedSliceLayerInfo _info;
 };
 
+/** Transformer Encoder Layer
+ *
+ * Stacks identical encoder blocks, each made of:
+ *  -# Query, key and value projections and multi-head self-attention, added to the block input
+ *  -# Layer normalization
+ *  -# Feed forward (linear, GELU, linear), added to its input
+ *  -# Layer normalization
+ *
+ * The blocks only exchange their output, so the transition memory manager reuses the intermediate tensors of
+ * one block for the next and the activation memory does not grow with the number of blocks.
+ */
+class TransformerEncoderLayer final : public ILayer
+{
+public:
+    /** Function returning the accessor of a parameter of a block, given the block index and the parameter name:
+     * query_weight, query_bias, key_weight, key_bias, value_weight, value_bias, attention_norm_gamma,
+     * attention_norm_beta, ff_weight_0, ff_bias_0, ff_weight_1, ff_bias_1, ff_norm_gamma or ff_norm_beta
+     */
+    using ParameterAccessorFunction = std::function<ITensorAccessorUPtr(unsigned int, const std::string &)>;
+
+    /** Construct a transformer encoder layer without attention mask
+     *
+     * @param[in] num_layers Number of encoder blocks
+     * @param[in] mha_info   Multi head attention layer information, its mask type must be @ref AttentionMaskType::NONE
+     * @param[in] d_ff       Width of the feed forward hidden layer
+     * @param[in] eps        Epsilon of the layer normalizations
+     * @param[in] parameters Function returning the accessors of the parameters of every block
+     */
+    TransformerEncoderLayer(unsigned int                       num_layers,
+                            const MultiHeadAttentionLayerInfo &mha_info,
+                            unsigned int                       d_ff,
+                            float                              eps,
+                            ParameterAccessorFunction          parameters)
+        : _num_layers(num_layers),
+          _mha_info(mha_info),
+          _d_ff(d_ff),
+          _eps(eps),
+          _parameters(std::move(parameters)),
+          _mask(nullptr)
+    {
+    }
+    /** Construct a transformer encoder layer with an attention mask shared by every block
+     *
+     * @param[in] num_layers Number of encoder blocks
+     * @param[in] mha_info   Multi head attention layer information, its mask type describes @p mask
+     * @param[in] d_ff       Width of the feed forward hidden layer
+     * @param[in] eps        Epsilon of the layer normalizations
+     * @param[in] parameters Function returning the accessors of the parameters of every block
+     * @param[in] mask       Graph sub-stream producing the additive or valid-length attention mask
+     */
+    TransformerEncoderLayer(unsigned int                       num_layers,
+                            const MultiHeadAttentionLayerInfo &mha_info,
+                            unsigned int                       d_ff,
+                            float                              eps,
+                            ParameterAccessorFunction          parameters,
+                            SubStream                        &&mask)
+        : _num_layers(num_layers),
+          _mha_info(mha_info),
+          _d_ff(d_ff),
+          _eps(eps),
+          _parameters(std::move(parameters)),
+          _mask(std::make_unique<SubStream>(std::move(mask)))
+    {
+    }
+
+    NodeID create_layer(IStream &s) override
+    {
+        const unsigned int d_model = _mha_info.d_model();
+
+        SubStream encoder(s);
+        for (unsigned int l = 0; l < _num_layers; ++l)
+        {
+            const std::string block_name = name() + "/layer_" + support::cpp11::to_string(l);
+            const auto        parameter  = [&](const std::string &parameter_name)
+            { return _parameters(l, parameter_name); };
+
+            SubStream without_attention(encoder);
+            SubStream with_attention(encoder);
+            with_attention << MultiHeadLinearLayer(LinearLayerInfo(d_model), parameter("query_weight"),
+                                                   parameter("query_bias"), parameter("key_weight"),
+                                                   parameter("key_bias"), parameter("value_weight"),
+                                                   parameter("value_bias"))
+                                  .set_name(block_name + "/qkv");
+            if (_mask != nullptr)
+            {
+                with_attention << MultiHeadAttentionLayer(_mha_info, SubStream(*_mask)).set_name(block_name + "/mha");
+            }
+            else
+            {
+                with_attention << MultiHeadAttentionLayer(_mha_info).set_name(block_name + "/mha");
+            }
+
+            encoder << EltwiseLayer(std::move(with_attention), std::move(without_attention), EltwiseOperation::Add)
+                           .set_name(block_name + "/add_4_norm_attention")
+                    << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, _eps), parameter("attention_norm_gamma"),
+                                      parameter("attention_norm_beta"))
+                           .set_name(block_name + "/attention_norm");
+
+            SubStream without_ff(encoder);
+            SubStream with_ff(encoder);
+            with_ff << LinearLayer(LinearLayerInfo(_d_ff, TensorShape(d_model, _d_ff), TensorShape(_d_ff)),
+                                   parameter("ff_weight_0"), parameter("ff_bias_0"))
+                           .set_name(block_name + "/ff_0")
+                    << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::GELU))
+                           .set_name(block_name + "/gelu")
+                    << LinearLayer(LinearLayerInfo(d_model, TensorShape(_d_ff, d_model), TensorShape(d_model)),
+                                   parameter("ff_weight_1"), parameter("ff_bias_1"))
+                           .set_name(block_name + "/ff_1");
+
+            encoder << EltwiseLayer(std::move(with_ff), std::move(without_ff), EltwiseOperation::Add)
+                           .set_name(block_name + "/add_4_norm_ff")
+                    << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, _eps), parameter("ff_norm_gamma"),
+                                      parameter("ff_norm_beta"))
+                           .set_name(block_name + "/ff_norm");
+        }
+        return encoder.tail_node();
+    }
+
+private:
+    unsigned int                _num_layers;
+    MultiHeadAttentionLayerInfo _mha_info;
+    unsigned int                _d_ff;
+    float                       _eps;
+    ParameterAccessorFunction   _parameters;
+    std::unique_ptr<SubStream>  _mask;
+};
 
 /** Embedding Layer */
 class EmbeddingLayer final : public ILayer
@@ -31,7 +31,11 @@ namespace arm_compute
 {
 namespace graph
 {
-/** Mutation pass to create synthetic graphs of a given data type */
+/** Mutation pass to create synthetic graphs of a given data type
+ *
+ * @note Transformer graphs keep their float tensors, their linear projections are computed on dynamically
+ *       quantized operands instead
+ */
 class SyntheticDataTypeMutator final : public IGraphMutator
 {
 public:
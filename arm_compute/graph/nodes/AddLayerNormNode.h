@@ -0,0 +1,50 @@
+#ifndef ARM_COMPUTE_GRAPH_ADD_LAYER_NORM_NODE_H
+#define ARM_COMPUTE_GRAPH_ADD_LAYER_NORM_NODE_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Residual addition fused with Layer Normalization node
+ *
+ * Inputs are the two addends, the optional gamma and beta. Output 0 is the normalized result and,
+ * when requested, output 1 is the pre-normalization sum.
+ */
+class AddLayerNormNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info     Contains information described in @ref LayerNormLayerInfo.
+     * @param[in] with_sum (Optional) Also output the pre-normalization sum. Defaults to false.
+     */
+    AddLayerNormNode(LayerNormLayerInfo info, bool with_sum = false);
+    /** Prevent instances of this class from being copy constructed */
+    AddLayerNormNode(const AddLayerNormNode &) = delete;
+    /** Prevent instances of this class from being copied */
+    AddLayerNormNode &operator=(const AddLayerNormNode &) = delete;
+
+    /** LayerNormInfo accessor
+     *
+     * @return LayerNormInfo
+     */
+    const LayerNormLayerInfo &layer_norm_info() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::AddLayerNormLayer;
+
+private:
+    LayerNormLayerInfo _info;
+};
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_ADD_LAYER_NORM_NODE_H */
@@ -0,0 +1,72 @@
+#ifndef ARM_COMPUTE_GRAPH_EMBEDDING_LAYER_NODE_H
+#define ARM_COMPUTE_GRAPH_EMBEDDING_LAYER_NODE_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused token, segment and position embedding node
+ *
+ * Inputs are the token ids, the segment ids, the token, segment and position tables and, once a following
+ * layer normalization has been fused, its optional gamma and beta.
+ */
+class EmbeddingLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info Embedding layer information
+     */
+    EmbeddingLayerNode(EmbeddingLayerInfo info);
+    /** Prevent instances of this class from being copy constructed */
+    EmbeddingLayerNode(const EmbeddingLayerNode &) = delete;
+    /** Prevent instances of this class from being copied */
+    EmbeddingLayerNode &operator=(const EmbeddingLayerNode &) = delete;
+
+    /** Embedding layer info accessor
+     *
+     * @return Embedding layer info
+     */
+    const EmbeddingLayerInfo &embedding_info() const;
+    /** Fuse a layer normalization of the summed embeddings into the node
+     *
+     * @param[in] ln_info Layer normalization information
+     */
+    void set_fused_layer_norm(const LayerNormLayerInfo &ln_info);
+    /** Whether a layer normalization has been fused into the node */
+    bool has_fused_layer_norm() const;
+    /** Fused layer normalization info accessor
+     *
+     * @return Layer normalization info, only meaningful when @ref has_fused_layer_norm is true
+     */
+    const LayerNormLayerInfo &fused_layer_norm_info() const;
+    /** Computes embedding output descriptor
+     *
+     * @param[in] tokens_descriptor      Token ids tensor descriptor, shape [seq, batch]
+     * @param[in] token_table_descriptor Token table tensor descriptor, shape [d_model, vocab_size]
+     *
+     * @return Output descriptor, shape [d_model, seq, batch]
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &tokens_descriptor,
+                                                      const TensorDescriptor &token_table_descriptor);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::EmbeddingLayer;
+
+private:
+    EmbeddingLayerInfo _info;
+    LayerNormLayerInfo _ln_info{};
+    bool               _layer_norm{false};
+};
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_EMBEDDING_LAYER_NODE_H */
@@ -34,6 +34,8 @@ class LayerNormNode final : public INode
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    static constexpr NodeType node_type = NodeType::LayerNormLayer;
+
     private:
     LayerNormLayerInfo _info;
 };
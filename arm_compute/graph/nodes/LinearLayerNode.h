@@ -27,6 +27,21 @@ class LinearLayerNode final : public INode
      * @return LinearLayerInfo
      */
     const LinearLayerInfo &linear_info() const;
+    /** Returns fused activation
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+    /** Sets fused activation
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
+    /** Sets the data type the projection is computed in after quantizing its operands on the fly
+     *
+     * @param[in] data_type Quantized data type, DataType::UNKNOWN to compute in the data type of the input
+     */
+    void set_dynamic_quantization_type(DataType data_type);
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -34,6 +49,9 @@ class LinearLayerNode final : public INode
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    public:
+    static constexpr NodeType node_type = NodeType::LinearLayer;
+
     private:
     LinearLayerInfo _linear_info;
 };
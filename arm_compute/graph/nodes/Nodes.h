@@ -70,10 +70,14 @@
 #include "arm_compute/graph/nodes/TokenEmbeddingLayerNode.h"
 #include "arm_compute/graph/nodes/ScaleDotProductionAttentionNode.h"
 #include "arm_compute/graph/nodes/LayerNormNode.h"
+#include "arm_compute/graph/nodes/AddLayerNormNode.h"
 #include "arm_compute/graph/nodes/LinearLayerNode.h"
+#include "arm_compute/graph/nodes/QKVLinearLayerNode.h"
 #include "arm_compute/graph/nodes/SimpleForwardLayerNode.h"
 #include "arm_compute/graph/nodes/SegmentEmbeddingLayerNode.h"
 #include "arm_compute/graph/nodes/PositionEmbeddingLayerNode.h"
+#include "arm_compute/graph/nodes/PositionalEncodingNode.h"
 #include "arm_compute/graph/nodes/EmbeddingSumLayerNode.h"
+#include "arm_compute/graph/nodes/EmbeddingLayerNode.h"
 
 #endif // ACL_ARM_COMPUTE_GRAPH_NODES_NODES_H
@@ -8,7 +8,7 @@ namespace arm_compute
 {
 namespace graph
 {
-/** Positional Encoding Node */
+/** Sinusoidal positional encoding node, adds the encoding of every position to the input embeddings */
 class PositionalEncodingNode final : public INode
 {
 public:
@@ -24,8 +24,9 @@ public:
     PositionalEncodingLayerInfo positional_encoding_info() const;
     /** Computes positional encoding output descriptor
      *
-     * @param[in] PositionalEncodingLayerInfo Positional encoding layer information
-     * 
+     * @param[in] input_descriptor Input embeddings descriptor
+     * @param[in] info             Positional encoding layer information
+     *
      * @return Output descriptor
      */
     static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor, PositionalEncodingLayerInfo info);
@@ -36,6 +37,8 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    static constexpr NodeType node_type = NodeType::PositionalEncodingLayer;
+
 private:
     PositionalEncodingLayerInfo _info;
 };
@@ -0,0 +1,54 @@
+#ifndef ARM_COMPUTE_GRAPH_QKV_LINEAR_LAYER_NODE_H
+#define ARM_COMPUTE_GRAPH_QKV_LINEAR_LAYER_NODE_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Query, Key and Value Linear Layer node
+ *
+ * Inputs are the activation followed by the query, key and value weights and biases. The single output
+ * holds the three projections side by side along X.
+ */
+class QKVLinearLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] linear_info Contains information described in @ref LinearLayerInfo.
+     */
+    QKVLinearLayerNode(LinearLayerInfo linear_info);
+    /** Prevent instances of this class from being copy constructed */
+    QKVLinearLayerNode(const QKVLinearLayerNode &) = delete;
+    /** Prevent instances of this class from being copied */
+    QKVLinearLayerNode &operator=(const QKVLinearLayerNode &) = delete;
+
+    /** LinearLayerInfo accessor
+     *
+     * @return LinearLayerInfo
+     */
+    const LinearLayerInfo &linear_info() const;
+    /** Sets the data type the projections are computed in after quantizing their operands on the fly
+     *
+     * @param[in] data_type Quantized data type, DataType::UNKNOWN to compute in the data type of the input
+     */
+    void set_dynamic_quantization_type(DataType data_type);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::QKVLinearLayer;
+
+private:
+    LinearLayerInfo _linear_info;
+};
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_QKV_LINEAR_LAYER_NODE_H */
@@ -25,6 +25,7 @@
 #define ACL_ARM_COMPUTE_RUNTIME_NEON_NEFUNCTIONS_H
 
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEAddLayerNormLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEAddMulAdd.h"
 #include "arm_compute/runtime/NEON/functions/NEArgMinMaxLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
@@ -53,6 +54,7 @@
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEElementwiseOperations.h"
 #include "arm_compute/runtime/NEON/functions/NEElementwiseUnaryLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEEmbeddingSumLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEFFT1D.h"
 #include "arm_compute/runtime/NEON/functions/NEFFT2D.h"
@@ -88,7 +90,9 @@
 #include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEPReluLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEPositionEmbeddingLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPositionalEncodingLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEPriorBoxLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEQKVLinearLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEQLSTMLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEQuantizationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NERange.h"
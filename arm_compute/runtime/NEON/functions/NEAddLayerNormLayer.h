@@ -0,0 +1,84 @@
+#ifndef ARM_COMPUTE_ADD_LAYER_NORM_LAYER_H
+#define ARM_COMPUTE_ADD_LAYER_NORM_LAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Perform residual addition followed by layer normalization */
+class NEAddLayerNormLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEAddLayerNormLayer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAddLayerNormLayer(const NEAddLayerNormLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEAddLayerNormLayer(NEAddLayerNormLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAddLayerNormLayer &operator=(const NEAddLayerNormLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEAddLayerNormLayer &operator=(NEAddLayerNormLayer &&) = delete;
+    /** Destructor */
+    ~NEAddLayerNormLayer();
+
+    /** Initialise the kernel's inputs and outputs
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |dst          |
+     * |:--------------|:--------------|:------------|
+     * |F32            |F32            |F32          |
+     * |F16            |F16            |F16          |
+     * |BFLOAT16       |BFLOAT16       |BFLOAT16     |
+     *
+     * @param[in]  input1         First addend. Data type supported: F32/F16/BFLOAT16.
+     * @param[in]  input2         Second addend. Data type supported: Same as @p input1.
+     * @param[in]  gamma          Per-channel scale tensor, nullptr to use the gamma of @p LayerNorm_info.
+     * @param[in]  beta           Per-channel offset tensor, nullptr to use the beta of @p LayerNorm_info.
+     * @param[out] output         Normalized output tensor. Data type supported: Same as @p input1.
+     * @param[out] sum            Pre-normalization sum output, nullptr if not required.
+     * @param[in]  LayerNorm_info Layer normalization information.
+     */
+    void configure(const ITensor *input1,
+                   const ITensor *input2,
+                   const ITensor *gamma,
+                   const ITensor *beta,
+                   ITensor       *output,
+                   ITensor       *sum,
+                   const LayerNormLayerInfo &LayerNorm_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEAddLayerNormLayer
+     *
+     * Similar to @ref NEAddLayerNormLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input1,
+                           const ITensorInfo *input2,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           const ITensorInfo *sum,
+                           const LayerNormLayerInfo &LayerNorm_info);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_ADD_LAYER_NORM_LAYER_H */
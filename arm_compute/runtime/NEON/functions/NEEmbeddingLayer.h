@@ -0,0 +1,95 @@
+#ifndef ARM_COMPUTE_NE_EMBEDDING_LAYER_H
+#define ARM_COMPUTE_NE_EMBEDDING_LAYER_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Gather and sum the token, segment and position embeddings in a single pass, optionally followed by layer normalization */
+class NEEmbeddingLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEEmbeddingLayer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingLayer(const NEEmbeddingLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingLayer(NEEmbeddingLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingLayer &operator=(const NEEmbeddingLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingLayer &operator=(NEEmbeddingLayer &&) = delete;
+    /** Destructor */
+    ~NEEmbeddingLayer();
+
+    /** Initialise the kernel's inputs and outputs
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |tokens/segments |tables         |dst          |
+     * |:---------------|:--------------|:------------|
+     * |U32 ids         |F32            |F32          |
+     *
+     * @param[in]  tokens         Token ids, shape [seq, batch]. Data types supported: any 32-bit type holding U32 ids.
+     * @param[in]  segments       Segment ids. Shape and data type supported: Same as @p tokens
+     * @param[in]  token_table    Token embedding table, shape [d_model, vocab_size]. Data type supported: F16/F32
+     * @param[in]  segment_table  Segment embedding table, shape [d_model, num_segments]. Data type supported: Same as @p token_table
+     * @param[in]  position_table Position embedding table, shape [d_model, max_position], nullptr to use the sinusoidal
+     *                            encoding. Data type supported: Same as @p token_table
+     * @param[in]  gamma          Per-channel scale tensor, nullptr to use the gamma of @p ln_info.
+     * @param[in]  beta           Per-channel offset tensor, nullptr to use the beta of @p ln_info.
+     * @param[out] output         Embedded output, shape [d_model, seq, batch]. Data type supported: Same as @p token_table
+     * @param[in]  emb_info       Embedding layer information.
+     * @param[in]  layer_norm     (Optional) Normalize the sum of the embeddings
+     * @param[in]  ln_info        (Optional) Layer normalization information.
+     */
+    void configure(const ITensor            *tokens,
+                   const ITensor            *segments,
+                   const ITensor            *token_table,
+                   const ITensor            *segment_table,
+                   const ITensor            *position_table,
+                   const ITensor            *gamma,
+                   const ITensor            *beta,
+                   ITensor                  *output,
+                   const EmbeddingLayerInfo &emb_info,
+                   bool                      layer_norm = false,
+                   const LayerNormLayerInfo &ln_info    = LayerNormLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEEmbeddingLayer
+     *
+     * Similar to @ref NEEmbeddingLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *tokens,
+                           const ITensorInfo        *segments,
+                           const ITensorInfo        *token_table,
+                           const ITensorInfo        *segment_table,
+                           const ITensorInfo        *position_table,
+                           const ITensorInfo        *gamma,
+                           const ITensorInfo        *beta,
+                           const ITensorInfo        *output,
+                           const EmbeddingLayerInfo &emb_info,
+                           bool                      layer_norm = false,
+                           const LayerNormLayerInfo &ln_info    = LayerNormLayerInfo());
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_NE_EMBEDDING_LAYER_H */
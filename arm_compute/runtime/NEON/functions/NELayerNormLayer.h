@@ -39,19 +39,33 @@ public:
      * |src0           |dst          |
      * |:--------------|:------------|
      * |F32            |F32          |
+     * |F16            |F16          |
+     * |BFLOAT16       |BFLOAT16     |
      *
-     * @param[in]  input1 First tensor input. Data type supported: F32.
-     * @param[out] output Output tensor. Data type supported: F32.
+     * @param[in]  input          Input tensor. Data type supported: F32/F16/BFLOAT16.
+     * @param[in]  gamma          Per-channel scale tensor, nullptr to use the gamma of @p LayerNorm_info.
+     *                            Data type supported: Same as @p input.
+     * @param[in]  beta           Per-channel offset tensor, nullptr to use the beta of @p LayerNorm_info.
+     *                            Data type supported: Same as @p input.
+     * @param[out] output         Output tensor. Data type supported: Same as @p input.
+     * @param[in]  LayerNorm_info Layer normalization information.
      */
-    void configure(const ITensor *input, ITensor *output, const LayerNormLayerInfo& LayerNorm_info);
+    void configure(const ITensor *input,
+                   const ITensor *gamma,
+                   const ITensor *beta,
+                   ITensor       *output,
+                   const LayerNormLayerInfo &LayerNorm_info);
     /** Static function to check if given info will lead to a valid configuration of @ref NELayerNormLayer
      *
-     * @param[in] input     First input tensor info. Data types supported: F32.
-     * @param[in] output Output tensor info. Data type supported: F32.
+     * Similar to @ref NELayerNormLayer::configure()
      *
      * @return a status
      */
-    static Status validate(const ITensor *input, ITensor *output, const LayerNormLayerInfo& LayerNorm_info);
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           const LayerNormLayerInfo &LayerNorm_info);
 
     // Inherited methods overridden
     void run() override;
@@ -4,6 +4,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 
 #include <memory>
 
@@ -18,7 +20,7 @@ class NELinearLayer : public IFunction
 {
 public:
     /** Constructor */
-    NELinearLayer();
+    NELinearLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NELinearLayer(const NELinearLayer &) = delete;
     /** Prevent instances of this class from being moved (As this class contains non movable objects) */
@@ -40,14 +42,17 @@ public:
      * |:--------------|:------------|
      * |F32            |F32          |
      *
-     * @param[in]  input1 First tensor input. Data type supported: F32.
-     * @param[out] output Output tensor. Data type supported: F32.
+     * @param[in]  input1      First tensor input. Data type supported: F16/F32.
+     * @param[in]  weight      Weights tensor, shape [K, N]. Data type supported: Same as @p input1.
+     * @param[in]  bias        Bias tensor, shape [N]. Data type supported: Same as @p input1.
+     * @param[out] output      Output tensor. Data type supported: Same as @p input1.
+     * @param[in]  linear_info Linear layer information, its activation is fused into the output of the projection
      */
     void configure(const ITensor *input1, const ITensor *weight, const ITensor *bias, ITensor *output, const LinearLayerInfo& linear_info);
     /** Static function to check if given info will lead to a valid configuration of @ref NELinearLayer
      *
-     * @param[in] input1 First input tensor info. Data types supported: F32.
-     * @param[in] output Output tensor info. Data type supported: F32.
+     * @param[in] input1 First input tensor info. Data types supported: F16/F32.
+     * @param[in] output Output tensor info. Data type supported: Same as @p input1.
      *
      * @return a status
      */
@@ -55,6 +60,7 @@ public:
 
     // Inherited methods overridden
     void run() override;
+    void prepare() override;
 
 private:
     struct Impl;
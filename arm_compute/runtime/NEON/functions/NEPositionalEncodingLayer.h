@@ -3,6 +3,7 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
 
 #include <memory>
 
@@ -12,11 +13,15 @@ namespace arm_compute
 class ITensor;
 class ITensorInfo;
 
+/** Add the sinusoidal positional encoding to a sequence of embeddings
+ *
+ * The encoding table is computed once, on the first run, and kept for the lifetime of the function.
+ */
 class NEPositionalEncodingLayer : public IFunction
 {
 public:
     /** Default Constructor */
-    NEPositionalEncodingLayer();
+    NEPositionalEncodingLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Default Destructor */
     ~NEPositionalEncodingLayer();
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -24,10 +29,6 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEPositionalEncodingLayer &operator=(const NEPositionalEncodingLayer &) = delete;
 
-
-    /** TODO: Move able ?*/
-
-    
     /** Set the input and output tensor.
      *
      * Valid data layouts:
@@ -36,30 +37,29 @@ public:
      * Valid data type configurations:
      * |src            |dst            |
      * |:--------------|:--------------|
-     * |TBA            |TBA            |
-     * |TBA            |TBA            |
+     * |F32            |F32            |
+     * |F16            |F16            |
      *
-     * @param[in]  seq_len  Input token sequence length. Data types supported: TBA
-     * @param[in]  d_model  Model dimension. Data types supported: TBA
-     * @param[out] output   Output tensor, shape (seq_len,d_model). Data type supported: TBA
+     * @param[in]  input  Input embeddings, shape [d_model, seq, batch]. Data types supported: F32/F16
+     * @param[out] output Output tensor. Data type supported: Same as @p input
+     * @param[in]  info   Positional encoding layer information.
      */
-    void configure(const unsigned int seq_len, const unsigned int d_model, ITensor *output);
+    void configure(const ITensor *input, ITensor *output, const PositionalEncodingLayerInfo &info);
     /** Static function to check if given info will lead to a valid configuration of @ref NEPositionalEncodingLayer
      *
-     * @param[in] input  Source tensor info. Data types supported: TBA
-     * @param[in] alpha  Source alpha tensor info. Data types supported: same of @p input.
-     * @param[in] output Destination tensor info. Data type supported: same as @p input
+     * Similar to @ref NEPositionalEncodingLayer::configure()
      *
      * @return a status
      */
-    static Status validate(const unsigned int seq_len, const unsigned int d_model, ITensor *output);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const PositionalEncodingLayerInfo &info);
 
     // Inherited methods overridden:
     void run() override;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
 };
 } // namespace arm_compute
 
-#endif /* ARM_COMPUTE_NEPOSITIONALENCODINGLAYER_H */
\ No newline at end of file
+#endif /* ARM_COMPUTE_NEPOSITIONALENCODINGLAYER_H */
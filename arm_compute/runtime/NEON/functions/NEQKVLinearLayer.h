@@ -0,0 +1,91 @@
+#ifndef ARM_COMPUTE_QKV_LINEAR_LAYER_H
+#define ARM_COMPUTE_QKV_LINEAR_LAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Perform the query, key and value projections of an attention layer as a single GEMM */
+class NEQKVLinearLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEQKVLinearLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEQKVLinearLayer(const NEQKVLinearLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEQKVLinearLayer(NEQKVLinearLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEQKVLinearLayer &operator=(const NEQKVLinearLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEQKVLinearLayer &operator=(NEQKVLinearLayer &&) = delete;
+    /** Destructor */
+    ~NEQKVLinearLayer();
+
+    /** Initialise the kernel's inputs and output
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |weights/biases |dst          |
+     * |:--------------|:--------------|:------------|
+     * |F32            |F32            |F32          |
+     *
+     * @param[in]  input         Input tensor, shape [d_model, seq]. Data type supported: F16/F32.
+     * @param[in]  query_weights Query weights, shape [d_model, d_model]. Data type supported: Same as @p input.
+     * @param[in]  query_bias    Query bias, shape [d_model]. Data type supported: Same as @p input.
+     * @param[in]  key_weights   Key weights. Shape and data type supported: Same as @p query_weights.
+     * @param[in]  key_bias      Key bias. Shape and data type supported: Same as @p query_bias.
+     * @param[in]  value_weights Value weights. Shape and data type supported: Same as @p query_weights.
+     * @param[in]  value_bias    Value bias. Shape and data type supported: Same as @p query_bias.
+     * @param[out] output        Output tensor holding [query | key | value] along X, shape [3 * d_model, seq].
+     *                           Data type supported: Same as @p input.
+     * @param[in]  linear_info   Linear layer information.
+     */
+    void configure(const ITensor         *input,
+                   const ITensor         *query_weights,
+                   const ITensor         *query_bias,
+                   const ITensor         *key_weights,
+                   const ITensor         *key_bias,
+                   const ITensor         *value_weights,
+                   const ITensor         *value_bias,
+                   ITensor               *output,
+                   const LinearLayerInfo &linear_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEQKVLinearLayer
+     *
+     * Similar to @ref NEQKVLinearLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *input,
+                           const ITensorInfo     *query_weights,
+                           const ITensorInfo     *query_bias,
+                           const ITensorInfo     *key_weights,
+                           const ITensorInfo     *key_bias,
+                           const ITensorInfo     *value_weights,
+                           const ITensorInfo     *value_bias,
+                           const ITensorInfo     *output,
+                           const LinearLayerInfo &linear_info);
+
+    // Inherited methods overridden
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_QKV_LINEAR_LAYER_H */
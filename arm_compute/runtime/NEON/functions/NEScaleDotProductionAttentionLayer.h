@@ -28,19 +28,45 @@ public:
 
     /** Set the input and output tensor.
      * 
-     * @param[in]  query      Input tenser of Attention Query, Data type supported: F32
-     * @param[in]  key        Input tensor of Attention Key, Data type supported: F32
-     * @param[in]  value      Input tenser of Attention Value, Data type supported: F32
-     * @param[out] output     Output tensor, shape (d_model,d_model). Data type supported: F32
+     * @param[in]  query      Input tenser of Attention Query, Data type supported: F16/F32
+     * @param[in]  key        Input tensor of Attention Key, Data type supported: Same as @p query
+     * @param[in]  value      Input tenser of Attention Value, Data type supported: Same as @p query
+     * @param[in]  mask       Attention mask, nullptr when info.mask_type() is @ref AttentionMaskType::NONE.
+     *                        Additive masks: shape [seq_k, 1 or seq_q, 1 or batch], Data type supported: Same as @p query.
+     *                        Valid-length masks: shape [batch], Data type supported: S32.
+     * @param[out] output     Output tensor, shape (d_model,d_model). Data type supported: Same as @p query
+     * @param[in]  info       Scale dot production attention layer information.
      */
-    void configure(const ITensor *query,const ITensor *key,const ITensor *value, ITensor *output, const ScaleDotProductionAttentionLayerInfo& info);
+    void configure(const ITensor *query,const ITensor *key,const ITensor *value, const ITensor *mask, ITensor *output, const ScaleDotProductionAttentionLayerInfo& info);
     /** Static function to check if given info will lead to a valid configuration of @ref NEScaleDotProductionAttentionLayer
      *
-     * @param[in] output Destination tensor info. Data type supported: same as @p input
+     * Head depths above 256 run the unfused fallback, which only handles a single sequence with no or an additive mask.
+     *
+     * @param[in] query  Query tensor info. Data type supported: F16/F32
+     * @param[in] key    Key tensor info. Data type supported: Same as @p query
+     * @param[in] value  Value tensor info. Data type supported: Same as @p query
+     * @param[in] mask   Attention mask tensor info, nullptr when info.mask_type() is @ref AttentionMaskType::NONE
+     * @param[in] output Destination tensor info. Data type supported: Same as @p query
+     * @param[in] info   Scale dot production attention layer information.
      *
      * @return a status
      */
-    static Status validate(ITensor *output);
+    static Status validate(const ITensorInfo *query,
+                           const ITensorInfo *key,
+                           const ITensorInfo *value,
+                           const ITensorInfo *mask,
+                           const ITensorInfo *output,
+                           const ScaleDotProductionAttentionLayerInfo &info);
+    /** Start a new sequence when decoding with a key/value cache (info.max_cache_len() greater than zero)
+     *
+     * Each run appends one token to the caches, this drops every cached token.
+     */
+    void reset_kv_cache();
+    /** Number of tokens held in the key/value caches, the position the next run writes its token at
+     *
+     * Running once the caches hold info.max_cache_len() tokens is an error.
+     */
+    unsigned int kv_cache_length() const;
 
     // Inherited methods overridden:
     void run() override;
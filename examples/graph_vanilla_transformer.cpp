@@ -39,9 +39,14 @@ class GraphVanillaTransformerExample : public Example
 {
     public:
     GraphVanillaTransformerExample()
-        : cmd_parser(), common_opts(cmd_parser), common_params(), graph(0, "Vanilla_Transformer")
+        : cmd_parser(), common_opts(cmd_parser), common_params(), model_num_layers(nullptr), graph(0, "Vanilla_Transformer")
     {
+        model_num_layers = cmd_parser.add_option<SimpleOption<unsigned int>>("layers", 1);
+        model_num_layers->set_help("Number of encoder blocks, read from the layer_0 to layer_<layers - 1> directories of the data path.");
     }
+    GraphVanillaTransformerExample(const GraphVanillaTransformerExample &) = delete;
+    GraphVanillaTransformerExample &operator=(const GraphVanillaTransformerExample &) = delete;
+    ~GraphVanillaTransformerExample() override                                        = default;
     bool do_setup(int argc, char **argv) override
     {
         // Parse arguments
@@ -58,10 +63,16 @@ class GraphVanillaTransformerExample : public Example
             return false;
         }
 
+        // Number of encoder blocks
+        const unsigned int num_layers = model_num_layers->value();
+        ARM_COMPUTE_EXIT_ON_MSG(num_layers == 0U, "At least one encoder block is needed");
+
         // Print parameter values
         std::cout << common_params << std::endl;
+        std::cout << "Encoder blocks: " << num_layers << std::endl;
 
-        // Get trainable parameters data path
+        // Get trainable parameters data path, either a directory of .npy files or a single model packed from it
+        // by scripts/pack_npy_model.py
         std::string data_path = common_params.data_path;
 
         // Model parameters
@@ -72,6 +83,8 @@ class GraphVanillaTransformerExample : public Example
         constexpr unsigned int h          = 12U;    // Parallel attention (Heads)
         constexpr float        eps        = 1e-12;  // Layer normalization eplision
         constexpr unsigned int d_ff       = 3072U;  // Dim feedforward
+        constexpr unsigned int seq_len    = 128U;   // Max input token sequence length, shorter texts are padded
+        constexpr unsigned int batch      = 1U;     // Sequences per inference, one per line of the text file
         /*constexpr unsigned int d_q         = 64U;      // Dim query, 512U/8U
         constexpr unsigned int d_k           = 64U;      // Dim key, 512U/8U
         constexpr unsigned int d_v           = 64U;      // Dim value, 512U/8U
@@ -85,13 +98,19 @@ class GraphVanillaTransformerExample : public Example
         // Compute library best operate on NHWC(default) layout
         //const auto operation_layout = common_params.data_layout;
 
-        // Create input tensor
-        const TensorShape src_tensor = TensorShape(7U);
+        static_assert(seq_len <= d_position, "Sequence length exceeds the pretrained positional encoding");
+
+        // Create input tensor, token ids [seq, batch]
+        const TensorShape src_tensor = TensorShape(seq_len, batch);
 
         // Data layout
         const DataLayout operation_layout = DataLayout::NCHW;
 
-        TensorDescriptor input_descriptor = TensorDescriptor(src_tensor, common_params.data_type);
+        // Quantized types only select the dynamically quantized projections, the graph itself stays in float.
+        // With F16 every layer runs in half precision, the reductions still accumulate in F32.
+        const DataType   model_data_type =
+            is_data_type_quantized(common_params.data_type) ? DataType::F32 : common_params.data_type;
+        TensorDescriptor input_descriptor = TensorDescriptor(src_tensor, DataType::U32);
 
         // Set graph hints
         graph << common_params.target << common_params.fast_math_hint;
@@ -110,13 +129,32 @@ class GraphVanillaTransformerExample : public Example
                                                    d_segemnt,
                                                    d_position,
                                                    true /*Use pretrained positional encoding*/,
-                                                   ConvertPolicy::SATURATE),
+                                                   ConvertPolicy::SATURATE,
+                                                   model_data_type),
                                 get_weights_accessor(data_path, "/token_embedding.npy", operation_layout),
                                 get_weights_accessor(data_path, "/segment_embedding.npy", operation_layout),
                                 get_weights_accessor(data_path, "/positional_embedding.npy", operation_layout))
                      .set_name("tkemb1");
 
-        add_encoder_block(data_path," /layer_0" /*Layer Parameter Dir*/, d_model, h, eps, d_ff);
+        // Token count of every sequence: attention skips the padding, so any text up to seq_len runs on the same graph.
+        // Only the attention shortens its work to the valid tokens: the embedding, projections, feed-forward and
+        // layer normalizations still run over all seq_len rows, so a short text costs as much as a full one.
+        // Rebuild the graph with a smaller seq_len when the inputs are known to be short.
+        SubStream valid_lengths(graph);
+        valid_lengths << InputLayer(TensorDescriptor(TensorShape(batch), DataType::S32),
+                                    get_valid_length_accessor(common_params, seq_len))
+                             .set_name("valid_len");
+
+        // Every encoder block reads its parameters from its own layer_<index> directory of the data path
+        graph << TransformerEncoderLayer(
+                     num_layers, MultiHeadAttentionLayerInfo(d_model, h, AttentionMaskType::VALID_LENGTH), d_ff, eps,
+                     [data_path](unsigned int layer, const std::string &parameter)
+                     {
+                         return get_weights_accessor(data_path, "/layer_" + support::cpp11::to_string(layer) + "/" +
+                                                                    parameter + ".npy");
+                     },
+                     SubStream(valid_lengths))
+                     .set_name("encoder");
 
         graph << OutputLayer(get_output_accessor(common_params)).set_name("out1");
 
@@ -130,6 +168,9 @@ class GraphVanillaTransformerExample : public Example
         config.tuner_file  = common_params.tuner_file;
         config.mlgo_file   = common_params.mlgo_file;
 
+        config.use_synthetic_type = is_data_type_quantized(common_params.data_type);
+        config.synthetic_type     = common_params.data_type;
+
         graph.finalize(common_params.target, config);
 
         return true;
@@ -142,50 +183,11 @@ class GraphVanillaTransformerExample : public Example
     }
 
     private:
-    CommandLineParser  cmd_parser;
-    CommonGraphOptions common_opts;
-    CommonGraphParams  common_params;
-    Stream             graph;
-
-    void add_encoder_block(std::string  data_path,std::string  layer_path,
-                           unsigned int d_model, unsigned int h, float eps, unsigned int d_ff)
-    {
-        SubStream without_attention(graph);
-        SubStream with_attention(graph);
-
-        with_attention
-            /* Self Attention */
-            << MultiHeadLinearLayer(LinearLayerInfo(d_model), get_weights_accessor(data_path+layer_path, "/query_weight.npy"),
-                                    get_weights_accessor(data_path+layer_path, "/query_bias.npy"),
-                                    get_weights_accessor(data_path+layer_path, "/key_weight.npy"),
-                                    get_weights_accessor(data_path+layer_path, "/key_bias.npy"),
-                                    get_weights_accessor(data_path+layer_path, "/value_weight.npy"),
-                                    get_weights_accessor(data_path+layer_path, "/value_bias.npy"))
-            << MultiHeadAttentionLayer(MultiHeadAttentionLayerInfo(d_model, h)).set_name("mha1");
-
-        graph << EltwiseLayer(std::move(with_attention), std::move(without_attention), EltwiseOperation::Add).set_name("add_4_norm_attention");
-
-        /* Self output */
-        graph << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps));
-
-        SubStream without_ff(graph);
-        SubStream with_ff(graph);
-        /* Self Intermediate(Feed Forward)*/
-        with_ff << LinearLayer(LinearLayerInfo(d_ff, TensorShape(d_model, d_ff) /*weight*/,
-                                               TensorShape(d_ff) /*bias*/),
-                               get_weights_accessor(data_path+layer_path, "/ff_weight_0.npy"),
-                               get_weights_accessor(data_path+layer_path, "/ff_bias_0.npy"))
-                << ActivationLayer(ActivationLayerInfo(ActivationFunction::GELU))
-                << LinearLayer(LinearLayerInfo(d_model, TensorShape(d_ff, d_model) /*weight*/,
-                                               TensorShape(d_model) /*bias*/),
-                               get_weights_accessor(data_path+layer_path, "/ff_weight_1.npy"),
-                               get_weights_accessor(data_path+layer_path, "/ff_bias_1.npy"));
-
-        graph << EltwiseLayer(std::move(with_ff), std::move(without_ff), EltwiseOperation::Add).set_name("add_4_norm_ff");
-
-        /* Output*/
-        graph << LayerNormLayer(LayerNormLayerInfo(0 /*Window::DimX*/, eps));
-    }
+    CommandLineParser           cmd_parser;
+    CommonGraphOptions          common_opts;
+    CommonGraphParams           common_params;
+    SimpleOption<unsigned int> *model_num_layers{nullptr};
+    Stream                      graph;
 };
 
 /** Main program for Vanilla Transformer
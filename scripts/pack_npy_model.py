@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+"""Packs a directory of NumPy arrays into a single model file that the graph examples map in one go.
+Usage:
+    python pack_npy_model.py -d path_to_npy_directory -o model.aclpack [--dtype float16]
+
+Every .npy file under the directory becomes one tensor named after its path relative to the directory, for
+example layer_0/query_weight.npy. Passing the packed file as --data to an example therefore resolves the same
+paths as the directory did (see utils/PackedModel.h for the file layout).
+
+The data of each tensor is stored exactly as NPYLoader copies a C-ordered file, dimensions in the order of the
+NPY header, and starts on a 64-byte boundary so that CPU tensors can use the mapped file as their memory.
+Fortran-ordered arrays are stored in C order.
+"""
+import argparse
+import os
+import struct
+import numpy as np
+
+MAGIC = b"ACLPACK1"
+ALIGNMENT = 64
+WEIGHT_FORMAT_UNSPECIFIED = 0x1
+
+def align(offset):
+    return (offset + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT
+
+def index_entry(name, array, offset):
+    name = name.encode("utf-8")
+    typestring = array.dtype.str.encode("ascii")
+    entry  = struct.pack("<I", len(name)) + name
+    entry += struct.pack("<B", len(typestring)) + typestring
+    entry += struct.pack("<II", WEIGHT_FORMAT_UNSPECIFIED, array.ndim)
+    entry += struct.pack("<%dQ" % array.ndim, *array.shape)
+    entry += struct.pack("<QQ", offset, array.nbytes)
+    return entry
+
+if __name__ == "__main__":
+    # Parse arguments
+    parser = argparse.ArgumentParser('Pack NumPy arrays into a single model file')
+    parser.add_argument('-d', dest='npyDir', type=str, required=True, help='Directory holding the .npy files')
+    parser.add_argument('-o', dest='outFile', type=str, required=True, help='Packed model to create')
+    parser.add_argument('--dtype', dest='dtype', type=str, default=None, help='Convert floating point tensors to this type (e.g. float16)')
+    args = parser.parse_args()
+
+    tensors = []
+    for root, _, files in os.walk(args.npyDir):
+        for f in sorted(files):
+            if f.endswith(".npy"):
+                path = os.path.join(root, f)
+                array = np.ascontiguousarray(np.load(path))
+                if args.dtype is not None and np.issubdtype(array.dtype, np.floating):
+                    array = array.astype(args.dtype)
+                name = os.path.relpath(path, args.npyDir).replace(os.sep, "/")
+                tensors.append((name, array))
+    tensors.sort(key=lambda t: t[0])
+
+    # The offsets do not change the size of the index, so it can be sized with placeholders first
+    header_size = len(MAGIC) + 8 + sum(len(index_entry(name, array, 0)) for name, array in tensors)
+    offsets = []
+    offset = align(header_size)
+    for _, array in tensors:
+        offsets.append(offset)
+        offset = align(offset + array.nbytes)
+
+    with open(args.outFile, "wb") as out:
+        out.write(MAGIC)
+        out.write(struct.pack("<II", len(tensors), ALIGNMENT))
+        for (name, array), offset in zip(tensors, offsets):
+            out.write(index_entry(name, array, offset))
+        for (name, array), offset in zip(tensors, offsets):
+            out.write(b"\0" * (offset - out.tell()))
+            out.write(array.tobytes())
+            print("Packed %s %s %s" % (name, array.dtype, array.shape))
@@ -122,6 +122,28 @@ float32x4_t vlogq_f32(float32x4_t x);
  */
 float32x4_t vtanhq_f32(float32x4_t val);
 
+/** Calculate the Gaussian error linear unit
+ *
+ * gelu(x) = x * 1/2 * (1 + erf(x / sqrt(2)))
+ *
+ * @note erf is evaluated with a rational polynomial (absolute error below 1.5e-7) instead of a table lookup.
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated GELU.
+ */
+float32x4_t vgeluq_f32(float32x4_t x);
+
+/** Calculate the tanh approximation of the Gaussian error linear unit
+ *
+ * gelu(x) = x * 1/2 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated GELU.
+ */
+float32x4_t vgelu_tanhq_f32(float32x4_t x);
+
 /** Calculate n power of a number.
  *
  * pow(x,n) = e^(n*log(x))
@@ -324,6 +346,22 @@ float16x8_t vexpq_f16(float16x8_t x);
  */
 float16x8_t verfq_f16(float16x8_t x);
 
+/** Calculate the Gaussian error linear unit
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated GELU.
+ */
+float16x8_t vgeluq_f16(float16x8_t x);
+
+/** Calculate the tanh approximation of the Gaussian error linear unit
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated GELU.
+ */
+float16x8_t vgelu_tanhq_f16(float16x8_t x);
+
 /** Calculate n power of a number.
  *
  * pow(x,n) = e^(n*log(x))
@@ -325,6 +325,53 @@ inline float32x4_t vtanhq_f32(float32x4_t val)
     return tanh;
 }
 
+inline float32x4_t vgeluq_f32(float32x4_t x)
+{
+    // Abramowitz-Stegun 7.1.26 for erf(z), z = |x| / sqrt(2), absolute error below 1.5e-7:
+    //   erf(z) = 1 - t * (a1 + t * (a2 + t * (a3 + t * (a4 + t * a5)))) * e^(-z^2), t = 1 / (1 + p * z)
+    const float32x4_t const_p       = vdupq_n_f32(0.3275911f);
+    const float32x4_t const_a1      = vdupq_n_f32(0.254829592f);
+    const float32x4_t const_a2      = vdupq_n_f32(-0.284496736f);
+    const float32x4_t const_a3      = vdupq_n_f32(1.421413741f);
+    const float32x4_t const_a4      = vdupq_n_f32(-1.453152027f);
+    const float32x4_t const_a5      = vdupq_n_f32(1.061405429f);
+    const float32x4_t const_1       = vdupq_n_f32(1.f);
+    const float32x4_t const_inv_2   = vdupq_n_f32(0.5f);
+    const float32x4_t const_inv_sq2 = vdupq_n_f32(0.70710678118f);
+    const float32x4_t const_max_z   = vdupq_n_f32(10.f); // erf(z) rounds to 1 in F32 well before this
+
+    const float32x4_t z = vminq_f32(vmulq_f32(vabsq_f32(x), const_inv_sq2), const_max_z);
+    const float32x4_t t = vinvq_f32(prefer_vfmaq_f32(const_1, const_p, z));
+
+    float32x4_t poly = prefer_vfmaq_f32(const_a4, const_a5, t);
+    poly             = prefer_vfmaq_f32(const_a3, poly, t);
+    poly             = prefer_vfmaq_f32(const_a2, poly, t);
+    poly             = prefer_vfmaq_f32(const_a1, poly, t);
+    poly             = vmulq_f32(poly, t);
+
+    // 1 - erf(z) for the magnitude, the sign of x then selects Phi(x) = (1 + erf) / 2 or (1 - erf) / 2
+    const float32x4_t erfc_z = vmulq_f32(poly, vexpq_f32(vnegq_f32(vmulq_f32(z, z))));
+    const float32x4_t half_c = vmulq_f32(const_inv_2, erfc_z);
+    const float32x4_t cdf    = vbslq_f32(vcltq_f32(x, vdupq_n_f32(0.f)), half_c, vsubq_f32(const_1, half_c));
+
+    return vmulq_f32(x, cdf);
+}
+
+inline float32x4_t vgelu_tanhq_f32(float32x4_t x)
+{
+    // 0.5 * x * (1 + tanh(u)) == x / (1 + e^(-2u)), u = sqrt(2 / pi) * (x + 0.044715 * x^3)
+    const float32x4_t const_1      = vdupq_n_f32(1.f);
+    const float32x4_t const_m2k0   = vdupq_n_f32(-1.595769122f); // -2 * sqrt(2 / pi)
+    const float32x4_t const_k1     = vdupq_n_f32(0.044715f);
+    const float32x4_t const_max_ex = vdupq_n_f32(80.f); // Keeps e^(-2u) finite so its reciprocal stays well defined
+
+    const float32x4_t x2    = vmulq_f32(x, x);
+    const float32x4_t inner = vmulq_f32(x, prefer_vfmaq_f32(const_1, const_k1, x2));
+    const float32x4_t arg   = vminq_f32(vmaxq_f32(vmulq_f32(const_m2k0, inner), vnegq_f32(const_max_ex)), const_max_ex);
+
+    return vmulq_f32(x, vinvq_f32(vaddq_f32(const_1, vexpq_f32(arg))));
+}
+
 inline float32x4_t vpowq_f32(float32x4_t val, float32x4_t n)
 {
     return vexpq_f32(vmulq_f32(n, vlogq_f32(val)));
@@ -669,6 +716,25 @@ inline float16x8_t verfq_f16(float16x8_t x)
 }
 #endif // #ifdef __aarch64__
 
+inline float16x8_t vgeluq_f16(float16x8_t x)
+{
+    const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
+    const float32x4_t x_low  = vcvt_f32_f16(vget_low_f16(x));
+
+    const float16x8_t res = vcombine_f16(vcvt_f16_f32(vgeluq_f32(x_low)), vcvt_f16_f32(vgeluq_f32(x_high)));
+    return res;
+}
+
+inline float16x8_t vgelu_tanhq_f16(float16x8_t x)
+{
+    const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
+    const float32x4_t x_low  = vcvt_f32_f16(vget_low_f16(x));
+
+    const float16x8_t res =
+        vcombine_f16(vcvt_f16_f32(vgelu_tanhq_f32(x_low)), vcvt_f16_f32(vgelu_tanhq_f32(x_high)));
+    return res;
+}
+
 inline float16x8_t vlogq_f16(float16x8_t x)
 {
     const float32x4_t x_high = vcvt_f32_f16(vget_high_f16(x));
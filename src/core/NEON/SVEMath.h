@@ -87,6 +87,28 @@ svfloat32_t svtanh_f32_z(svbool_t pg, svfloat32_t val);
  */
 svfloat16_t svtanh_f16_z(svbool_t pg, svfloat16_t val);
 
+/** Calculate the Gaussian error linear unit
+ *
+ * gelu(x) = x * 1/2 * (1 + erf(x / sqrt(2)))
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F32 format.
+ *
+ * @return The calculated GELU.
+ */
+svfloat32_t svgelu_f32_z(svbool_t pg, svfloat32_t x);
+
+/** Calculate the tanh approximation of the Gaussian error linear unit
+ *
+ * gelu(x) = x * 1/2 * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F32 format.
+ *
+ * @return The calculated GELU.
+ */
+svfloat32_t svgelu_tanh_f32_z(svbool_t pg, svfloat32_t x);
+
 /** Calculate exponential
  *
  * @param[in] pg Input predicate.
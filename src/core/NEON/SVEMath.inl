@@ -222,6 +222,53 @@ inline svfloat16_t svtanh_f16_z(svbool_t pg, svfloat16_t val)
     return tanh;
 }
 
+inline svfloat32_t svgelu_f32_z(svbool_t pg, svfloat32_t x)
+{
+    // Same Abramowitz-Stegun 7.1.26 polynomial for erf as vgeluq_f32
+    const svfloat32_t CONST_P       = svdup_n_f32(0.3275911f);
+    const svfloat32_t CONST_A1      = svdup_n_f32(0.254829592f);
+    const svfloat32_t CONST_A2      = svdup_n_f32(-0.284496736f);
+    const svfloat32_t CONST_A3      = svdup_n_f32(1.421413741f);
+    const svfloat32_t CONST_A4      = svdup_n_f32(-1.453152027f);
+    const svfloat32_t CONST_A5      = svdup_n_f32(1.061405429f);
+    const svfloat32_t CONST_1       = svdup_n_f32(1.f);
+    const svfloat32_t CONST_INV_2   = svdup_n_f32(0.5f);
+    const svfloat32_t CONST_INV_SQ2 = svdup_n_f32(0.70710678118f);
+    const svfloat32_t CONST_MAX_Z   = svdup_n_f32(10.f);
+
+    const svfloat32_t z = svmin_f32_z(pg, svmul_f32_z(pg, svabs_f32_z(pg, x), CONST_INV_SQ2), CONST_MAX_Z);
+    const svfloat32_t t = svdiv_f32_z(pg, CONST_1, svmla_f32_z(pg, CONST_1, CONST_P, z));
+
+    svfloat32_t poly = svmla_f32_z(pg, CONST_A4, CONST_A5, t);
+    poly             = svmla_f32_z(pg, CONST_A3, poly, t);
+    poly             = svmla_f32_z(pg, CONST_A2, poly, t);
+    poly             = svmla_f32_z(pg, CONST_A1, poly, t);
+    poly             = svmul_f32_z(pg, poly, t);
+
+    const svfloat32_t erfc_z = svmul_f32_z(pg, poly, svexp_f32_z(pg, svneg_f32_z(pg, svmul_f32_z(pg, z, z))));
+    const svfloat32_t half_c = svmul_f32_z(pg, CONST_INV_2, erfc_z);
+    const svfloat32_t cdf =
+        svsel_f32(svcmplt_f32(pg, x, svdup_n_f32(0.f)), half_c, svsub_f32_z(pg, CONST_1, half_c));
+
+    return svmul_f32_z(pg, x, cdf);
+}
+
+inline svfloat32_t svgelu_tanh_f32_z(svbool_t pg, svfloat32_t x)
+{
+    const svfloat32_t CONST_1      = svdup_n_f32(1.f);
+    const svfloat32_t CONST_M2K0   = svdup_n_f32(-1.595769122f); // -2 * sqrt(2 / pi)
+    const svfloat32_t CONST_K1     = svdup_n_f32(0.044715f);
+    const svfloat32_t CONST_MIN_EX = svdup_n_f32(-80.f);
+    const svfloat32_t CONST_MAX_EX = svdup_n_f32(80.f);
+
+    const svfloat32_t x2    = svmul_f32_z(pg, x, x);
+    const svfloat32_t inner = svmul_f32_z(pg, x, svmla_f32_z(pg, CONST_1, CONST_K1, x2));
+    const svfloat32_t arg =
+        svmin_f32_z(pg, svmax_f32_z(pg, svmul_f32_z(pg, CONST_M2K0, inner), CONST_MIN_EX), CONST_MAX_EX);
+
+    return svdiv_f32_z(pg, x, svadd_f32_z(pg, CONST_1, svexp_f32_z(pg, arg)));
+}
+
 inline svfloat32_t svlog_f32_z(svbool_t pg, svfloat32_t x)
 {
     /** Logarithm polynomial coefficients */
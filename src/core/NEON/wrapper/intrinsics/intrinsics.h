@@ -42,6 +42,7 @@
 #include "src/core/NEON/wrapper/intrinsics/erf.h"
 #include "src/core/NEON/wrapper/intrinsics/exp.h"
 #include "src/core/NEON/wrapper/intrinsics/ext.h"
+#include "src/core/NEON/wrapper/intrinsics/gelu.h"
 #include "src/core/NEON/wrapper/intrinsics/gethigh.h"
 #include "src/core/NEON/wrapper/intrinsics/getlane.h"
 #include "src/core/NEON/wrapper/intrinsics/getlow.h"
@@ -24,13 +24,43 @@
 
 #include "src/core/helpers/LUTManager.h"
 
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <cmath>
+
 namespace arm_compute
 {
 #ifdef __aarch64__
 namespace
 {
 
-void init_lut_fp16(ActivationLayerInfo::LookupTable65536 *lut)
+float activation_fp32(ActivationLayerInfo::ActivationFunction act, float x)
+{
+    switch (act)
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return 1.f / (1.f + std::exp(-x));
+        case ActivationLayerInfo::ActivationFunction::GELU:
+            if (std::isinf(x))
+            {
+                // x * cdf(x) is inf * 0 for -inf
+                return std::max(x, 0.f);
+            }
+            return x * 0.5f * (1.f + std::erf(x / 1.41421356237f));
+        case ActivationLayerInfo::ActivationFunction::GELU_TANH:
+            if (std::isinf(x))
+            {
+                return std::max(x, 0.f);
+            }
+            return x * 0.5f * (1.f + std::tanh(0.7978845608f * x * (1.f + 0.044715f * x * x)));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+            return 0.f;
+    }
+}
+
+void init_lut_fp16(ActivationLayerInfo::ActivationFunction act, ActivationLayerInfo::LookupTable65536 *lut)
 {
     union Element
     {
@@ -38,9 +68,10 @@ void init_lut_fp16(ActivationLayerInfo::LookupTable65536 *lut)
         float16_t fp;
     } item;
     // Fill lut by iterating over all 16 bit values using the union.
+    // Every entry is evaluated in F32 and rounded once, so the table is as accurate as F16 allows.
     while (true)
     {
-        (*lut)[item.i] = 1.f / (1.f + std::exp(-item.fp));
+        (*lut)[item.i] = activation_fp32(act, static_cast<float>(item.fp));
         if (item.i == 65535)
             break;
         item.i++;
@@ -62,7 +93,7 @@ std::shared_ptr<ActivationLayerInfo::LookupTable65536> LUTManager::get_lut_table
         // Not found, or pointer not valid
         // We do not use make_shared to prevent the weak_ptr keeping the control block alive
         std::shared_ptr<ActivationLayerInfo::LookupTable65536> ptr(new ActivationLayerInfo::LookupTable65536);
-        init_lut_fp16(ptr.get());
+        init_lut_fp16(info.act, ptr.get());
         map_fp16[info] = ptr;
         return ptr;
     }
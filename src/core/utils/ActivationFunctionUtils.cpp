@@ -45,7 +45,8 @@ const std::string &string_from_activation_func(const ActivationFunction &act)
                                                                       {ActivationFunction::IDENTITY, "IDENTITY"},
                                                                       {ActivationFunction::HARD_SWISH, "HARD_SWISH"},
                                                                       {ActivationFunction::SWISH, "SWISH"},
-                                                                      {ActivationFunction::GELU, "GELU"}
+                                                                      {ActivationFunction::GELU, "GELU"},
+                                                                      {ActivationFunction::GELU_TANH, "GELU_TANH"}
 
     };
 
@@ -43,6 +43,13 @@ namespace kernels
 {
 namespace
 {
+/* Activations evaluated in F16 through a 65536-entry lookup table */
+bool is_fp16_lut_activation(ActivationLayerInfo::ActivationFunction f)
+{
+    return f == ActivationLayerInfo::ActivationFunction::LOGISTIC || f == ActivationLayerInfo::ActivationFunction::GELU ||
+           f == ActivationLayerInfo::ActivationFunction::GELU_TANH;
+}
+
 static const std::vector<CpuActivationKernel::ActivationKernel> available_kernels = {
 #ifdef ARM_COMPUTE_ENABLE_SVE
     {"sve2_q8_activation_lut",
@@ -86,21 +93,31 @@ static const std::vector<CpuActivationKernel::ActivationKernel> available_kernel
     {"sve_fp16_activation_lut",
      [](const ActivationDataTypeISASelectorData &data)
      {
-         return data.dt == DataType::F16 && data.isa.fp16 && data.isa.sve &&
-                data.f == ActivationLayerInfo::ActivationFunction::LOGISTIC;
+         return data.dt == DataType::F16 && data.isa.fp16 && data.isa.sve && is_fp16_lut_activation(data.f);
      },
      REGISTER_FP16_SVE(arm_compute::cpu::sve_fp16_activation_lut)},
     {"sve_fp16_activation",
      [](const ActivationDataTypeISASelectorData &data)
      {
          return data.dt == DataType::F16 && data.isa.sve && data.isa.fp16 &&
-                data.f != ActivationLayerInfo::ActivationFunction::GELU;
+                data.f != ActivationLayerInfo::ActivationFunction::GELU &&
+                data.f != ActivationLayerInfo::ActivationFunction::GELU_TANH;
      },
      REGISTER_FP16_SVE(arm_compute::cpu::sve_fp16_activation)},
     {"sve_fp32_activation",
-     [](const ActivationDataTypeISASelectorData &data)
-     { return data.dt == DataType::F32 && data.isa.sve && data.f != ActivationLayerInfo::ActivationFunction::GELU; },
+     [](const ActivationDataTypeISASelectorData &data) { return data.dt == DataType::F32 && data.isa.sve; },
      REGISTER_FP32_SVE(arm_compute::cpu::sve_fp32_activation)},
+#ifdef __aarch64__
+    {// A 16-bit table is cheaper than evaluating erf/tanh in F32 for every half
+     "neon_fp16_activation_lut",
+     [](const ActivationDataTypeISASelectorData &data)
+     {
+         return data.dt == DataType::F16 && data.isa.fp16 &&
+                (data.f == ActivationLayerInfo::ActivationFunction::GELU ||
+                 data.f == ActivationLayerInfo::ActivationFunction::GELU_TANH);
+     },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_activation_lut)},
+#endif // __aarch64__
     {"neon_fp16_activation",
      [](const ActivationDataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
      REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_activation)},
@@ -299,8 +316,7 @@ void CpuActivationKernel::configure(const ITensorInfo *src, ITensorInfo *dst, Ac
         activation_info.setLookupTable256(tmp_lut);
     }
 
-    if (src->data_type() == DataType::F16 &&
-        activation_info.activation() == ActivationLayerInfo::ActivationFunction::LOGISTIC)
+    if (src->data_type() == DataType::F16 && is_fp16_lut_activation(activation_info.activation()))
     {
         const LUTInfo info = {activation_info.activation(), src->data_type(), src->quantization_info()};
         activation_info.setLookupTable65536((lut_manager.get_lut_table(info)));
@@ -0,0 +1,122 @@
+#include "src/cpu/kernels/CpuAddLayerNormKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/CpuLayerNormKernel.h"
+#include "src/cpu/kernels/layernorm/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuAddLayerNormKernel::AddLayerNormKernel> available_kernels = {
+    {"neon_fp32_add_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_add_layer_norm)},
+    {"neon_fp16_add_layer_norm",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_add_layer_norm)},
+    {"neon_bf16_add_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16; },
+     REGISTER_BF16_NEON(arm_compute::cpu::neon_bf16_add_layer_norm)},
+};
+} // namespace
+
+void CpuAddLayerNormKernel::configure(const ITensorInfo *input1,
+                                      const ITensorInfo *input2,
+                                      const ITensorInfo *gamma,
+                                      const ITensorInfo *beta,
+                                      ITensorInfo       *output,
+                                      ITensorInfo       *sum,
+                                      LayerNormLayerInfo info)
+{
+    ARM_COMPUTE_UNUSED(input2, gamma, beta);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input1, input2, output);
+
+    // Auto initialize if empty
+    auto_init_if_empty(*output, *input1->clone());
+    if (sum != nullptr)
+    {
+        auto_init_if_empty(*sum, *input1->clone());
+    }
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(input1, input2, gamma, beta, output, sum, info));
+
+    const auto uk = CpuAddLayerNormKernel::get_implementation(
+        DataTypeISASelectorData{input1->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuAddLayerNormKernel").append("/").append(uk->name);
+
+    // A whole row is handled by a single thread
+    Window win = calculate_max_window(*input1, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuAddLayerNormKernel::validate(const ITensorInfo *input1,
+                                       const ITensorInfo *input2,
+                                       const ITensorInfo *gamma,
+                                       const ITensorInfo *beta,
+                                       const ITensorInfo *output,
+                                       const ITensorInfo *sum,
+                                       LayerNormLayerInfo info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input1, input2, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input1, input2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input1, input2);
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuLayerNormKernel::validate(input1, gamma, beta, output, info));
+
+    if (sum != nullptr && sum->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input1, sum);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input1, sum);
+    }
+
+    const auto uk = CpuAddLayerNormKernel::get_implementation(
+        DataTypeISASelectorData{input1->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+void CpuAddLayerNormKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &thread_info)
+{
+    ARM_COMPUTE_UNUSED(thread_info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src0  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *src1  = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *gamma = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *beta  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst   = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *sum   = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(src0, src1, gamma, beta, dst, sum, _info, window);
+}
+
+const char *CpuAddLayerNormKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuAddLayerNormKernel::AddLayerNormKernel> &CpuAddLayerNormKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
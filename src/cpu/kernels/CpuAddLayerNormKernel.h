@@ -0,0 +1,90 @@
+#ifndef ARM_COMPUTE_CPU_ADD_LAYER_NORM_KERNEL_H
+#define ARM_COMPUTE_CPU_ADD_LAYER_NORM_KERNEL_H
+
+#include "src/core/common/Macros.h"
+
+#include "src/core/KernelTypes.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel to perform a residual addition followed by layer normalization
+ *
+ * Computes dst = LayerNorm(src0 + src1) row by row without materialising the sum, which can optionally
+ * be written out for pre-normalization architectures.
+ */
+class CpuAddLayerNormKernel : public ICpuKernel<CpuAddLayerNormKernel>
+{
+private:
+    using AddLayerNormKernelPtr = std::add_pointer<void(const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        ITensor *,
+                                                        ITensor *,
+                                                        const LayerNormLayerInfo &,
+                                                        const Window &)>::type;
+
+public:
+    /* Default Constructor */
+    CpuAddLayerNormKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuAddLayerNormKernel);
+
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  input1 First addend. Data type supported: F32/F16/BFLOAT16.
+     * @param[in]  input2 Second addend, same shape as @p input1. Data type supported: Same as @p input1.
+     * @param[in]  gamma  (Optional) Per-channel scale tensor of shape [input1.x]. Data type supported: Same as @p input1.
+     * @param[in]  beta   (Optional) Per-channel offset tensor of shape [input1.x]. Data type supported: Same as @p input1.
+     * @param[out] output Normalized output tensor. Data type supported: Same as @p input1.
+     * @param[out] sum    (Optional) Pre-normalization sum output tensor. Data type supported: Same as @p input1.
+     * @param[in]  info   Layer normalization information. Only normalization along X is supported.
+     */
+    void configure(const ITensorInfo *input1,
+                   const ITensorInfo *input2,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *output,
+                   ITensorInfo       *sum,
+                   LayerNormLayerInfo info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuAddLayerNormKernel
+     *
+     * Similar to CpuAddLayerNormKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input1,
+                           const ITensorInfo *input2,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           const ITensorInfo *sum,
+                           LayerNormLayerInfo info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct AddLayerNormKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        AddLayerNormKernelPtr        ukernel;
+    };
+
+    static const std::vector<AddLayerNormKernel> &get_available_kernels();
+
+private:
+    LayerNormLayerInfo    _info{};
+    AddLayerNormKernelPtr _run_method{nullptr};
+    std::string           _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_ADD_LAYER_NORM_KERNEL_H */
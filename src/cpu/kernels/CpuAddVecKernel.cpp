@@ -31,6 +31,9 @@ namespace
 static const std::vector<CpuAddVecKernel::AddKernel> available_kernels = {
     {"neon_fp32_add_vec", [](const CpuAddVecKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
      REGISTER_FP32_NEON(arm_compute::cpu::add_vec_fp32_neon)},
+    {"neon_fp16_add_vec",
+     [](const CpuAddVecKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::add_vec_fp16_neon)},
     };
 
 Status
@@ -0,0 +1,120 @@
+#include "src/cpu/kernels/CpuDynamicDequantizeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/dynamic_quantize/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuDynamicDequantizeKernel::DynamicDequantizeKernel> available_kernels = {
+    {"neon_fp32_dynamic_dequantize", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_dynamic_dequantize)},
+};
+} // namespace
+
+void CpuDynamicDequantizeKernel::configure(const ITensorInfo *src,
+                                           const ITensorInfo *row_scales,
+                                           const ITensorInfo *col_scales,
+                                           const ITensorInfo *bias,
+                                           ITensorInfo       *dst)
+{
+    ARM_COMPUTE_UNUSED(row_scales, col_scales, bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, row_scales, col_scales, dst);
+
+    // Configure output tensor info.
+    auto_init_if_empty(*dst, src->clone()->set_data_type(DataType::F32).set_quantization_info(QuantizationInfo()));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, row_scales, col_scales, bias, dst));
+
+    const auto uk =
+        CpuDynamicDequantizeKernel::get_implementation(DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuDynamicDequantizeKernel").append("/").append(uk->name);
+
+    // One row per iteration, the rows are split between the threads
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuDynamicDequantizeKernel::validate(const ITensorInfo *src,
+                                            const ITensorInfo *row_scales,
+                                            const ITensorInfo *col_scales,
+                                            const ITensorInfo *bias,
+                                            const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, row_scales, col_scales, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(row_scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(col_scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(row_scales->num_dimensions() > 1 || row_scales->dimension(0) != src->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(col_scales->num_dimensions() > 1 || col_scales->dimension(0) != src->dimension(0));
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1 || bias->dimension(0) != src->dimension(0));
+    }
+
+    const auto uk =
+        CpuDynamicDequantizeKernel::get_implementation(DataTypeISASelectorData{DataType::F32, CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    return Status{};
+}
+
+void CpuDynamicDequantizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src        = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *row_scales = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *col_scales = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *bias       = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst        = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, row_scales, col_scales, bias, dst, window);
+}
+
+const char *CpuDynamicDequantizeKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuDynamicDequantizeKernel::DynamicDequantizeKernel> &
+CpuDynamicDequantizeKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,75 @@
+#ifndef ARM_COMPUTE_CPU_DYNAMIC_DEQUANTIZE_KERNEL_H
+#define ARM_COMPUTE_CPU_DYNAMIC_DEQUANTIZE_KERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel converting the 32-bit accumulators of a product of row-quantized matrices back to float
+ *
+ * Computes dst[m][n] = src[m][n] * row_scales[m] * col_scales[n] + bias[n], where the scales are the ones
+ * written by @ref CpuDynamicQuantizeKernel for the rows of the two operands.
+ */
+class CpuDynamicDequantizeKernel : public ICpuKernel<CpuDynamicDequantizeKernel>
+{
+private:
+    using DynamicDequantizeKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, const ITensor *, ITensor *, const Window &)>::type;
+
+public:
+    /** Default constructor */
+    CpuDynamicDequantizeKernel() = default;
+    /** Default destructor */
+    ~CpuDynamicDequantizeKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicDequantizeKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src        Accumulators tensor info, shape [N, M]. Data types supported: S32
+     * @param[in]  row_scales Scale of every row of the left-hand side operand, shape [M]. Data types supported: F32
+     * @param[in]  col_scales Scale of every column of the right-hand side operand, shape [N]. Data types supported: F32
+     * @param[in]  bias       (Optional) Bias tensor info, shape [N]. Can be nullptr. Data types supported: F32
+     * @param[out] dst        Destination tensor info, shape [N, M]. Data types supported: F32
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *row_scales,
+                   const ITensorInfo *col_scales,
+                   const ITensorInfo *bias,
+                   ITensorInfo       *dst);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuDynamicDequantizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *row_scales,
+                           const ITensorInfo *col_scales,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct DynamicDequantizeKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        DynamicDequantizeKernelPtr   ukernel;
+    };
+
+    static const std::vector<DynamicDequantizeKernel> &get_available_kernels();
+
+private:
+    DynamicDequantizeKernelPtr _run_method{nullptr};
+    std::string                _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_DYNAMIC_DEQUANTIZE_KERNEL_H */
@@ -0,0 +1,106 @@
+#include "src/cpu/kernels/CpuDynamicQuantizeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/dynamic_quantize/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuDynamicQuantizeKernel::DynamicQuantizeKernel> available_kernels = {
+    {"neon_fp32_dynamic_quantize", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_dynamic_quantize)},
+};
+} // namespace
+
+void CpuDynamicQuantizeKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, scales);
+
+    // The real scales live in @p scales, the destination only carries the zero offset
+    auto_init_if_empty(*dst, src->clone()->set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(
+                                 QuantizationInfo(1.f, 0)));
+    auto_init_if_empty(*scales, TensorInfo(TensorShape(src->dimension(1)), 1, DataType::F32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, dst, scales));
+
+    const auto uk =
+        CpuDynamicQuantizeKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuDynamicQuantizeKernel").append("/").append(uk->name);
+
+    // One row per iteration, the rows are split between the threads
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuDynamicQuantizeKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst, scales);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 2);
+
+    const auto uk =
+        CpuDynamicQuantizeKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->quantization_info().uniform().offset != 0, "Quantization must be symmetric");
+    }
+    if (scales->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(scales->num_dimensions() > 1 || scales->dimension(0) != src->dimension(1));
+    }
+
+    return Status{};
+}
+
+void CpuDynamicQuantizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src    = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst    = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *scales = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(src, dst, scales, window);
+}
+
+const char *CpuDynamicQuantizeKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuDynamicQuantizeKernel::DynamicQuantizeKernel> &CpuDynamicQuantizeKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
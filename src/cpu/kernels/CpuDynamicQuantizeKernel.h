@@ -0,0 +1,65 @@
+#ifndef ARM_COMPUTE_CPU_DYNAMIC_QUANTIZE_KERNEL_H
+#define ARM_COMPUTE_CPU_DYNAMIC_QUANTIZE_KERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel quantizing every row of a matrix to symmetric 8-bit with its own scale
+ *
+ * The scale of a row is max(|src|) / 127 and is computed when the kernel runs, so activations are quantized
+ * without calibration. With a zero offset the products of two such matrices need no offset correction and
+ * the row scales are applied to the 32-bit accumulators by @ref CpuDynamicDequantizeKernel.
+ */
+class CpuDynamicQuantizeKernel : public ICpuKernel<CpuDynamicQuantizeKernel>
+{
+private:
+    using DynamicQuantizeKernelPtr = std::add_pointer<void(const ITensor *, ITensor *, ITensor *, const Window &)>::type;
+
+public:
+    /** Default constructor */
+    CpuDynamicQuantizeKernel() = default;
+    /** Default destructor */
+    ~CpuDynamicQuantizeKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDynamicQuantizeKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src    Source tensor info, shape [K, M]. Data types supported: F32
+     * @param[out] dst    Destination tensor info, shape [K, M]. Data types supported: QASYMM8_SIGNED
+     * @param[out] scales Scale of every row, shape [M]. Data types supported: F32
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *scales);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuDynamicQuantizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *scales);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct DynamicQuantizeKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        DynamicQuantizeKernelPtr     ukernel;
+    };
+
+    static const std::vector<DynamicQuantizeKernel> &get_available_kernels();
+
+private:
+    DynamicQuantizeKernelPtr _run_method{nullptr};
+    std::string              _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_DYNAMIC_QUANTIZE_KERNEL_H */
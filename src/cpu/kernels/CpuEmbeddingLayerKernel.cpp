@@ -0,0 +1,169 @@
+#include "src/cpu/kernels/CpuEmbeddingLayerKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/embedding/list.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+/** Bytes of table rows each thread should gather at least, below this threading overhead dominates */
+constexpr size_t min_bytes_per_thread = 16 * 1024;
+
+static const std::vector<CpuEmbeddingLayerKernel::EmbeddingKernel> available_kernels = {
+    {"neon_fp32_embedding", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_embedding)},
+    {"neon_fp16_embedding",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_embedding)},
+};
+} // namespace
+
+void CpuEmbeddingLayerKernel::configure(const ITensorInfo        *tokens,
+                                        const ITensorInfo        *segments,
+                                        const ITensorInfo        *token_table,
+                                        const ITensorInfo        *segment_table,
+                                        const ITensorInfo        *position_table,
+                                        const ITensorInfo        *gamma,
+                                        const ITensorInfo        *beta,
+                                        ITensorInfo              *dst,
+                                        bool                      layer_norm,
+                                        const LayerNormLayerInfo &ln_info)
+{
+    ARM_COMPUTE_UNUSED(segments, segment_table, position_table, gamma, beta);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(tokens, segments, token_table, segment_table, position_table, dst);
+
+    // Ids [seq, batch] are expanded to vectors [d_model, seq, batch]
+    TensorShape dst_shape = tokens->tensor_shape();
+    dst_shape.shift_right(1);
+    dst_shape.set(0, token_table->dimension(0));
+    auto_init_if_empty(*dst, token_table->clone()->set_tensor_shape(dst_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(tokens, segments, token_table, segment_table, position_table, gamma, beta,
+                                        dst, layer_norm, ln_info));
+
+    const auto uk = CpuEmbeddingLayerKernel::get_implementation(
+        DataTypeISASelectorData{token_table->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _layer_norm = layer_norm;
+    _ln_info    = ln_info;
+    _name       = std::string("CpuEmbeddingLayerKernel").append("/").append(uk->name);
+    _mws = std::max<size_t>(1, min_bytes_per_thread / (token_table->dimension(0) * token_table->element_size()));
+
+    // Tokens along X, sequences of the batch along Y
+    Window win = calculate_max_window(*tokens, Steps());
+    ICpuKernel::configure(win);
+}
+
+Status CpuEmbeddingLayerKernel::validate(const ITensorInfo        *tokens,
+                                         const ITensorInfo        *segments,
+                                         const ITensorInfo        *token_table,
+                                         const ITensorInfo        *segment_table,
+                                         const ITensorInfo        *position_table,
+                                         const ITensorInfo        *gamma,
+                                         const ITensorInfo        *beta,
+                                         const ITensorInfo        *dst,
+                                         bool                      layer_norm,
+                                         const LayerNormLayerInfo &ln_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(tokens, segments, token_table, segment_table, position_table, dst);
+    // The text accessors write raw 32-bit ids whatever the data type of the input descriptor
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(tokens->element_size() != sizeof(uint32_t), "Token ids must be 32-bit");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(segments->element_size() != sizeof(uint32_t), "Segment ids must be 32-bit");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(tokens->num_dimensions() > 2, "Token ids must be of shape [seq, batch]");
+    ARM_COMPUTE_RETURN_ERROR_ON(tokens->tensor_shape() != segments->tensor_shape());
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(token_table);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(token_table, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(token_table, segment_table, position_table);
+    ARM_COMPUTE_RETURN_ERROR_ON(token_table->num_dimensions() > 2 || segment_table->num_dimensions() > 2 ||
+                                position_table->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(segment_table->dimension(0) != token_table->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(position_table->dimension(0) != token_table->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(tokens->dimension(0) > position_table->dimension(1),
+                                    "Sequence length exceeds the pretrained positional encoding");
+
+    if (layer_norm)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(ln_info.axis() != 0);
+        for (const ITensorInfo *param : {gamma, beta})
+        {
+            if (param != nullptr)
+            {
+                ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(token_table, param);
+                ARM_COMPUTE_RETURN_ERROR_ON(param->tensor_shape().total_size() != token_table->dimension(0));
+            }
+        }
+    }
+
+    const auto uk = CpuEmbeddingLayerKernel::get_implementation(
+        DataTypeISASelectorData{token_table->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(token_table, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != token_table->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != tokens->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(2) != tokens->dimension(1));
+    }
+
+    return Status{};
+}
+
+size_t CpuEmbeddingLayerKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
+{
+    ARM_COMPUTE_UNUSED(platform, thread_count);
+    // Each token gathers a whole table row: give every thread enough rows to amortise its start-up
+    return _mws;
+}
+
+void CpuEmbeddingLayerKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *tokens         = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *segments       = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *token_table    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *segment_table  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    const ITensor *position_table = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+    const ITensor *gamma          = tensors.get_const_tensor(TensorType::ACL_SRC_5);
+    const ITensor *beta           = tensors.get_const_tensor(TensorType::ACL_SRC_6);
+    ITensor       *dst            = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(tokens, segments, token_table, segment_table, position_table, gamma, beta, dst, _layer_norm, _ln_info,
+                window);
+}
+
+const char *CpuEmbeddingLayerKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuEmbeddingLayerKernel::EmbeddingKernel> &CpuEmbeddingLayerKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
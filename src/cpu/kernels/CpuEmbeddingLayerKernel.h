@@ -0,0 +1,105 @@
+#ifndef SRC_CPU_KERNELS_CPU_EMBEDDING_LAYER_KERNEL_H
+#define SRC_CPU_KERNELS_CPU_EMBEDDING_LAYER_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the fused embedding kernel
+ *
+ * Computes token_table[token] + segment_table[segment] + position_table[position] for every token,
+ * optionally followed by layer normalization, and writes the [d_model, seq, batch] output once.
+ */
+class CpuEmbeddingLayerKernel : public ICpuKernel<CpuEmbeddingLayerKernel>
+{
+private:
+    using EmbeddingKernelPtr = std::add_pointer<void(const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     ITensor *,
+                                                     bool,
+                                                     const LayerNormLayerInfo &,
+                                                     const Window &)>::type;
+
+public:
+    /* Default Constructor */
+    CpuEmbeddingLayerKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuEmbeddingLayerKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  tokens         Token id tensor info, shape [seq, batch]. Data types supported: any 32-bit type holding U32 ids.
+     * @param[in]  segments       Segment id tensor info. Shape and data type supported: Same as @p tokens
+     * @param[in]  token_table    Token embedding table info, shape [d_model, vocab_size]. Data type supported: F16/F32
+     * @param[in]  segment_table  Segment embedding table info, shape [d_model, num_segments]. Data type supported: Same as @p token_table
+     * @param[in]  position_table Position embedding table info, shape [d_model, max_position]. Data type supported: Same as @p token_table
+     * @param[in]  gamma          Per-channel layer normalization scale, nullptr to use the gamma of @p ln_info.
+     * @param[in]  beta           Per-channel layer normalization offset, nullptr to use the beta of @p ln_info.
+     * @param[out] dst            Destination tensor info, shape [d_model, seq, batch]. Data type supported: Same as @p token_table
+     * @param[in]  layer_norm     Whether to normalize the sum of the embeddings
+     * @param[in]  ln_info        Layer normalization information, only used when @p layer_norm is set
+     */
+    void configure(const ITensorInfo        *tokens,
+                   const ITensorInfo        *segments,
+                   const ITensorInfo        *token_table,
+                   const ITensorInfo        *segment_table,
+                   const ITensorInfo        *position_table,
+                   const ITensorInfo        *gamma,
+                   const ITensorInfo        *beta,
+                   ITensorInfo              *dst,
+                   bool                      layer_norm,
+                   const LayerNormLayerInfo &ln_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuEmbeddingLayerKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *tokens,
+                           const ITensorInfo        *segments,
+                           const ITensorInfo        *token_table,
+                           const ITensorInfo        *segment_table,
+                           const ITensorInfo        *position_table,
+                           const ITensorInfo        *gamma,
+                           const ITensorInfo        *beta,
+                           const ITensorInfo        *dst,
+                           bool                      layer_norm,
+                           const LayerNormLayerInfo &ln_info);
+
+    // Inherited methods overridden:
+    size_t      get_mws(const CPUInfo &platform, size_t thread_count) const override;
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct EmbeddingKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        EmbeddingKernelPtr           ukernel;
+    };
+
+    static const std::vector<EmbeddingKernel> &get_available_kernels();
+
+private:
+    LayerNormLayerInfo _ln_info{};
+    bool               _layer_norm{false};
+    EmbeddingKernelPtr _run_method{nullptr};
+    size_t             _mws{default_mws};
+    std::string        _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+
+#endif /* SRC_CPU_KERNELS_CPU_EMBEDDING_LAYER_KERNEL_H */
@@ -0,0 +1,146 @@
+#include "src/cpu/kernels/CpuFlashAttentionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/flash_attention/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuFlashAttentionKernel::FlashAttentionKernel> available_kernels = {
+    {"neon_fp32_flash_attention", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_flash_attention)},
+    {"neon_fp16_flash_attention",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_flash_attention)},
+};
+} // namespace
+
+void CpuFlashAttentionKernel::configure(const ITensorInfo                          *query,
+                                        const ITensorInfo                          *key,
+                                        const ITensorInfo                          *value,
+                                        const ITensorInfo                          *mask,
+                                        ITensorInfo                                *dst,
+                                        const ScaleDotProductionAttentionLayerInfo &info)
+{
+    ARM_COMPUTE_UNUSED(key, value, mask);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, dst);
+
+    // Output has the shape of the query: every head writes its own d_head slice of the row
+    auto_init_if_empty(*dst, query->clone()->set_tensor_shape(query->tensor_shape()));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(query, key, value, mask, dst, info));
+
+    const auto uk =
+        CpuFlashAttentionKernel::get_implementation(DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _info       = info;
+    _name       = std::string("CpuFlashAttentionKernel").append("/").append(uk->name);
+
+    // Heads along X, query tokens along Y, batches along the remaining dimensions
+    Window win;
+    win.use_tensor_dimensions(dst->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, info.h(), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuFlashAttentionKernel::validate(const ITensorInfo                          *query,
+                                         const ITensorInfo                          *key,
+                                         const ITensorInfo                          *value,
+                                         const ITensorInfo                          *mask,
+                                         const ITensorInfo                          *dst,
+                                         const ScaleDotProductionAttentionLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(query);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(query, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, key, value);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.h() == 0 || info.d_model() % info.h() != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.d_model() / info.h() > max_head_dim, "Head depth not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(query->dimension(0) != info.d_model());
+    ARM_COMPUTE_RETURN_ERROR_ON(key->dimension(0) != info.d_model());
+    ARM_COMPUTE_RETURN_ERROR_ON(value->dimension(0) != info.d_model());
+    ARM_COMPUTE_RETURN_ERROR_ON(key->dimension(1) != value->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(query->tensor_shape().total_size_upper(2) != key->tensor_shape().total_size_upper(2));
+
+    switch (info.mask_type())
+    {
+        case AttentionMaskType::NONE:
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(mask != nullptr, "Mask given without a mask type");
+            break;
+        case AttentionMaskType::ADDITIVE:
+            ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(mask);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, mask);
+            ARM_COMPUTE_RETURN_ERROR_ON(query->num_dimensions() > 3);
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(0) != key->dimension(1));
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(1) != 1 && mask->dimension(1) != query->dimension(1));
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(2) != 1 && mask->dimension(2) != query->dimension(2));
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->num_dimensions() > 3);
+            break;
+        case AttentionMaskType::VALID_LENGTH:
+            ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(mask);
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mask, 1, DataType::S32);
+            ARM_COMPUTE_RETURN_ERROR_ON(query->num_dimensions() > 3);
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->num_dimensions() > 1 || mask->dimension(0) != query->dimension(2));
+            break;
+        default:
+            ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported attention mask type");
+    }
+
+    const auto uk =
+        CpuFlashAttentionKernel::get_implementation(DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(query, dst);
+    }
+
+    return Status{};
+}
+
+void CpuFlashAttentionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *query = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *key   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *value = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *mask  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst   = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(query, key, value, mask, dst, _info, window);
+}
+
+const char *CpuFlashAttentionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuFlashAttentionKernel::FlashAttentionKernel> &CpuFlashAttentionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
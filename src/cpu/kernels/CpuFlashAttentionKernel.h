@@ -0,0 +1,93 @@
+#ifndef SRC_CPU_KERNELS_CPU_FLASH_ATTENTION_KERNEL_H
+#define SRC_CPU_KERNELS_CPU_FLASH_ATTENTION_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the fused (flash-style) scale dot production attention kernel
+ *
+ * Computes softmax(Q * K^T / sqrt(d_head)) * V for every head without materialising the score matrix.
+ * Key/value rows are streamed in blocks while a running maximum and sum are kept per query row,
+ * and the context is written straight into the merged-head [d_model, seq] layout of @p dst.
+ * Padded key positions given by a valid-length mask are never visited.
+ */
+class CpuFlashAttentionKernel : public ICpuKernel<CpuFlashAttentionKernel>
+{
+private:
+    using FlashAttentionKernelPtr = std::add_pointer<void(const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          ITensor *,
+                                                          const ScaleDotProductionAttentionLayerInfo &,
+                                                          const Window &)>::type;
+
+public:
+    /** Largest head depth (d_model / h) supported by the kernel */
+    static constexpr unsigned int max_head_dim = 256U;
+
+    /* Default Constructor */
+    CpuFlashAttentionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuFlashAttentionKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  query Query tensor info, shape [d_model, seq_q, batch]. Data type supported: F16/F32
+     * @param[in]  key   Key tensor info, shape [d_model, seq_k, batch]. Data type supported: Same as @p query
+     * @param[in]  value Value tensor info, shape [d_model, seq_k, batch]. Data type supported: Same as @p query
+     * @param[in]  mask  Attention mask tensor info, nullptr when info.mask_type() is @ref AttentionMaskType::NONE.
+     *                   Additive masks have shape [seq_k, 1 or seq_q, 1 or batch] and the data type of @p query,
+     *                   valid-length masks have shape [batch] and data type S32.
+     * @param[out] dst   Destination tensor info, shape [d_model, seq_q, batch]. Data type supported: Same as @p query
+     * @param[in]  info  Scale dot production attention layer information.
+     */
+    void configure(const ITensorInfo                          *query,
+                   const ITensorInfo                          *key,
+                   const ITensorInfo                          *value,
+                   const ITensorInfo                          *mask,
+                   ITensorInfo                                *dst,
+                   const ScaleDotProductionAttentionLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuFlashAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                          *query,
+                           const ITensorInfo                          *key,
+                           const ITensorInfo                          *value,
+                           const ITensorInfo                          *mask,
+                           const ITensorInfo                          *dst,
+                           const ScaleDotProductionAttentionLayerInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct FlashAttentionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        FlashAttentionKernelPtr      ukernel;
+    };
+
+    static const std::vector<FlashAttentionKernel> &get_available_kernels();
+
+private:
+    ScaleDotProductionAttentionLayerInfo _info{};
+    FlashAttentionKernelPtr              _run_method{nullptr};
+    std::string                          _name{};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+
+#endif /* SRC_CPU_KERNELS_CPU_FLASH_ATTENTION_KERNEL_H */
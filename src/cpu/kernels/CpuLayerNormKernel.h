@@ -12,12 +12,16 @@ namespace cpu
 {
 namespace kernels
 {
-/** Interface for the kernel to perform layer normalization */
+/** Interface for the kernel to perform layer normalization
+ *
+ * Every row along X is normalized independently, rows are distributed across threads.
+ */
 class CpuLayerNormKernel : public ICpuKernel<CpuLayerNormKernel>
 {
 private:
-    using LayerNormKernelPtr =
-        std::add_pointer<void(const ITensor *, ITensor *, const LayerNormLayerInfo &, const Window &)>::type;
+    using LayerNormKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, ITensor *, const LayerNormLayerInfo &, const Window &)>::type;
+
 public:
     /* Default Constructor */
     CpuLayerNormKernel() = default;
@@ -25,27 +29,44 @@ public:
 
     /** Initialise the kernel's inputs and output
      *
-     * @param[in]  input1 An input tensor. Data type supported: f32.
-     * @param[out] output Output tensor. Data type supported: F32.
-     * @param[out] op     Logical operation to perform
+     * @param[in]  input  An input tensor. Data type supported: F32/F16/BFLOAT16.
+     * @param[in]  gamma  (Optional) Per-channel scale tensor of shape [input.x]. Data type supported: Same as @p input.
+     *                    Scalar gamma of @p info is used when nullptr.
+     * @param[in]  beta   (Optional) Per-channel offset tensor of shape [input.x]. Data type supported: Same as @p input.
+     *                    Scalar beta of @p info is used when nullptr.
+     * @param[out] output Output tensor. Data type supported: Same as @p input.
+     * @param[in]  info   Layer normalization information. Only normalization along X is supported.
      */
-    void configure(const ITensorInfo *input, ITensorInfo *output, LayerNormLayerInfo info);
+    void configure(const ITensorInfo *input,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *output,
+                   LayerNormLayerInfo info);
     /** Static function to check if given info will lead to a valid configuration of @ref CpuLayerNormKernel
      *
-     * @param[in] input An input tensor. Data type supported: F32.
-     * @param[in] output Output tensor. Data type supported: F32..
-     * @param[in] op     Logical operation to perform
+     * Similar to CpuLayerNormKernel::configure()
      *
      * @return a status
      */
-    static Status
-    validate(const ITensorInfo *input,  const ITensorInfo *output, LayerNormLayerInfo info);
-
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           LayerNormLayerInfo info);
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
-    
+
+    struct LayerNormKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LayerNormKernelPtr           ukernel;
+    };
+
+    static const std::vector<LayerNormKernel> &get_available_kernels();
+
 private:
     LayerNormLayerInfo         _info{};
     LayerNormKernelPtr         _run_method{nullptr};
@@ -0,0 +1,115 @@
+#include "src/cpu/kernels/CpuOnlineSoftmaxKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/online_softmax/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuOnlineSoftmaxKernel::OnlineSoftmaxKernel> available_kernels = {
+    {"neon_fp32_online_softmax", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_online_softmax)},
+    {"neon_fp16_online_softmax",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_online_softmax)},
+};
+} // namespace
+
+void CpuOnlineSoftmaxKernel::configure(const ITensorInfo *src, const ITensorInfo *mask, ITensorInfo *dst, float scale)
+{
+    ARM_COMPUTE_UNUSED(mask);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    // Configure output tensor info.
+    auto_init_if_empty(*dst, *src->clone());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, mask, dst, scale));
+
+    const auto uk =
+        CpuOnlineSoftmaxKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _scale      = scale;
+    _name       = std::string("CpuOnlineSoftmaxKernel").append("/").append(uk->name);
+
+    // One row per iteration, the rows are split between the threads
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status
+CpuOnlineSoftmaxKernel::validate(const ITensorInfo *src, const ITensorInfo *mask, const ITensorInfo *dst, float scale)
+{
+    ARM_COMPUTE_UNUSED(scale);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 3);
+
+    if (mask != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, mask);
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(0) != src->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(1) != 1 && mask->dimension(1) != src->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(2) != 1 && mask->dimension(2) != src->dimension(2));
+        ARM_COMPUTE_RETURN_ERROR_ON(mask->num_dimensions() > 3);
+    }
+
+    const auto uk =
+        CpuOnlineSoftmaxKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    return Status{};
+}
+
+void CpuOnlineSoftmaxKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *mask = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *dst  = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, mask, dst, _scale, window);
+}
+
+const char *CpuOnlineSoftmaxKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuOnlineSoftmaxKernel::OnlineSoftmaxKernel> &CpuOnlineSoftmaxKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,70 @@
+#ifndef ARM_COMPUTE_CPU_ONLINE_SOFTMAX_KERNEL_H
+#define ARM_COMPUTE_CPU_ONLINE_SOFTMAX_KERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel computing softmax(scale * src + mask) along X in a single pass over memory
+ *
+ * A running maximum and a rescaled running sum are kept while the row is read, so the row is read once
+ * from memory and written once, without the max and sum temporaries of @ref CpuSoftmaxKernel. The scale
+ * and the additive mask of attention scores are applied on the fly, which lets them be dropped from the
+ * score GEMM.
+ */
+class CpuOnlineSoftmaxKernel : public ICpuKernel<CpuOnlineSoftmaxKernel>
+{
+private:
+    using OnlineSoftmaxKernelPtr =
+        std::add_pointer<void(const ITensor *, const ITensor *, ITensor *, float, const Window &)>::type;
+
+public:
+    /** Default constructor */
+    CpuOnlineSoftmaxKernel() = default;
+    /** Default destructor */
+    ~CpuOnlineSoftmaxKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuOnlineSoftmaxKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src   Source tensor info, the softmax is taken along X. Data types supported: F32/F16
+     * @param[in]  mask  (Optional) Additive mask tensor info, shape [src.x, 1 or src.y, 1 or src.z]. Can be nullptr.
+     *                   Data type supported: Same as @p src
+     * @param[out] dst   Destination tensor info. Data types supported: Same as @p src
+     * @param[in]  scale (Optional) Factor applied to @p src before the mask is added
+     */
+    void configure(const ITensorInfo *src, const ITensorInfo *mask, ITensorInfo *dst, float scale = 1.f);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuOnlineSoftmaxKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *mask, const ITensorInfo *dst, float scale = 1.f);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct OnlineSoftmaxKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        OnlineSoftmaxKernelPtr       ukernel;
+    };
+
+    static const std::vector<OnlineSoftmaxKernel> &get_available_kernels();
+
+private:
+    OnlineSoftmaxKernelPtr _run_method{nullptr};
+    float                  _scale{1.f};
+    std::string            _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_ONLINE_SOFTMAX_KERNEL_H */
@@ -66,18 +66,21 @@ void CpuPositionEmbeddingKernel::configure(const ITensorInfo *src, const ITensor
     ARM_COMPUTE_UNUSED(pos);
     // Configure output tensor info.
     auto_init_if_empty(*dst, TensorInfo(*src->clone()));
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, pos, dst));
 
-    // Configure kernel window
-    Window win = calculate_max_window(*src, Steps());
+    // Configure kernel window: positions only depend on the token index, the [d_model, seq] output is
+    // shared by all the sequences of a batch and broadcast when summed with the token embeddings
+    Window win = calculate_max_window(TensorShape(src->dimension(0)), Steps());
     ICpuKernel::configure(win);
 }
 
 
 Status CpuPositionEmbeddingKernel::validate(const ITensorInfo *src, const ITensorInfo *pos, const ITensorInfo *dst)
 {
-    ARM_COMPUTE_UNUSED(pos);
-    ARM_COMPUTE_UNUSED(src);
     ARM_COMPUTE_UNUSED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, pos);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) > pos->dimension(1),
+                                    "Sequence length exceeds the pretrained positional encoding");
 
     return Status{};
 }
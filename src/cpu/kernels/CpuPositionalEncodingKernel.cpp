@@ -5,13 +5,16 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
-#include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/Validate.h"
 
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/positional_encoding/list.h"
 
 #include <cmath>
+#include <vector>
 
 namespace arm_compute
 {
@@ -22,93 +25,128 @@ namespace kernels
 
 namespace
 {
-/**  Compute Transformer positional encoding
- *
- *  @note math: PE(pos,2i)   = sin(pos/10000^(2i/dmodel))
- *              PE(pos,2i+1) = cos(pos/10000^(2i/dmodel))
- */
+static const std::vector<CpuPositionalEncodingKernel::PositionalEncodingKernel> available_kernels = {
+    {"neon_fp32_positional_encoding", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_positional_encoding)},
+    {"neon_fp16_positional_encoding",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_positional_encoding)},
+};
+
 template <typename T>
-void run_positional_encoding(const Window &window, ITensor *src, ITensor *dst, const unsigned int d_model)
+void fill_encoding_table(ITensor *table)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(d_model%2!=0, "Model depth (d_model) must be dividable by 2");
-
-    std::cout << "src/cpu/kernels/CpuPositionalEncodingKernel.cpp" << std::endl;
-
-    Window win = window;
-    win.set(Window::DimX, Window::Dimension(0,1,1));
-    win.set(Window::DimY, Window::Dimension(0,1,1));
-    /* token sequence */
-    const unsigned int window_start_x   = static_cast<unsigned int>(window.x().start());
-    const unsigned int window_end_x     = static_cast<unsigned int>(window.x().end());
-
-    unsigned int token_offset;
-
-    Iterator src_iter(src,win);
-    Iterator dst_iter(dst,win);
-    const auto src_ptr  = reinterpret_cast<T *>(src_iter.ptr());
-    const auto dst_ptr  = reinterpret_cast<T *>(dst_iter.ptr());
-
-    T PE_2i,PE_2i1;
-    execute_window_loop(win,
-        [&](const Coordinates &)
+    const unsigned int d_model = table->info()->dimension(0);
+    const unsigned int max_seq = table->info()->dimension(1);
+
+    // Frequencies only depend on the channel pair, evaluate them once
+    std::vector<double> div_term(d_model / 2);
+    for (unsigned int i = 0; i < div_term.size(); ++i)
+    {
+        div_term[i] = std::exp(2.0 * i * -std::log(10000.0) / d_model);
+    }
+
+    for (unsigned int pos = 0; pos < max_seq; ++pos)
+    {
+        auto row = reinterpret_cast<T *>(table->ptr_to_element(Coordinates(0, pos)));
+        for (unsigned int i = 0; i < div_term.size(); ++i)
         {
-            for(unsigned int pos = window_start_x; pos < window_end_x; pos++)
-            {
-                token_offset = pos * d_model;
-                for(unsigned int i = 0; i < d_model ; i+=2)
-                {
-                    double div_term = exp(i * -log(10000.0) / d_model);
-                    PE_2i   = sin(pos * div_term);
-                    PE_2i1  = cos(pos * div_term);
-
-                    *(dst_ptr + token_offset + i)       = *(src_ptr + token_offset + i)   + PE_2i;
-                    *(dst_ptr + token_offset + i+1)     = *(src_ptr + token_offset + i+1) + PE_2i1;
-                }
-            }
+            row[2 * i]     = static_cast<T>(static_cast<float>(std::sin(pos * div_term[i])));
+            row[2 * i + 1] = static_cast<T>(static_cast<float>(std::cos(pos * div_term[i])));
         }
-    ,src_iter);
-
+    }
 }
+} // namespace
 
-}
-
-void CpuPositionalEncodingKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const unsigned int d_model)
+void CpuPositionalEncodingKernel::configure(const ITensorInfo *src, const ITensorInfo *table, ITensorInfo *dst)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
-
-    _d_model = d_model;
+    ARM_COMPUTE_UNUSED(table);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, table, dst);
 
     // Configure output tensor info.
-    auto_init_if_empty(*dst, TensorInfo(*src->clone()));
+    auto_init_if_empty(*dst, *src->clone());
 
-    // Configure kernel window
-    Window win = calculate_max_window(*src, Steps());
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, table, dst));
+
+    const auto uk = CpuPositionalEncodingKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuPositionalEncodingKernel").append("/").append(uk->name);
+
+    // One row per token, the rows are split between the threads
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
     ICpuKernel::configure(win);
 }
 
-
-Status CpuPositionalEncodingKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const unsigned int d_model)
+Status CpuPositionalEncodingKernel::validate(const ITensorInfo *src, const ITensorInfo *table, const ITensorInfo *dst)
 {
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(dst);
-    ARM_COMPUTE_UNUSED(d_model);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, table, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, table);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) % 2 != 0, "Model depth (d_model) must be dividable by 2");
+    ARM_COMPUTE_RETURN_ERROR_ON(table->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(table->dimension(0) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(1) > table->dimension(1),
+                                    "Sequence length exceeds the encoding table");
+
+    const auto uk = CpuPositionalEncodingKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
 
     return Status{};
 }
 
+void CpuPositionalEncodingKernel::compute_encoding_table(ITensor *table)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(table);
+    ARM_COMPUTE_ERROR_ON_MSG(table->info()->dimension(0) % 2 != 0, "Model depth (d_model) must be dividable by 2");
+
+    switch (table->info()->data_type())
+    {
+        case DataType::F32:
+            fill_encoding_table<float>(table);
+            break;
+        case DataType::F16:
+            fill_encoding_table<half>(table);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported encoding table data type");
+    }
+}
+
 void CpuPositionalEncodingKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
 
-    auto src = tensors.get_tensor(TensorType::ACL_SRC);
-    auto dst = tensors.get_tensor(TensorType::ACL_DST);
+    const ITensor *src   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *table = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *dst   = tensors.get_tensor(TensorType::ACL_DST);
 
-    run_positional_encoding<float>(window, src, dst, _d_model);
+    _run_method(src, table, dst, window);
+}
+
+const char *CpuPositionalEncodingKernel::name() const
+{
+    return _name.c_str();
 }
 
-const char * CpuPositionalEncodingKernel::name() const
+const std::vector<CpuPositionalEncodingKernel::PositionalEncodingKernel> &
+CpuPositionalEncodingKernel::get_available_kernels()
 {
-    return "CpuPositionalEncodingKernel";
+    return available_kernels;
 }
 
 } // namespace kernels
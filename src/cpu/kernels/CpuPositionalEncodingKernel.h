@@ -10,9 +10,20 @@ namespace cpu
 {
 namespace kernels
 {
-/** Kernel to perform tensor positional encoding */
+/** Kernel to add a precomputed sinusoidal positional encoding to a sequence of embeddings
+ *
+ * @note math: PE(pos,2i)   = sin(pos/10000^(2i/dmodel))
+ *             PE(pos,2i+1) = cos(pos/10000^(2i/dmodel))
+ *
+ * The transcendentals are evaluated once by @ref CpuPositionalEncodingKernel::compute_encoding_table,
+ * every run only adds the table rows to the embeddings.
+ */
 class CpuPositionalEncodingKernel : public ICpuKernel<CpuPositionalEncodingKernel>
 {
+private:
+    using PositionalEncodingKernelPtr =
+        std::add_pointer<void(const ITensor *, const ITensor *, ITensor *, const Window &)>::type;
+
 public:
     /** Default constructor */
     CpuPositionalEncodingKernel() = default;
@@ -21,27 +32,40 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPositionalEncodingKernel);
     /** Configure kernel for a given list of arguments
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
-     *
-     * @param[in]  src  Srouce tensor to permute. Data types supported: All
-     * @param[out] dst  Destination tensor. Data types supported: Same as @p src
-     * @param[in]  perm Permutation vector
+     * @param[in]  src   Source embeddings, shape [d_model, seq, batch]. Data types supported: F32/F16
+     * @param[in]  table Encoding table, shape [d_model, max_seq] with max_seq >= seq. Data type supported: Same as @p src
+     * @param[out] dst   Destination tensor. Data types supported: Same as @p src
      */
-    void configure(const ITensorInfo *src, ITensorInfo *dst, const unsigned int d_model);
+    void configure(const ITensorInfo *src, const ITensorInfo *table, ITensorInfo *dst);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuPositionalEncodingKernel::configure()
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const unsigned int d_model);
+    static Status validate(const ITensorInfo *src, const ITensorInfo *table, const ITensorInfo *dst);
+    /** Fill an encoding table, shape [d_model, max_seq], with the sinusoidal encoding of every position
+     *
+     * @param[out] table Allocated table. Data types supported: F32/F16
+     */
+    static void compute_encoding_table(ITensor *table);
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
 
+    struct PositionalEncodingKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        PositionalEncodingKernelPtr  ukernel;
+    };
+
+    static const std::vector<PositionalEncodingKernel> &get_available_kernels();
+
 private:
-    unsigned int _d_model{512U};
+    PositionalEncodingKernelPtr _run_method{nullptr};
+    std::string                 _name{};
 };
 } // namespace kernels
 } // namespace cpu
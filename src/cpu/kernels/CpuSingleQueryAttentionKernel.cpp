@@ -0,0 +1,137 @@
+#include "src/cpu/kernels/CpuSingleQueryAttentionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/CpuFlashAttentionKernel.h"
+#include "src/cpu/kernels/single_query_attention/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+
+namespace
+{
+static const std::vector<CpuSingleQueryAttentionKernel::SingleQueryAttentionKernel> available_kernels = {
+    {"neon_fp32_single_query_attention", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_single_query_attention)},
+    {"neon_fp16_single_query_attention",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_single_query_attention)},
+};
+} // namespace
+
+void CpuSingleQueryAttentionKernel::configure(const ITensorInfo                          *query,
+                                              const ITensorInfo                          *key,
+                                              const ITensorInfo                          *value,
+                                              const ITensorInfo                          *key_cache,
+                                              const ITensorInfo                          *value_cache,
+                                              ITensorInfo                                *dst,
+                                              const ScaleDotProductionAttentionLayerInfo &info)
+{
+    ARM_COMPUTE_UNUSED(key, value, key_cache, value_cache);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(query, key, value, key_cache, value_cache, dst);
+
+    auto_init_if_empty(*dst, query->clone()->set_tensor_shape(query->tensor_shape()));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(query, key, value, key_cache, value_cache, dst, info));
+
+    const auto uk = CpuSingleQueryAttentionKernel::get_implementation(
+        DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _info       = info;
+    _name       = std::string("CpuSingleQueryAttentionKernel").append("/").append(uk->name);
+    _cache_len  = 0;
+
+    // Heads along X, batches along the remaining dimensions
+    Window win;
+    win.use_tensor_dimensions(dst->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, info.h(), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuSingleQueryAttentionKernel::validate(const ITensorInfo                          *query,
+                                               const ITensorInfo                          *key,
+                                               const ITensorInfo                          *value,
+                                               const ITensorInfo                          *key_cache,
+                                               const ITensorInfo                          *value_cache,
+                                               const ITensorInfo                          *dst,
+                                               const ScaleDotProductionAttentionLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, key_cache, value_cache, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(query);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(query, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, key, value, key_cache, value_cache);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(query, key, value);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(key_cache, value_cache);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.h() == 0 || info.d_model() % info.h() != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.d_model() / info.h() > CpuFlashAttentionKernel::max_head_dim,
+                                    "Head depth not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(query->dimension(0) != info.d_model());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->dimension(1) != 1, "Only one new token per run is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(query->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(key_cache->dimension(0) != info.d_model());
+    ARM_COMPUTE_RETURN_ERROR_ON(info.max_cache_len() == 0 || key_cache->dimension(1) != info.max_cache_len());
+    ARM_COMPUTE_RETURN_ERROR_ON(key_cache->dimension(2) != query->dimension(2));
+
+    const auto uk = CpuSingleQueryAttentionKernel::get_implementation(
+        DataTypeISASelectorData{query->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(query, dst);
+    }
+
+    return Status{};
+}
+
+void CpuSingleQueryAttentionKernel::set_cache_length(unsigned int cache_len)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(cache_len >= _info.max_cache_len(), "Key/value cache is full");
+    _cache_len = cache_len;
+}
+
+void CpuSingleQueryAttentionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *query       = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *key         = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *value       = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *key_cache   = tensors.get_tensor(TensorType::ACL_INT_0);
+    ITensor       *value_cache = tensors.get_tensor(TensorType::ACL_INT_1);
+    ITensor       *dst         = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(query, key, value, key_cache, value_cache, dst, _info, _cache_len, window);
+}
+
+const char *CpuSingleQueryAttentionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuSingleQueryAttentionKernel::SingleQueryAttentionKernel> &
+CpuSingleQueryAttentionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,98 @@
+#ifndef SRC_CPU_KERNELS_CPU_SINGLE_QUERY_ATTENTION_KERNEL_H
+#define SRC_CPU_KERNELS_CPU_SINGLE_QUERY_ATTENTION_KERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the single query (decoding step) attention kernel
+ *
+ * Appends the key and value of one new token to the key/value caches and computes its attention
+ * against every cached token. Each head is a matrix-vector product over the cache, so the kernel is
+ * parallelised across the heads rather than the (single) query row.
+ */
+class CpuSingleQueryAttentionKernel : public ICpuKernel<CpuSingleQueryAttentionKernel>
+{
+private:
+    using SingleQueryAttentionKernelPtr = std::add_pointer<void(const ITensor *,
+                                                                const ITensor *,
+                                                                const ITensor *,
+                                                                ITensor *,
+                                                                ITensor *,
+                                                                ITensor *,
+                                                                const ScaleDotProductionAttentionLayerInfo &,
+                                                                unsigned int,
+                                                                const Window &)>::type;
+
+public:
+    /* Default Constructor */
+    CpuSingleQueryAttentionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuSingleQueryAttentionKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  query       Query tensor info of the new token, shape [d_model, 1, batch]. Data type supported: F16/F32
+     * @param[in]  key         Key tensor info of the new token. Shape and data type supported: Same as @p query
+     * @param[in]  value       Value tensor info of the new token. Shape and data type supported: Same as @p query
+     * @param[in]  key_cache   Key cache tensor info, shape [d_model, info.max_cache_len(), batch]. Data type supported: Same as @p query
+     * @param[in]  value_cache Value cache tensor info. Shape and data type supported: Same as @p key_cache
+     * @param[out] dst         Destination tensor info. Shape and data type supported: Same as @p query
+     * @param[in]  info        Scale dot production attention layer information.
+     */
+    void configure(const ITensorInfo                          *query,
+                   const ITensorInfo                          *key,
+                   const ITensorInfo                          *value,
+                   const ITensorInfo                          *key_cache,
+                   const ITensorInfo                          *value_cache,
+                   ITensorInfo                                *dst,
+                   const ScaleDotProductionAttentionLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuSingleQueryAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                          *query,
+                           const ITensorInfo                          *key,
+                           const ITensorInfo                          *value,
+                           const ITensorInfo                          *key_cache,
+                           const ITensorInfo                          *value_cache,
+                           const ITensorInfo                          *dst,
+                           const ScaleDotProductionAttentionLayerInfo &info);
+    /** Set the number of tokens already held by the caches, the new token is appended after them
+     *
+     * @param[in] cache_len Number of cached tokens, less than info.max_cache_len()
+     */
+    void set_cache_length(unsigned int cache_len);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct SingleQueryAttentionKernel
+    {
+        const char                   *name;
+        const DataTypeISASelectorPtr  is_selected;
+        SingleQueryAttentionKernelPtr ukernel;
+    };
+
+    static const std::vector<SingleQueryAttentionKernel> &get_available_kernels();
+
+private:
+    ScaleDotProductionAttentionLayerInfo _info{};
+    SingleQueryAttentionKernelPtr        _run_method{nullptr};
+    std::string                          _name{};
+    unsigned int                         _cache_len{0};
+};
+
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+
+#endif /* SRC_CPU_KERNELS_CPU_SINGLE_QUERY_ATTENTION_KERNEL_H */
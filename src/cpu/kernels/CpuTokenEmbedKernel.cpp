@@ -3,6 +3,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
 
 #include "src/core/common/Registrars.h"
 #include "src/core/CPP/Validate.h"
@@ -10,6 +11,8 @@
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/tokenembed/list.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace cpu
@@ -19,54 +22,79 @@ namespace kernels
 
 namespace
 {
+/** Bytes of table rows each thread should gather at least, below this threading overhead dominates */
+constexpr size_t min_bytes_per_thread = 16 * 1024;
+
 static const std::vector<CpuTokenEmbedKernel::TKEMBKernel> available_kernels = {
-    /*
-#ifdef ARM_COMPUTE_ENABLE_SVE
-    // TBA
-#endif // ARM_COMPUTE_ENABLE_SVE
-
-#ifdef __aarch64__
-    // TBA
-#endif // __aarch64__
-*/
     {"neon_fp32_token_embedding", [](const TokenEmbedKernelDataTypeISASelectorData &data) { return data.dt == DataType::F32; },
-     REGISTER_FP32_NEON(arm_compute::cpu::neon_token_embed_char_2_float32)},
-
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_token_embed)},
+    {"neon_fp16_token_embedding",
+     [](const TokenEmbedKernelDataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_token_embed)},
+    {"neon_bf16_token_embedding",
+     [](const TokenEmbedKernelDataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16; },
+     REGISTER_BF16_NEON(arm_compute::cpu::neon_bf16_token_embed)},
+    {"neon_qs8_token_embedding",
+     [](const TokenEmbedKernelDataTypeISASelectorData &data)
+     { return data.dt == DataType::QASYMM8_SIGNED || data.dt == DataType::QSYMM8_PER_CHANNEL; },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_token_embed)},
 };
-}
+} // namespace
 
 void CpuTokenEmbedKernel::configure(const ITensorInfo *src, const ITensorInfo *vocab, ITensorInfo *dst, EmbeddingLayerInfo tkemb_info)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(src);
-    ARM_COMPUTE_ERROR_ON_NULLPTR(vocab);
-    
-    const auto uk = CpuTokenEmbedKernel::get_implementation(
-        TokenEmbedKernelDataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()}
-    );
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, vocab, dst);
 
-    const TensorShape dst_shape(src->tensor_shape().x(),vocab->tensor_shape().y());
-    // Configure output tensor info.
-    auto_init_if_empty(*dst, TensorInfo(*vocab->clone()).set_tensor_shape(dst_shape));
+    // Configure output tensor info: ids [seq, batch] are expanded to vectors [d_model, seq, batch]
+    TensorShape dst_shape = src->tensor_shape();
+    dst_shape.shift_right(1);
+    dst_shape.set(0, vocab->dimension(0));
+    auto_init_if_empty(*dst, TensorInfo(dst_shape, 1, DataType::F32));
 
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, vocab, dst, tkemb_info));
+
+    const auto uk = CpuTokenEmbedKernel::get_implementation(
+        TokenEmbedKernelDataTypeISASelectorData{vocab->data_type(), CPUInfo::get().get_isa()}
+    );
     ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
 
     _run_method = uk->ukernel;
     _tkemb_info = tkemb_info;
     _name       = std::string("CpuTokenEmbedKernel").append("/").append(uk->name);
 
-    Window win;
+    // Tokens along X, sequences of the batch along Y
+    _split_dimension = Window::DimX;
+    _mws             = std::max<size_t>(1, min_bytes_per_thread / (vocab->dimension(0) * vocab->element_size()));
 
-    win = calculate_max_window(*dst, Steps());
+    Window win = calculate_max_window(*src, Steps());
     ICPPKernel::configure(win);
-    
 }
 
-Status CpuTokenEmbedKernel::validate(const ITensorInfo *src,  const ITensorInfo *vocab, ITensorInfo *dst, EmbeddingLayerInfo tkemb_info)
+Status CpuTokenEmbedKernel::validate(const ITensorInfo *src, const ITensorInfo *vocab, const ITensorInfo *dst, EmbeddingLayerInfo tkemb_info)
 {
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(vocab);
-    ARM_COMPUTE_UNUSED(dst);
     ARM_COMPUTE_UNUSED(tkemb_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, vocab, dst);
+    // The text accessors write raw 32-bit ids whatever the data type of the input descriptor
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->element_size() != sizeof(uint32_t), "Token ids must be 32-bit");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(vocab, 1, DataType::F32, DataType::F16, DataType::BFLOAT16,
+                                                         DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Token ids must be of shape [seq, batch]");
+    ARM_COMPUTE_RETURN_ERROR_ON(vocab->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(vocab->data_type() == DataType::QSYMM8_PER_CHANNEL &&
+                                vocab->quantization_info().scale().size() != vocab->dimension(1));
+
+    const auto uk = CpuTokenEmbedKernel::get_implementation(
+        TokenEmbedKernelDataTypeISASelectorData{vocab->data_type(), CPUInfo::get().get_isa()}
+    );
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != vocab->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != src->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(2) != src->dimension(1));
+    }
     return Status{};
 }
 
@@ -78,9 +106,8 @@ size_t CpuTokenEmbedKernel::get_mws(const CPUInfo &platform, size_t thread_count
 
     if (_split_dimension == Window::DimX)
     {
-        // Don't split the work load too small if the tensor has been reinterpreted as 1D.
-        // This number is loosely chosen as threading overhead in each platform varies wildly.
-        return 1536;
+        // Each token gathers a whole table row: give every thread enough rows to amortise its start-up
+        return _mws;
     }
     return default_mws;
 }
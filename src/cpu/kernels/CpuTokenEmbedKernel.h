@@ -11,7 +11,11 @@ namespace cpu
 {
 namespace kernels
 {
-/** Interface for the token embedding kernel */
+/** Interface for the token embedding kernel
+ *
+ * Gathers one table row per token id, converting F16/BF16 tables and dequantising 8-bit tables to F32 on the fly.
+ * Work is split across the tokens of each sequence.
+ */
 class CpuTokenEmbedKernel : public ICpuKernel<CpuTokenEmbedKernel>
 {
 private:
@@ -23,9 +27,11 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuTokenEmbedKernel);
     /** Configure kernel for a given list of arguments
      *
-     * @param[in]   src             Source tensor info. Data types supported: U8.
-     * @param[in]   vocab           Char 2 Vec const tensor info, Data type supported: F32
-     * @param[out]  dst             Destination tensor info. Data type supported: F32
+     * @param[in]   src             Token id tensor info, shape [seq, batch]. Data types supported: any 32-bit type holding U32 ids.
+     *                              Ids past the end of the table read its last row.
+     * @param[in]   vocab           Embedding table tensor info, shape [d_model, vocab_size].
+     *                              Data type supported: F32/F16/BFLOAT16/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL (one scale per row)
+     * @param[out]  dst             Destination tensor info, shape [d_model, seq, batch]. Data type supported: F32
      * @param[in]   tkemb_info      Token embedding layer information.
      */
     void configure(const ITensorInfo *src, const ITensorInfo *vocab,  ITensorInfo *dst, EmbeddingLayerInfo tkemb_info);
@@ -35,7 +41,7 @@ public:
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *src, const ITensorInfo *vocab, ITensorInfo *dst, EmbeddingLayerInfo tkemb_info);
+    static Status validate(const ITensorInfo *src, const ITensorInfo *vocab, const ITensorInfo *dst, EmbeddingLayerInfo tkemb_info);
 
     /** Return minimum workload size of the relevant kernel
      *
@@ -72,7 +78,8 @@ public:
 private:
     EmbeddingLayerInfo      _tkemb_info{};
     TKEMBKernelPtr          _run_method{nullptr};
-    size_t                  _split_dimension{Window::DimY};
+    size_t                  _split_dimension{Window::DimX};
+    size_t                  _mws{default_mws};
     std::string             _name{};
 };
 
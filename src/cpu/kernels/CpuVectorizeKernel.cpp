@@ -3,6 +3,7 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
 
 #include "src/core/common/Registrars.h"
 #include "src/core/CPP/Validate.h"
@@ -39,14 +40,15 @@ void CpuVectorizeKernel::configure(const ITensorInfo *src, const ITensorInfo *ve
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src);
     ARM_COMPUTE_ERROR_ON_NULLPTR(vector);
-    
+
     const auto uk = CpuVectorizeKernel::get_implementation(
         VectorizeKernelDataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()}
     );
 
-    std::cout << "CpuVectorizeKernel::configure " << src->tensor_shape().x() <<  " "  << vector->tensor_shape().y() << std::endl;
-    // Configure output tensor info.
-    const TensorShape dst_shape(vector->tensor_shape().x(),src->tensor_shape().x());
+    // Configure output tensor info: ids [seq, batch] are expanded to vectors [d_model, seq, batch]
+    TensorShape dst_shape = src->tensor_shape();
+    dst_shape.shift_right(1);
+    dst_shape.set(0, vector->tensor_shape().x());
     if (dst->tensor_shape().total_size() == 0)
     {
         auto_init_if_empty(*dst, TensorInfo(*vector->clone()).set_tensor_shape(dst_shape));
@@ -55,31 +57,31 @@ void CpuVectorizeKernel::configure(const ITensorInfo *src, const ITensorInfo *ve
     {
         dst->set_tensor_shape(dst_shape);
     }
-    std::cout << "dst->info()->tensor_shape().x() " << dst->tensor_shape().x() << std::endl;
-    std::cout << "dst->info()->tensor_shape().y() " << dst->tensor_shape().y() << std::endl;
-    std::cout << "dst->info()->tensor_shape().z() " << dst->tensor_shape().z() << std::endl;
 
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, vector, dst));
     ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
 
     _run_method = uk->ukernel;
     _name       = std::string("CpuVectorizeKernel").append("/").append(uk->name);
 
-    Window win;
-
-    win = calculate_max_window(*src, Steps());
+    // Tokens along X, sequences of the batch along Y
+    Window win = calculate_max_window(*src, Steps());
     ICPPKernel::configure(win);
-    std::cout << "win.x start " << win.x().start() << " end " << win.x().end() << " step " << win.x().step() << std::endl; 
-    std::cout << "win.y start " << win.y().start() << " end " << win.y().end() << " step " << win.y().step() << std::endl; 
-    std::cout << "win.z start " << win.z().start() << " end " << win.z().end() << " step " << win.z().step() << std::endl; 
-    
-    
 }
 
 Status CpuVectorizeKernel::validate(const ITensorInfo *src,  const ITensorInfo *vector, ITensorInfo *dst)
 {
-    ARM_COMPUTE_UNUSED(src);
-    ARM_COMPUTE_UNUSED(vector);
-    ARM_COMPUTE_UNUSED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, vector, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Token ids must be of shape [seq, batch]");
+    ARM_COMPUTE_RETURN_ERROR_ON(vector->num_dimensions() > 2);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(vector, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != vector->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != src->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(2) != src->dimension(1));
+    }
     return Status{};
 }
 
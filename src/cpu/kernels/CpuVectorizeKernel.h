@@ -23,9 +23,9 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuVectorizeKernel);
     /** Configure kernel for a given list of arguments
      *
-     * @param[in]   src             Source tensor info. Data types supported: U8.
-     * @param[in]   vector          Const target vector tensor info, Data type supported: F32
-     * @param[out]  dst             Destination tensor info. Data type supported: F32
+     * @param[in]   src             Source tensor info, ids of shape [seq, batch]. Data types supported: U8.
+     * @param[in]   vector          Const target vector tensor info, shape [d_model, vocab]. Data type supported: F32
+     * @param[out]  dst             Destination tensor info, shape [d_model, seq, batch]. Data type supported: F32
      * @param[in]   tkemb_info      Token embedding layer information.
      */
     void configure(const ITensorInfo *src, const ITensorInfo *vector,  ITensorInfo *dst);
@@ -78,9 +78,6 @@ void fp_neon_activation_impl(const ITensor             *src,
     // In case of aarh64, we call vsqrt directly, so we don't use delta.
 #ifndef __aarch64__
     const auto delta = wrapper::vdup_n(static_cast<T>(P.delta), ExactTagType{});
-#else  /* #ifndef __aarch64__ */
-    const auto const_inv_2      = wrapper::vdup_n(static_cast<T>(0.5f), ExactTagType{});
-    const auto const_inv_sqrt_2 = wrapper::vdup_n(static_cast<T>(0.70710678118f), ExactTagType{});
 #endif /* __aarch64__ */
     const auto      const_1           = wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{});
     const auto      const_0           = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
@@ -166,14 +163,12 @@ void fp_neon_activation_impl(const ITensor             *src,
                         tmp = wrapper::vmul(vin, wrapper::vinv(wrapper::vadd(
                                                      const_1, wrapper::vexpq(wrapper::vneg(wrapper::vmul(va, vin))))));
                         break;
-#ifdef __aarch64__
                     case ActivationLayerInfo::ActivationFunction::GELU:
-                        tmp = wrapper::vmul(
-                            vin,
-                            wrapper::vmul(const_inv_2,
-                                          wrapper::vadd(const_1, wrapper::verf(wrapper::vmul(vin, const_inv_sqrt_2)))));
+                        tmp = wrapper::vgelu(vin);
+                        break;
+                    case ActivationLayerInfo::ActivationFunction::GELU_TANH:
+                        tmp = wrapper::vgelu_tanh(vin);
                         break;
-#endif /* __aarch64__ */
                     default:
                         ARM_COMPUTE_ERROR("Unsupported activation function");
                 }
@@ -234,6 +229,12 @@ void fp_neon_activation_impl(const ITensor             *src,
                     case ActivationLayerInfo::ActivationFunction::GELU:
                         tmp = in * static_cast<T>(0.5f * (1.0f + erff(static_cast<float>(in) / 1.41421356237f)));
                         break;
+                    case ActivationLayerInfo::ActivationFunction::GELU_TANH:
+                    {
+                        const float fin = static_cast<float>(in);
+                        tmp = in * static_cast<T>(0.5f * (1.0f + std::tanh(0.7978845608f * fin * (1.0f + 0.044715f * fin * fin))));
+                        break;
+                    }
                     default:
                         ARM_COMPUTE_ERROR("Unsupported activation function");
                 }
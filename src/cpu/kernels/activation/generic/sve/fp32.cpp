@@ -130,6 +130,12 @@ void sve_fp32_activation(const ITensor *src, ITensor *dst, const ActivationLayer
                             svinv_f32_z(pg, svadd_f32_z(pg, const_1,
                                                         svexp_f32_z(pg, svneg_f32_z(pg, svmul_f32_z(pg, va, vin))))));
                         break;
+                    case ActivationLayerInfo::ActivationFunction::GELU:
+                        tmp = svgelu_f32_z(pg, vin);
+                        break;
+                    case ActivationLayerInfo::ActivationFunction::GELU_TANH:
+                        tmp = svgelu_tanh_f32_z(pg, vin);
+                        break;
                     default:
                         ARM_COMPUTE_ERROR("Unsupported activation function");
                 }
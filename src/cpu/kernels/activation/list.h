@@ -43,6 +43,7 @@ DECLARE_ACTIVATION_KERNEL(neon_qsymm16_activation);
 DECLARE_ACTIVATION_KERNEL(sve2_qsymm16_activation);
 DECLARE_ACTIVATION_KERNEL(sve_fp16_activation);
 DECLARE_ACTIVATION_KERNEL(sve_fp16_activation_lut);
+DECLARE_ACTIVATION_KERNEL(neon_fp16_activation_lut);
 DECLARE_ACTIVATION_KERNEL(sve_fp32_activation);
 DECLARE_ACTIVATION_KERNEL(neon_fp16_activation);
 DECLARE_ACTIVATION_KERNEL(neon_fp32_activation);
@@ -35,6 +35,7 @@ namespace cpu
                    const ConvertPolicy &policy, const Window &window)
 
 DECLARE_ADD_VEC_KERNEL(add_vec_fp32_neon);
+DECLARE_ADD_VEC_KERNEL(add_vec_fp16_neon);
 
 #undef DECLARE_ADD_VEC_KERNEL
 
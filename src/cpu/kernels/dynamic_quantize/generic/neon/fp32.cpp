@@ -0,0 +1,115 @@
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEAsymm.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_dynamic_quantize(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+{
+    const int len = static_cast<int>(src->info()->dimension(0));
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator src_iter(src, win);
+    Iterator dst_iter(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto in  = reinterpret_cast<const float *>(src_iter.ptr());
+            const auto out = reinterpret_cast<int8_t *>(dst_iter.ptr());
+
+            // Largest magnitude of the row, mapped to 127 so that zero stays exactly representable
+            float32x4_t vmax = vdupq_n_f32(0.f);
+            int         x    = 0;
+            for (; x <= len - 4; x += 4)
+            {
+                vmax = vmaxq_f32(vmax, vabsq_f32(vld1q_f32(in + x)));
+            }
+            float32x2_t vmax2 = vpmax_f32(vget_low_f32(vmax), vget_high_f32(vmax));
+            vmax2             = vpmax_f32(vmax2, vmax2);
+            float max_abs     = vget_lane_f32(vmax2, 0);
+            for (; x < len; ++x)
+            {
+                max_abs = std::max(max_abs, std::abs(in[x]));
+            }
+
+            // A row of zeros quantizes to zeros whatever the scale
+            const float scale = (max_abs > 0.f) ? max_abs / 127.f : 1.f;
+            *reinterpret_cast<float *>(scales->ptr_to_element(Coordinates(id.y()))) = scale;
+
+            const UniformQuantizationInfo qinfo(scale, 0);
+            for (x = 0; x <= len - 16; x += 16)
+            {
+                const float32x4x4_t v = {{vld1q_f32(in + x), vld1q_f32(in + x + 4), vld1q_f32(in + x + 8),
+                                          vld1q_f32(in + x + 12)}};
+                vst1q_s8(out + x, vquantize_signed(v, qinfo));
+            }
+            for (; x < len; ++x)
+            {
+                out[x] = quantize_qasymm8_signed(in[x], qinfo);
+            }
+        },
+        src_iter, dst_iter);
+}
+
+void neon_fp32_dynamic_dequantize(const ITensor *src,
+                                  const ITensor *row_scales,
+                                  const ITensor *col_scales,
+                                  const ITensor *bias,
+                                  ITensor       *dst,
+                                  const Window  &window)
+{
+    const int len = static_cast<int>(dst->info()->dimension(0));
+
+    const auto col_scale =
+        reinterpret_cast<const float *>(col_scales->buffer() + col_scales->info()->offset_first_element_in_bytes());
+    const auto bias_ptr =
+        (bias != nullptr) ? reinterpret_cast<const float *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                          : nullptr;
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator src_iter(src, win);
+    Iterator dst_iter(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto acc = reinterpret_cast<const int32_t *>(src_iter.ptr());
+            const auto out = reinterpret_cast<float *>(dst_iter.ptr());
+
+            const float       row_scale  = *reinterpret_cast<const float *>(row_scales->ptr_to_element(Coordinates(id.y())));
+            const float32x4_t vrow_scale = vdupq_n_f32(row_scale);
+
+            int x = 0;
+            for (; x <= len - 4; x += 4)
+            {
+                float32x4_t v =
+                    vmulq_f32(vcvtq_f32_s32(vld1q_s32(acc + x)), vmulq_f32(vld1q_f32(col_scale + x), vrow_scale));
+                if (bias_ptr != nullptr)
+                {
+                    v = vaddq_f32(v, vld1q_f32(bias_ptr + x));
+                }
+                vst1q_f32(out + x, v);
+            }
+            for (; x < len; ++x)
+            {
+                out[x] = static_cast<float>(acc[x]) * col_scale[x] * row_scale + ((bias_ptr != nullptr) ? bias_ptr[x] : 0.f);
+            }
+        },
+        src_iter, dst_iter);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,25 @@
+#ifndef SRC_CPU_KERNELS_DYNAMIC_QUANTIZE_LIST_H
+#define SRC_CPU_KERNELS_DYNAMIC_QUANTIZE_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_DYNAMIC_QUANTIZE_KERNEL(func_name) \
+    void func_name(const ITensor *src, ITensor *dst, ITensor *scales, const Window &window)
+
+DECLARE_DYNAMIC_QUANTIZE_KERNEL(neon_fp32_dynamic_quantize);
+
+#undef DECLARE_DYNAMIC_QUANTIZE_KERNEL
+
+#define DECLARE_DYNAMIC_DEQUANTIZE_KERNEL(func_name)                                                     \
+    void func_name(const ITensor *src, const ITensor *row_scales, const ITensor *col_scales, const ITensor *bias, \
+                   ITensor *dst, const Window &window)
+
+DECLARE_DYNAMIC_DEQUANTIZE_KERNEL(neon_fp32_dynamic_dequantize);
+
+#undef DECLARE_DYNAMIC_DEQUANTIZE_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_DYNAMIC_QUANTIZE_LIST_H
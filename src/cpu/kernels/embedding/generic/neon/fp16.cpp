@@ -0,0 +1,26 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/embedding/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_embedding(const ITensor            *tokens,
+                         const ITensor            *segments,
+                         const ITensor            *token_table,
+                         const ITensor            *segment_table,
+                         const ITensor            *position_table,
+                         const ITensor            *gamma,
+                         const ITensor            *beta,
+                         ITensor                  *dst,
+                         bool                      layer_norm,
+                         const LayerNormLayerInfo &ln_info,
+                         const Window             &window)
+{
+    return neon_embedding<float16_t>(tokens, segments, token_table, segment_table, position_table, gamma, beta, dst,
+                                     layer_norm, ln_info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
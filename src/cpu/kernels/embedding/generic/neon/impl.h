@@ -0,0 +1,141 @@
+#ifndef SRC_CPU_KERNELS_EMBEDDING_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_EMBEDDING_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/layernorm/generic/neon/impl.h"
+#include "src/cpu/kernels/tokenembed/generic/neon/impl.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Token, segment and position embeddings summed in a single pass, optionally followed by layer normalization
+ *
+ * The window spans the token ids along X and the sequences of the batch along Y, ids past the last row of their
+ * table are an error in every build. For every token the three table rows are read and added in registers, so
+ * the only memory written is the [d_model, seq, batch] output. When @p layer_norm is set the statistics of the row are accumulated while the sum is stored and
+ * the row is normalized in place while it is still in the cache.
+ */
+template <typename T>
+void neon_embedding(const ITensor            *tokens,
+                    const ITensor            *segments,
+                    const ITensor            *token_table,
+                    const ITensor            *segment_table,
+                    const ITensor            *position_table,
+                    const ITensor            *gamma,
+                    const ITensor            *beta,
+                    ITensor                  *dst,
+                    bool                      layer_norm,
+                    const LayerNormLayerInfo &ln_info,
+                    const Window             &window)
+{
+    using namespace layernorm;
+    using namespace token_embed;
+
+    /* Runtime reshape valid tensor region if input has been reshaped during preprocess */
+    const size_t reshape_input_x = tokens->info()->valid_region().shape.x();
+    if (tokens->info()->tensor_shape().x() != reshape_input_x)
+    {
+        dst->info()->set_valid_region(dst->info()->valid_region().set(0, 0, reshape_input_x));
+    }
+
+    constexpr int      window_step_x  = 8;
+    const unsigned int window_start_x = static_cast<unsigned int>(window.x().start());
+    const unsigned int window_end_x   = static_cast<unsigned int>(window.x().end());
+    const int          len            = static_cast<int>(token_table->info()->dimension(0));
+
+    const uint32_t last_token   = static_cast<uint32_t>(token_table->info()->dimension(1) - 1);
+    const uint32_t last_segment = static_cast<uint32_t>(segment_table->info()->dimension(1) - 1);
+
+    const size_t   token_stride_y    = token_table->info()->strides_in_bytes().y();
+    const size_t   segment_stride_y  = segment_table->info()->strides_in_bytes().y();
+    const size_t   position_stride_y = position_table->info()->strides_in_bytes().y();
+    const size_t   dst_stride_y      = dst->info()->strides_in_bytes().y();
+    const size_t   dst_stride_z      = dst->info()->strides_in_bytes().z();
+    const uint8_t *token_base    = token_table->buffer() + token_table->info()->offset_first_element_in_bytes();
+    const uint8_t *segment_base  = segment_table->buffer() + segment_table->info()->offset_first_element_in_bytes();
+    const uint8_t *position_base = position_table->buffer() + position_table->info()->offset_first_element_in_bytes();
+    uint8_t       *dst_base      = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    const AffineParams<T> params(gamma, beta, ln_info);
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator token_iter(tokens, win);
+    Iterator segment_iter(segments, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto token_ids   = reinterpret_cast<const uint32_t *>(token_iter.ptr());
+            const auto segment_ids = reinterpret_cast<const uint32_t *>(segment_iter.ptr());
+            uint8_t   *dst_seq     = dst_base + id.y() * dst_stride_z;
+
+            for (unsigned int x = window_start_x; x < window_end_x; ++x)
+            {
+                // The token table is the only one too large for the caches
+                if (x + prefetch_distance < window_end_x)
+                {
+                    prefetch_row(token_base + std::min(token_ids[x + prefetch_distance], last_token) * token_stride_y,
+                                 len * sizeof(T));
+                }
+
+                if (token_ids[x] > last_token || segment_ids[x] > last_segment)
+                {
+                    ARM_COMPUTE_ERROR_VAR("Token id %u or segment id %u is out of range of the %u-row token and %u-row "
+                                          "segment tables",
+                                          token_ids[x], segment_ids[x], last_token + 1, last_segment + 1);
+                }
+                const auto tok = reinterpret_cast<const T *>(token_base + token_ids[x] * token_stride_y);
+                const auto seg = reinterpret_cast<const T *>(segment_base + segment_ids[x] * segment_stride_y);
+                const auto pos     = reinterpret_cast<const T *>(position_base + x * position_stride_y);
+                const auto out_ptr = reinterpret_cast<T *>(dst_seq + x * dst_stride_y);
+
+                const float       shift  = layer_norm ? static_cast<float>(tok[0] + seg[0] + pos[0]) : 0.f;
+                const float32x4_t vshift = vdupq_n_f32(shift);
+                RowStats          stats{};
+
+                int i = 0;
+                for (; i <= len - window_step_x; i += window_step_x)
+                {
+                    const float32x4_t s0 =
+                        vaddq_f32(vaddq_f32(load_f32(tok + i), load_f32(seg + i)), load_f32(pos + i));
+                    const float32x4_t s1 =
+                        vaddq_f32(vaddq_f32(load_f32(tok + i + 4), load_f32(seg + i + 4)), load_f32(pos + i + 4));
+                    store_f32(out_ptr + i, s0);
+                    store_f32(out_ptr + i + 4, s1);
+                    if (layer_norm)
+                    {
+                        stats.add(vsubq_f32(s0, vshift), vsubq_f32(s1, vshift));
+                    }
+                }
+                for (; i < len; ++i)
+                {
+                    const float s = static_cast<float>(tok[i]) + static_cast<float>(seg[i]) + static_cast<float>(pos[i]);
+                    out_ptr[i]    = static_cast<T>(s);
+                    stats.add(s - shift);
+                }
+
+                if (layer_norm)
+                {
+                    float mean = 0.f;
+                    float rstd = 0.f;
+                    stats.finalize(shift, len, ln_info.epsilon(), mean, rstd);
+                    normalize_row<T>(out_ptr, out_ptr, len, mean, rstd, params);
+                }
+            }
+        },
+        token_iter, segment_iter);
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_EMBEDDING_GENERIC_NEON_IMPL_H
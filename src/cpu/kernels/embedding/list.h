@@ -0,0 +1,21 @@
+#ifndef SRC_CPU_KERNELS_EMBEDDING_LIST_H
+#define SRC_CPU_KERNELS_EMBEDDING_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_EMBEDDING_KERNEL(func_name)                                                                 \
+    void func_name(const ITensor *tokens, const ITensor *segments, const ITensor *token_table,             \
+                   const ITensor *segment_table, const ITensor *position_table, const ITensor *gamma,      \
+                   const ITensor *beta, ITensor *dst, bool layer_norm, const LayerNormLayerInfo &ln_info, \
+                   const Window &window)
+
+DECLARE_EMBEDDING_KERNEL(neon_fp32_embedding);
+DECLARE_EMBEDDING_KERNEL(neon_fp16_embedding);
+
+#undef DECLARE_EMBEDDING_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_EMBEDDING_LIST_H
@@ -0,0 +1,21 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/flash_attention/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_flash_attention(const ITensor                              *query,
+                               const ITensor                              *key,
+                               const ITensor                              *value,
+                               const ITensor                              *mask,
+                               ITensor                                    *dst,
+                               const ScaleDotProductionAttentionLayerInfo &info,
+                               const Window                               &window)
+{
+    return neon_flash_attention<float16_t>(query, key, value, mask, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
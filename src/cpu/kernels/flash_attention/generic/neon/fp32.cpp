@@ -0,0 +1,18 @@
+#include "src/cpu/kernels/flash_attention/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_flash_attention(const ITensor                              *query,
+                               const ITensor                              *key,
+                               const ITensor                              *value,
+                               const ITensor                              *mask,
+                               ITensor                                    *dst,
+                               const ScaleDotProductionAttentionLayerInfo &info,
+                               const Window                               &window)
+{
+    return neon_flash_attention<float>(query, key, value, mask, dst, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,411 @@
+#ifndef SRC_CPU_KERNELS_FLASH_ATTENTION_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_FLASH_ATTENTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace flash_attention
+{
+/** Number of query rows sharing a single pass over a key/value block */
+constexpr int query_block = 4;
+/** Number of key/value rows streamed per block */
+constexpr int key_block = 64;
+/** Largest supported head depth, must match @ref kernels::CpuFlashAttentionKernel::max_head_dim */
+constexpr int max_head_dim = 256;
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    float32x2_t r = vadd_f32(vget_high_f32(v), vget_low_f32(v));
+    r             = vpadd_f32(r, r);
+    return vget_lane_f32(r, 0);
+#endif // __aarch64__
+}
+
+/** Load a row converting it to F32 and multiplying it by @p scale */
+inline void load_row(float *dst, const float *src, float scale, int len)
+{
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    int               i      = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vst1q_f32(dst + i, vmulq_f32(vld1q_f32(src + i), vscale));
+    }
+    for (; i < len; ++i)
+    {
+        dst[i] = src[i] * scale;
+    }
+}
+
+/** Dot product of a F32 row with a row of the key tensor */
+inline float dot(const float *a, const float *b, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    int         i    = 0;
+    for (; i <= len - 8; i += 8)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    for (; i <= len - 4; i += 4)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+    float res = reduce_add(vaddq_f32(acc0, acc1));
+    for (; i < len; ++i)
+    {
+        res += a[i] * b[i];
+    }
+    return res;
+}
+
+/** Accumulate acc += p * v for a row of the value tensor */
+inline void axpy(float *acc, float p, const float *v, int len)
+{
+    int i = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vst1q_f32(acc + i, vmlaq_n_f32(vld1q_f32(acc + i), vld1q_f32(v + i), p));
+    }
+    for (; i < len; ++i)
+    {
+        acc[i] += p * v[i];
+    }
+}
+
+/** Store acc * scale into a row of the destination tensor */
+inline void store_row(float *dst, const float *acc, float scale, int len)
+{
+    int i = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vst1q_f32(dst + i, vmulq_n_f32(vld1q_f32(acc + i), scale));
+    }
+    for (; i < len; ++i)
+    {
+        dst[i] = acc[i] * scale;
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+/** F16 rows are widened to F32 on load, the scores and the context are always accumulated in F32 */
+inline void load_row(float *dst, const float16_t *src, float scale, int len)
+{
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    int               i      = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vst1q_f32(dst + i, vmulq_f32(vcvt_f32_f16(vld1_f16(src + i)), vscale));
+    }
+    for (; i < len; ++i)
+    {
+        dst[i] = static_cast<float>(src[i]) * scale;
+    }
+}
+
+inline float dot(const float *a, const float16_t *b, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    int         i    = 0;
+    for (; i <= len - 8; i += 8)
+    {
+        const float16x8_t vb = vld1q_f16(b + i);
+        acc0                 = vmlaq_f32(acc0, vld1q_f32(a + i), vcvt_f32_f16(vget_low_f16(vb)));
+        acc1                 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vcvt_f32_f16(vget_high_f16(vb)));
+    }
+    for (; i <= len - 4; i += 4)
+    {
+        acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vcvt_f32_f16(vld1_f16(b + i)));
+    }
+    float res = reduce_add(vaddq_f32(acc0, acc1));
+    for (; i < len; ++i)
+    {
+        res += a[i] * static_cast<float>(b[i]);
+    }
+    return res;
+}
+
+inline void axpy(float *acc, float p, const float16_t *v, int len)
+{
+    int i = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vst1q_f32(acc + i, vmlaq_n_f32(vld1q_f32(acc + i), vcvt_f32_f16(vld1_f16(v + i)), p));
+    }
+    for (; i < len; ++i)
+    {
+        acc[i] += p * static_cast<float>(v[i]);
+    }
+}
+
+inline void store_row(float16_t *dst, const float *acc, float scale, int len)
+{
+    int i = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vst1_f16(dst + i, vcvt_f16_f32(vmulq_n_f32(vld1q_f32(acc + i), scale)));
+    }
+    for (; i < len; ++i)
+    {
+        dst[i] = static_cast<float16_t>(acc[i] * scale);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+inline void scale_acc(float *acc, float scale, int len)
+{
+    int i = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vst1q_f32(acc + i, vmulq_n_f32(vld1q_f32(acc + i), scale));
+    }
+    for (; i < len; ++i)
+    {
+        acc[i] *= scale;
+    }
+}
+
+inline float row_max(const float *row, int len)
+{
+    float32x4_t vmax = vdupq_n_f32(-std::numeric_limits<float>::infinity());
+    int         i    = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        vmax = vmaxq_f32(vmax, vld1q_f32(row + i));
+    }
+#ifdef __aarch64__
+    float res = vmaxvq_f32(vmax);
+#else  // __aarch64__
+    float32x2_t r = vpmax_f32(vget_high_f32(vmax), vget_low_f32(vmax));
+    r             = vpmax_f32(r, r);
+    float res     = vget_lane_f32(r, 0);
+#endif // __aarch64__
+    for (; i < len; ++i)
+    {
+        res = std::max(res, row[i]);
+    }
+    return res;
+}
+
+/** In place row = exp(row - max), returns the sum of the exponentials */
+inline float exp_row(float *row, float max, int len)
+{
+    const float32x4_t vmax = vdupq_n_f32(max);
+    float32x4_t       vsum = vdupq_n_f32(0.f);
+    int               i    = 0;
+    for (; i <= len - 4; i += 4)
+    {
+        const float32x4_t e = vexpq_f32(vsubq_f32(vld1q_f32(row + i), vmax));
+        vst1q_f32(row + i, e);
+        vsum = vaddq_f32(vsum, e);
+    }
+    float sum = reduce_add(vsum);
+    for (; i < len; ++i)
+    {
+        row[i] = std::exp(row[i] - max);
+        sum += row[i];
+    }
+    return sum;
+}
+} // namespace flash_attention
+
+/** Fused scale dot production attention
+ *
+ * The window spans the heads along X and the query tokens along Y. For each block of query rows the
+ * key/value rows of the head are streamed in blocks of @ref flash_attention::key_block rows, the running
+ * maximum and exponential sum of every row are rescaled on the fly (online softmax) and the weighted
+ * sum of the values is accumulated in F32.
+ *
+ * With a @ref AttentionMaskType::VALID_LENGTH mask the key/value rows past the valid length of the sequence
+ * are never read and the padded query rows are written as zeros. With a @ref AttentionMaskType::ADDITIVE mask
+ * the bias is added to the scaled scores before the running maximum is updated.
+ */
+template <typename T>
+void neon_flash_attention(const ITensor                              *query,
+                          const ITensor                              *key,
+                          const ITensor                              *value,
+                          const ITensor                              *mask,
+                          ITensor                                    *dst,
+                          const ScaleDotProductionAttentionLayerInfo &info,
+                          const Window                               &window)
+{
+    using namespace flash_attention;
+
+    const int   head_dim = static_cast<int>(info.d_model() / info.h());
+    const float scale    = 1.f / std::sqrt(static_cast<float>(head_dim));
+    const int   seq_k    = static_cast<int>(key->info()->dimension(1));
+
+    const size_t q_stride_y   = query->info()->strides_in_bytes().y();
+    const size_t k_stride_y   = key->info()->strides_in_bytes().y();
+    const size_t v_stride_y   = value->info()->strides_in_bytes().y();
+    const size_t dst_stride_y = dst->info()->strides_in_bytes().y();
+
+    const int head_start = window.x().start();
+    const int head_end   = window.x().end();
+    const int y_start    = window.y().start();
+    const int y_end      = window.y().end();
+
+    const AttentionMaskType mask_type = (mask != nullptr) ? info.mask_type() : AttentionMaskType::NONE;
+
+    // Additive masks broadcast along the query rows and the batches when those dimensions are 1
+    const uint8_t *mask_base     = nullptr;
+    size_t         mask_stride_y = 0;
+    size_t         mask_stride_z = 0;
+    if (mask_type == AttentionMaskType::ADDITIVE)
+    {
+        mask_base     = mask->buffer() + mask->info()->offset_first_element_in_bytes();
+        mask_stride_y = mask->info()->dimension(1) > 1 ? mask->info()->strides_in_bytes().y() : 0;
+        mask_stride_z = mask->info()->dimension(2) > 1 ? mask->info()->strides_in_bytes().z() : 0;
+    }
+
+    float q_buf[query_block][max_head_dim];
+    float acc[query_block][max_head_dim];
+    float scores[query_block][key_block];
+    float max_val[query_block];
+    float sum_val[query_block];
+
+    // Heads and query rows are handled manually, the window loop only walks the batch dimensions
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator q_it(query, win);
+    Iterator k_it(key, win);
+    Iterator v_it(value, win);
+    Iterator dst_it(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const uint8_t *q_ptr   = q_it.ptr();
+            const uint8_t *k_ptr   = k_it.ptr();
+            const uint8_t *v_ptr   = v_it.ptr();
+            uint8_t       *dst_ptr = dst_it.ptr();
+
+            // Padded positions of the sequence are skipped altogether
+            int kv_len = seq_k;
+            int q_end  = y_end;
+            if (mask_type == AttentionMaskType::VALID_LENGTH)
+            {
+                const int32_t valid_len = *reinterpret_cast<const int32_t *>(mask->ptr_to_element(Coordinates(id.z())));
+                kv_len                  = utility::clamp<int>(valid_len, 0, seq_k);
+                q_end                   = utility::clamp<int>(valid_len, y_start, y_end);
+            }
+
+            const uint8_t *mask_ptr = (mask_base != nullptr) ? mask_base + id.z() * mask_stride_z : nullptr;
+
+            for (int head = head_start; head < head_end; ++head)
+            {
+                const int head_offset = head * head_dim;
+
+                for (int y0 = y_start; y0 < q_end; y0 += query_block)
+                {
+                    const int rows = std::min(query_block, q_end - y0);
+
+                    for (int r = 0; r < rows; ++r)
+                    {
+                        const T *q_row = reinterpret_cast<const T *>(q_ptr + (y0 + r) * q_stride_y) + head_offset;
+                        load_row(q_buf[r], q_row, scale, head_dim);
+                        std::fill_n(acc[r], head_dim, 0.f);
+                        max_val[r] = -std::numeric_limits<float>::infinity();
+                        sum_val[r] = 0.f;
+                    }
+
+                    for (int k0 = 0; k0 < kv_len; k0 += key_block)
+                    {
+                        const int cols = std::min(key_block, kv_len - k0);
+
+                        // Scores of the query block against the key block, each key row is reused by all query rows
+                        for (int j = 0; j < cols; ++j)
+                        {
+                            const T *k_row = reinterpret_cast<const T *>(k_ptr + (k0 + j) * k_stride_y) + head_offset;
+                            for (int r = 0; r < rows; ++r)
+                            {
+                                scores[r][j] = dot(q_buf[r], k_row, head_dim);
+                            }
+                        }
+
+                        if (mask_ptr != nullptr)
+                        {
+                            for (int r = 0; r < rows; ++r)
+                            {
+                                const T *mask_row =
+                                    reinterpret_cast<const T *>(mask_ptr + (y0 + r) * mask_stride_y) + k0;
+                                for (int j = 0; j < cols; ++j)
+                                {
+                                    scores[r][j] += static_cast<float>(mask_row[j]);
+                                }
+                            }
+                        }
+
+                        // Online softmax: rescale the previous state to the new running maximum
+                        for (int r = 0; r < rows; ++r)
+                        {
+                            const float new_max = std::max(max_val[r], row_max(scores[r], cols));
+                            if (new_max == -std::numeric_limits<float>::infinity())
+                            {
+                                // Fully masked so far: nothing to accumulate
+                                std::fill_n(scores[r], cols, 0.f);
+                                continue;
+                            }
+                            const float correction = std::exp(max_val[r] - new_max);
+                            if (correction != 1.f)
+                            {
+                                scale_acc(acc[r], correction, head_dim);
+                            }
+                            sum_val[r] = sum_val[r] * correction + exp_row(scores[r], new_max, cols);
+                            max_val[r] = new_max;
+                        }
+
+                        // Accumulate the weighted values
+                        for (int j = 0; j < cols; ++j)
+                        {
+                            const T *v_row = reinterpret_cast<const T *>(v_ptr + (k0 + j) * v_stride_y) + head_offset;
+                            for (int r = 0; r < rows; ++r)
+                            {
+                                axpy(acc[r], scores[r][j], v_row, head_dim);
+                            }
+                        }
+                    }
+
+                    // Normalise and write straight into the merged-head layout
+                    for (int r = 0; r < rows; ++r)
+                    {
+                        T *out_row = reinterpret_cast<T *>(dst_ptr + (y0 + r) * dst_stride_y) + head_offset;
+                        store_row(out_row, acc[r], sum_val[r] > 0.f ? 1.f / sum_val[r] : 0.f, head_dim);
+                    }
+                }
+
+                // Padded query rows
+                for (int y = q_end; y < y_end; ++y)
+                {
+                    T *out_row = reinterpret_cast<T *>(dst_ptr + y * dst_stride_y) + head_offset;
+                    std::fill_n(out_row, head_dim, static_cast<T>(0));
+                }
+            }
+        },
+        q_it, k_it, v_it, dst_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_FLASH_ATTENTION_GENERIC_NEON_IMPL_H
@@ -0,0 +1,19 @@
+#ifndef SRC_CPU_KERNELS_FLASH_ATTENTION_LIST_H
+#define SRC_CPU_KERNELS_FLASH_ATTENTION_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_FLASH_ATTENTION_KERNEL(func_name)                                                              \
+    void func_name(const ITensor *query, const ITensor *key, const ITensor *value, const ITensor *mask, ITensor *dst, \
+                   const ScaleDotProductionAttentionLayerInfo &info, const Window &window)
+
+DECLARE_FLASH_ATTENTION_KERNEL(neon_fp32_flash_attention);
+DECLARE_FLASH_ATTENTION_KERNEL(neon_fp16_flash_attention);
+
+#undef DECLARE_FLASH_ATTENTION_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_FLASH_ATTENTION_LIST_H
@@ -0,0 +1,32 @@
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+
+#include "src/cpu/kernels/layernorm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_bf16_layer_norm(const ITensor            *src,
+                          const ITensor            *gamma,
+                          const ITensor            *beta,
+                          ITensor                  *dst,
+                          const LayerNormLayerInfo &info,
+                          const Window             &window)
+{
+    return neon_layer_norm<bfloat16>(src, gamma, beta, dst, info, window);
+}
+
+void neon_bf16_add_layer_norm(const ITensor            *src0,
+                              const ITensor            *src1,
+                              const ITensor            *gamma,
+                              const ITensor            *beta,
+                              ITensor                  *dst,
+                              ITensor                  *sum,
+                              const LayerNormLayerInfo &info,
+                              const Window             &window)
+{
+    return neon_add_layer_norm<bfloat16>(src0, src1, gamma, beta, dst, sum, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(ARM_COMPUTE_ENABLE_BF16) */
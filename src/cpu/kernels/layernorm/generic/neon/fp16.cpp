@@ -0,0 +1,32 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/layernorm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_layer_norm(const ITensor            *src,
+                          const ITensor            *gamma,
+                          const ITensor            *beta,
+                          ITensor                  *dst,
+                          const LayerNormLayerInfo &info,
+                          const Window             &window)
+{
+    return neon_layer_norm<float16_t>(src, gamma, beta, dst, info, window);
+}
+
+void neon_fp16_add_layer_norm(const ITensor            *src0,
+                              const ITensor            *src1,
+                              const ITensor            *gamma,
+                              const ITensor            *beta,
+                              ITensor                  *dst,
+                              ITensor                  *sum,
+                              const LayerNormLayerInfo &info,
+                              const Window             &window)
+{
+    return neon_add_layer_norm<float16_t>(src0, src1, gamma, beta, dst, sum, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
@@ -0,0 +1,287 @@
+#ifndef SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "support/Bfloat16.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace layernorm
+{
+/** Load 4 elements converting them to F32 */
+inline float32x4_t load_f32(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+/** Store 4 F32 elements converting them to the destination type */
+inline void store_f32(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4_t load_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+inline float32x4_t load_f32(const bfloat16 *ptr)
+{
+    // bfloat16 is the upper half of a F32
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+}
+
+inline void store_f32(bfloat16 *ptr, float32x4_t v)
+{
+    // Round to nearest even before dropping the lower half
+    const uint32x4_t bits = vreinterpretq_u32_f32(v);
+    const uint32x4_t lsb  = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    const uint32x4_t rnd  = vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7FFF)));
+    vst1_u16(reinterpret_cast<uint16_t *>(ptr), vshrn_n_u32(rnd, 16));
+}
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    float32x2_t r = vadd_f32(vget_high_f32(v), vget_low_f32(v));
+    r             = vpadd_f32(r, r);
+    return vget_lane_f32(r, 0);
+#endif // __aarch64__
+}
+
+/** Per-channel affine parameters, either tensors or the scalars of @ref LayerNormLayerInfo */
+template <typename T>
+struct AffineParams
+{
+    AffineParams(const ITensor *gamma, const ITensor *beta, const LayerNormLayerInfo &info)
+        : gamma_ptr(gamma != nullptr ? reinterpret_cast<const T *>(gamma->buffer() +
+                                                                    gamma->info()->offset_first_element_in_bytes())
+                                     : nullptr),
+          beta_ptr(beta != nullptr
+                       ? reinterpret_cast<const T *>(beta->buffer() + beta->info()->offset_first_element_in_bytes())
+                       : nullptr),
+          gamma_s(info.gamma()),
+          beta_s(info.beta())
+    {
+    }
+
+    const T *gamma_ptr;
+    const T *beta_ptr;
+    float    gamma_s;
+    float    beta_s;
+};
+
+/** Accumulates the sum and sum of squares of (row - shift) */
+struct RowStats
+{
+    float32x4_t sum0{vdupq_n_f32(0.f)};
+    float32x4_t sum1{vdupq_n_f32(0.f)};
+    float32x4_t sq0{vdupq_n_f32(0.f)};
+    float32x4_t sq1{vdupq_n_f32(0.f)};
+    float       sum_tail{0.f};
+    float       sq_tail{0.f};
+
+    inline void add(float32x4_t d0, float32x4_t d1)
+    {
+        sum0 = vaddq_f32(sum0, d0);
+        sum1 = vaddq_f32(sum1, d1);
+        sq0  = vmlaq_f32(sq0, d0, d0);
+        sq1  = vmlaq_f32(sq1, d1, d1);
+    }
+
+    inline void add(float d)
+    {
+        sum_tail += d;
+        sq_tail += d * d;
+    }
+
+    /** Compute mean and reciprocal standard deviation of a row of @p len elements */
+    inline void finalize(float shift, int len, float epsilon, float &mean, float &rstd) const
+    {
+        const float inv_len      = 1.f / static_cast<float>(len);
+        const float mean_shifted = (reduce_add(vaddq_f32(sum0, sum1)) + sum_tail) * inv_len;
+        const float mean_sq      = (reduce_add(vaddq_f32(sq0, sq1)) + sq_tail) * inv_len;
+        const float var          = std::max(mean_sq - mean_shifted * mean_shifted, 0.f);
+        mean                     = shift + mean_shifted;
+        rstd                     = 1.f / std::sqrt(var + epsilon);
+    }
+};
+
+/** out = (in - mean) * rstd * gamma + beta */
+template <typename T>
+inline void normalize_row(const T *in_ptr, T *out_ptr, int len, float mean, float rstd, const AffineParams<T> &p)
+{
+    const float32x4_t vmean  = vdupq_n_f32(mean);
+    const float32x4_t vrstd  = vdupq_n_f32(rstd);
+    const float32x4_t vgamma = vdupq_n_f32(p.gamma_s);
+    const float32x4_t vbeta  = vdupq_n_f32(p.beta_s);
+
+    int x = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        const float32x4_t norm = vmulq_f32(vsubq_f32(load_f32(in_ptr + x), vmean), vrstd);
+        const float32x4_t g    = p.gamma_ptr != nullptr ? load_f32(p.gamma_ptr + x) : vgamma;
+        const float32x4_t b    = p.beta_ptr != nullptr ? load_f32(p.beta_ptr + x) : vbeta;
+        store_f32(out_ptr + x, vmlaq_f32(b, norm, g));
+    }
+    for (; x < len; ++x)
+    {
+        const float norm = (static_cast<float>(in_ptr[x]) - mean) * rstd;
+        const float g    = p.gamma_ptr != nullptr ? static_cast<float>(p.gamma_ptr[x]) : p.gamma_s;
+        const float b    = p.beta_ptr != nullptr ? static_cast<float>(p.beta_ptr[x]) : p.beta_s;
+        out_ptr[x]       = static_cast<T>(norm * g + b);
+    }
+}
+} // namespace layernorm
+
+/** Layer normalization along X of every row of @p src
+ *
+ * Mean and variance are computed in a single pass over the row (sum and sum of squares, shifted by the
+ * first element of the row to limit cancellation) and accumulated in F32 whatever the storage type.
+ * The second pass applies the per-channel @p gamma and @p beta, or the scalar ones of @p info when the
+ * tensors are not given.
+ */
+template <typename T>
+void neon_layer_norm(const ITensor            *src,
+                     const ITensor            *gamma,
+                     const ITensor            *beta,
+                     ITensor                  *dst,
+                     const LayerNormLayerInfo &info,
+                     const Window             &window)
+{
+    using namespace layernorm;
+
+    constexpr int         window_step_x = 8;
+    const int             len           = static_cast<int>(src->info()->dimension(0));
+    const AffineParams<T> params(gamma, beta, info);
+
+    Window win = window.collapse_if_possible(window, Window::DimZ);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win);
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const T *>(input.ptr());
+            const auto out_ptr = reinterpret_cast<T *>(output.ptr());
+
+            // Single pass statistics
+            const float       shift  = static_cast<float>(in_ptr[0]);
+            const float32x4_t vshift = vdupq_n_f32(shift);
+            RowStats          stats{};
+
+            int x = 0;
+            for (; x <= len - window_step_x; x += window_step_x)
+            {
+                stats.add(vsubq_f32(load_f32(in_ptr + x), vshift), vsubq_f32(load_f32(in_ptr + x + 4), vshift));
+            }
+            for (; x < len; ++x)
+            {
+                stats.add(static_cast<float>(in_ptr[x]) - shift);
+            }
+
+            float mean = 0.f;
+            float rstd = 0.f;
+            stats.finalize(shift, len, info.epsilon(), mean, rstd);
+
+            // Normalize and apply the affine transformation
+            normalize_row(in_ptr, out_ptr, len, mean, rstd, params);
+        },
+        input, output);
+}
+
+/** Residual addition followed by layer normalization along X
+ *
+ * The sum of a row is written once, to @p sum when the pre-normalization result is requested or straight
+ * into @p dst otherwise, while its statistics are accumulated. The row is then normalized from the
+ * cache-resident sum, so the sum tensor never makes a round trip to memory.
+ */
+template <typename T>
+void neon_add_layer_norm(const ITensor            *src0,
+                         const ITensor            *src1,
+                         const ITensor            *gamma,
+                         const ITensor            *beta,
+                         ITensor                  *dst,
+                         ITensor                  *sum,
+                         const LayerNormLayerInfo &info,
+                         const Window             &window)
+{
+    using namespace layernorm;
+
+    constexpr int         window_step_x = 8;
+    const int             len           = static_cast<int>(src0->info()->dimension(0));
+    const AffineParams<T> params(gamma, beta, info);
+
+    Window win = window.collapse_if_possible(window, Window::DimZ);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input0(src0, win);
+    Iterator input1(src1, win);
+    Iterator output(dst, win);
+    Iterator output_sum(sum != nullptr ? sum : dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto in0_ptr = reinterpret_cast<const T *>(input0.ptr());
+            const auto in1_ptr = reinterpret_cast<const T *>(input1.ptr());
+            const auto out_ptr = reinterpret_cast<T *>(output.ptr());
+            const auto sum_ptr = reinterpret_cast<T *>(output_sum.ptr());
+
+            // Add and accumulate the statistics of the sum
+            const float       shift  = static_cast<float>(in0_ptr[0]) + static_cast<float>(in1_ptr[0]);
+            const float32x4_t vshift = vdupq_n_f32(shift);
+            RowStats          stats{};
+
+            int x = 0;
+            for (; x <= len - window_step_x; x += window_step_x)
+            {
+                const float32x4_t s0 = vaddq_f32(load_f32(in0_ptr + x), load_f32(in1_ptr + x));
+                const float32x4_t s1 = vaddq_f32(load_f32(in0_ptr + x + 4), load_f32(in1_ptr + x + 4));
+                store_f32(sum_ptr + x, s0);
+                store_f32(sum_ptr + x + 4, s1);
+                stats.add(vsubq_f32(s0, vshift), vsubq_f32(s1, vshift));
+            }
+            for (; x < len; ++x)
+            {
+                const float s = static_cast<float>(in0_ptr[x]) + static_cast<float>(in1_ptr[x]);
+                sum_ptr[x]    = static_cast<T>(s);
+                stats.add(s - shift);
+            }
+
+            float mean = 0.f;
+            float rstd = 0.f;
+            stats.finalize(shift, len, info.epsilon(), mean, rstd);
+
+            // Normalize the sum, in place when it is not requested as output
+            normalize_row<T>(sum_ptr, out_ptr, len, mean, rstd, params);
+        },
+        input0, input1, output, output_sum);
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
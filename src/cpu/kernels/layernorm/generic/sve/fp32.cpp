@@ -0,0 +1,90 @@
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_sve.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+void sve_fp32_layer_norm(const ITensor            *src,
+                         const ITensor            *gamma,
+                         const ITensor            *beta,
+                         ITensor                  *dst,
+                         const LayerNormLayerInfo &info,
+                         const Window             &window)
+{
+    const int   len     = static_cast<int>(src->info()->dimension(0));
+    const float inv_len = 1.f / static_cast<float>(len);
+
+    const float *gamma_ptr =
+        gamma != nullptr
+            ? reinterpret_cast<const float *>(gamma->buffer() + gamma->info()->offset_first_element_in_bytes())
+            : nullptr;
+    const float *beta_ptr =
+        beta != nullptr
+            ? reinterpret_cast<const float *>(beta->buffer() + beta->info()->offset_first_element_in_bytes())
+            : nullptr;
+    const auto vgamma = svdup_n_f32(info.gamma());
+    const auto vbeta  = svdup_n_f32(info.beta());
+
+    Window win = window.collapse_if_possible(window, Window::DimZ);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win);
+    Iterator output(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const float *>(input.ptr());
+            const auto out_ptr = reinterpret_cast<float *>(output.ptr());
+
+            // Single pass statistics, shifted by the first element to limit cancellation
+            const float shift  = in_ptr[0];
+            const auto  vshift = svdup_n_f32(shift);
+            auto        vsum   = svdup_n_f32(0.f);
+            auto        vsq    = svdup_n_f32(0.f);
+
+            int      x  = 0;
+            svbool_t pg = svwhilelt_b32(x, len);
+            do
+            {
+                const auto d = svsub_f32_z(pg, svld1_f32(pg, in_ptr + x), vshift);
+                vsum         = svadd_f32_m(pg, vsum, d);
+                vsq          = svmla_f32_m(pg, vsq, d, d);
+                x += svcntw();
+                pg = svwhilelt_b32(x, len);
+            } while (svptest_any(svptrue_b32(), pg));
+
+            const float mean_shifted = svaddv_f32(svptrue_b32(), vsum) * inv_len;
+            const float var =
+                std::max(svaddv_f32(svptrue_b32(), vsq) * inv_len - mean_shifted * mean_shifted, 0.f);
+            const auto vmean = svdup_n_f32(shift + mean_shifted);
+            const auto vrstd = svdup_n_f32(1.f / std::sqrt(var + info.epsilon()));
+
+            // Normalize and apply the affine transformation
+            x  = 0;
+            pg = svwhilelt_b32(x, len);
+            do
+            {
+                const auto norm = svmul_f32_z(pg, svsub_f32_z(pg, svld1_f32(pg, in_ptr + x), vmean), vrstd);
+                const auto g    = gamma_ptr != nullptr ? svld1_f32(pg, gamma_ptr + x) : vgamma;
+                const auto b    = beta_ptr != nullptr ? svld1_f32(pg, beta_ptr + x) : vbeta;
+                svst1_f32(pg, out_ptr + x, svmla_f32_z(pg, b, norm, g));
+                x += svcntw();
+                pg = svwhilelt_b32(x, len);
+            } while (svptest_any(svptrue_b32(), pg));
+        },
+        input, output);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(ARM_COMPUTE_ENABLE_SVE) */
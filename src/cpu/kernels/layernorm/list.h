@@ -0,0 +1,30 @@
+#ifndef SRC_CPU_KERNELS_LAYERNORM_LIST_H
+#define SRC_CPU_KERNELS_LAYERNORM_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_LAYERNORM_KERNEL(func_name)                                                      \
+    void func_name(const ITensor *src, const ITensor *gamma, const ITensor *beta, ITensor *dst, \
+                   const LayerNormLayerInfo &info, const Window &window)
+
+DECLARE_LAYERNORM_KERNEL(neon_fp32_layer_norm);
+DECLARE_LAYERNORM_KERNEL(neon_fp16_layer_norm);
+DECLARE_LAYERNORM_KERNEL(neon_bf16_layer_norm);
+DECLARE_LAYERNORM_KERNEL(sve_fp32_layer_norm);
+
+#define DECLARE_ADD_LAYERNORM_KERNEL(func_name)                                                             \
+    void func_name(const ITensor *src0, const ITensor *src1, const ITensor *gamma, const ITensor *beta, \
+                   ITensor *dst, ITensor *sum, const LayerNormLayerInfo &info, const Window &window)
+
+DECLARE_ADD_LAYERNORM_KERNEL(neon_fp32_add_layer_norm);
+DECLARE_ADD_LAYERNORM_KERNEL(neon_fp16_add_layer_norm);
+DECLARE_ADD_LAYERNORM_KERNEL(neon_bf16_add_layer_norm);
+
+#undef DECLARE_ADD_LAYERNORM_KERNEL
+#undef DECLARE_LAYERNORM_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_LAYERNORM_LIST_H
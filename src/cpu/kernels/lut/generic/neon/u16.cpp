@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm_compute/core/Error.h"
+
+#include "src/cpu/kernels/lut/list.h"
+
+#ifdef __aarch64__
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace cpu
+{
+void lut_u16_neon(const uint16_t *table, size_t num_strings, size_t size, const uint16_t *input, uint16_t *output)
+{
+    ARM_COMPUTE_UNUSED(num_strings);
+
+    // Neon has no gather load and the table (128KB) is far beyond the reach of TBL, so the lookups are scalar.
+    // The indices are loaded and the results stored a vector at a time, which lets the core keep eight
+    // independent table loads in flight per iteration.
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        const uint16x8_t idx = vld1q_u16(input + i);
+
+        uint16x8_t res = vdupq_n_u16(0);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 0)], res, 0);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 1)], res, 1);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 2)], res, 2);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 3)], res, 3);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 4)], res, 4);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 5)], res, 5);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 6)], res, 6);
+        res            = vsetq_lane_u16(table[vgetq_lane_u16(idx, 7)], res, 7);
+
+        vst1q_u16(output + i, res);
+    }
+    for (; i < size; ++i)
+    {
+        output[i] = table[input[i]];
+    }
+}
+
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // __aarch64__
@@ -0,0 +1,12 @@
+#include "src/cpu/kernels/online_softmax/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_online_softmax(const ITensor *src, const ITensor *mask, ITensor *dst, float scale, const Window &window)
+{
+    return neon_online_softmax<float>(src, mask, dst, scale, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,175 @@
+#ifndef SRC_CPU_KERNELS_ONLINE_SOFTMAX_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_ONLINE_SOFTMAX_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace online_softmax
+{
+/** Four consecutive elements widened to F32, the reductions are always carried out in F32 */
+inline float32x4_t load_f32(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4_t load_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Softmax of one row of scale * src + mask
+ *
+ * The first sweep keeps a running maximum and a running sum per lane: whenever the maximum of a lane grows,
+ * its sum is rescaled by e^(old_max - new_max) before the new terms are accumulated, so the row is only
+ * streamed from memory once. The lanes are merged at the end of the sweep and the second sweep, over a row
+ * that is now in L1, writes the normalised exponentials.
+ */
+template <typename T>
+void softmax_row(const T *src, const T *mask, T *dst, int len, float scale)
+{
+    constexpr int step  = 4;
+    const float   lower = std::numeric_limits<float>::lowest(); // Finite, so that lower - lower is not NaN
+
+    const float32x4_t vscale = vdupq_n_f32(scale);
+
+    float32x4_t vmax = vdupq_n_f32(lower);
+    float32x4_t vsum = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for (; x <= len - step; x += step)
+    {
+        float32x4_t v = vmulq_f32(load_f32(src + x), vscale);
+        if (mask != nullptr)
+        {
+            v = vaddq_f32(v, load_f32(mask + x));
+        }
+        const float32x4_t new_max = vmaxq_f32(vmax, v);
+        vsum = vmlaq_f32(vexpq_f32(vsubq_f32(v, new_max)), vsum, vexpq_f32(vsubq_f32(vmax, new_max)));
+        vmax = new_max;
+    }
+
+    float tail_max = lower;
+    float tail_sum = 0.f;
+    for (int i = x; i < len; ++i)
+    {
+        float v = scale * static_cast<float>(src[i]);
+        if (mask != nullptr)
+        {
+            v += static_cast<float>(mask[i]);
+        }
+        const float new_max = std::max(tail_max, v);
+        tail_sum            = tail_sum * std::exp(tail_max - new_max) + std::exp(v - new_max);
+        tail_max            = new_max;
+    }
+
+    // Merge the lanes and the leftovers
+    float lane_max[step];
+    float lane_sum[step];
+    vst1q_f32(lane_max, vmax);
+    vst1q_f32(lane_sum, vsum);
+
+    float row_max = tail_max;
+    for (int l = 0; l < step; ++l)
+    {
+        row_max = std::max(row_max, lane_max[l]);
+    }
+    float row_sum = tail_sum * std::exp(tail_max - row_max);
+    for (int l = 0; l < step; ++l)
+    {
+        row_sum += lane_sum[l] * std::exp(lane_max[l] - row_max);
+    }
+
+    const float       inv_sum  = 1.f / row_sum;
+    const float32x4_t vrow_max = vdupq_n_f32(row_max);
+    const float32x4_t vinv_sum = vdupq_n_f32(inv_sum);
+
+    x = 0;
+    for (; x <= len - step; x += step)
+    {
+        float32x4_t v = vmulq_f32(load_f32(src + x), vscale);
+        if (mask != nullptr)
+        {
+            v = vaddq_f32(v, load_f32(mask + x));
+        }
+        store_f32(dst + x, vmulq_f32(vexpq_f32(vsubq_f32(v, vrow_max)), vinv_sum));
+    }
+    for (; x < len; ++x)
+    {
+        float v = scale * static_cast<float>(src[x]);
+        if (mask != nullptr)
+        {
+            v += static_cast<float>(mask[x]);
+        }
+        dst[x] = static_cast<T>(std::exp(v - row_max) * inv_sum);
+    }
+}
+} // namespace online_softmax
+
+/** Row-wise softmax(scale * src + mask) in a single pass over memory
+ *
+ * The window spans the rows of @p src with X collapsed. Row (y, z) of @p mask is added to row (y, z) of
+ * @p src, mask dimensions of size 1 are broadcast.
+ */
+template <typename T>
+void neon_online_softmax(const ITensor *src, const ITensor *mask, ITensor *dst, float scale, const Window &window)
+{
+    const int len = static_cast<int>(src->info()->dimension(0));
+
+    const uint8_t *mask_base     = nullptr;
+    size_t         mask_stride_y = 0;
+    size_t         mask_stride_z = 0;
+    if (mask != nullptr)
+    {
+        mask_base = mask->buffer() + mask->info()->offset_first_element_in_bytes();
+        // Broadcast dimensions never move the mask pointer
+        mask_stride_y = (mask->info()->dimension(1) == 1) ? 0 : mask->info()->strides_in_bytes().y();
+        mask_stride_z = (mask->info()->dimension(2) == 1) ? 0 : mask->info()->strides_in_bytes().z();
+    }
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator src_iter(src, win);
+    Iterator dst_iter(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const T *mask_ptr = nullptr;
+            if (mask_base != nullptr)
+            {
+                mask_ptr = reinterpret_cast<const T *>(mask_base + id.y() * mask_stride_y + id.z() * mask_stride_z);
+            }
+            online_softmax::softmax_row(reinterpret_cast<const T *>(src_iter.ptr()), mask_ptr,
+                                        reinterpret_cast<T *>(dst_iter.ptr()), len, scale);
+        },
+        src_iter, dst_iter);
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_ONLINE_SOFTMAX_GENERIC_NEON_IMPL_H
@@ -0,0 +1,18 @@
+#ifndef SRC_CPU_KERNELS_ONLINE_SOFTMAX_LIST_H
+#define SRC_CPU_KERNELS_ONLINE_SOFTMAX_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_ONLINE_SOFTMAX_KERNEL(func_name) \
+    void func_name(const ITensor *src, const ITensor *mask, ITensor *dst, float scale, const Window &window)
+
+DECLARE_ONLINE_SOFTMAX_KERNEL(neon_fp32_online_softmax);
+DECLARE_ONLINE_SOFTMAX_KERNEL(neon_fp16_online_softmax);
+
+#undef DECLARE_ONLINE_SOFTMAX_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_ONLINE_SOFTMAX_LIST_H
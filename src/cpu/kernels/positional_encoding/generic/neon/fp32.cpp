@@ -0,0 +1,12 @@
+#include "src/cpu/kernels/positional_encoding/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_positional_encoding(const ITensor *src, const ITensor *table, ITensor *dst, const Window &window)
+{
+    return neon_positional_encoding<float>(src, table, dst, window);
+}
+} // namespace cpu
+} // namespace arm_compute
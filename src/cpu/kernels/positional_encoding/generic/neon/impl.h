@@ -0,0 +1,56 @@
+#ifndef SRC_CPU_KERNELS_POSITIONAL_ENCODING_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_POSITIONAL_ENCODING_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Add the precomputed encoding table to the embeddings
+ *
+ * The window spans the [seq, batch] rows of @p dst with X collapsed: row y of every sequence gets row y
+ * of the table added, so the work is a plain vectorised add of two streams.
+ */
+template <typename T>
+void neon_positional_encoding(const ITensor *src, const ITensor *table, ITensor *dst, const Window &window)
+{
+    constexpr int window_step_x = 16 / sizeof(T);
+    const int     len           = static_cast<int>(dst->info()->dimension(0));
+
+    const size_t   table_stride_y = table->info()->strides_in_bytes().y();
+    const uint8_t *table_base     = table->buffer() + table->info()->offset_first_element_in_bytes();
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator src_iter(src, win);
+    Iterator dst_iter(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto src_ptr = reinterpret_cast<const T *>(src_iter.ptr());
+            const auto pe_ptr  = reinterpret_cast<const T *>(table_base + id.y() * table_stride_y);
+            const auto dst_ptr = reinterpret_cast<T *>(dst_iter.ptr());
+
+            int x = 0;
+            for (; x <= len - window_step_x; x += window_step_x)
+            {
+                wrapper::vstore(dst_ptr + x, wrapper::vadd(wrapper::vloadq(src_ptr + x), wrapper::vloadq(pe_ptr + x)));
+            }
+            for (; x < len; ++x)
+            {
+                dst_ptr[x] = src_ptr[x] + pe_ptr[x];
+            }
+        },
+        src_iter, dst_iter);
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_POSITIONAL_ENCODING_GENERIC_NEON_IMPL_H
@@ -0,0 +1,18 @@
+#ifndef SRC_CPU_KERNELS_POSITIONAL_ENCODING_LIST_H
+#define SRC_CPU_KERNELS_POSITIONAL_ENCODING_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_POSITIONAL_ENCODING_KERNEL(func_name) \
+    void func_name(const ITensor *src, const ITensor *table, ITensor *dst, const Window &window)
+
+DECLARE_POSITIONAL_ENCODING_KERNEL(neon_fp32_positional_encoding);
+DECLARE_POSITIONAL_ENCODING_KERNEL(neon_fp16_positional_encoding);
+
+#undef DECLARE_POSITIONAL_ENCODING_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_POSITIONAL_ENCODING_LIST_H
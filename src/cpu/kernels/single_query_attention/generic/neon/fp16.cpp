@@ -0,0 +1,24 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/single_query_attention/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_single_query_attention(const ITensor                              *query,
+                                      const ITensor                              *key,
+                                      const ITensor                              *value,
+                                      ITensor                                    *key_cache,
+                                      ITensor                                    *value_cache,
+                                      ITensor                                    *dst,
+                                      const ScaleDotProductionAttentionLayerInfo &info,
+                                      unsigned int                                cache_len,
+                                      const Window                               &window)
+{
+    return neon_single_query_attention<float16_t>(query, key, value, key_cache, value_cache, dst, info, cache_len,
+                                                  window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
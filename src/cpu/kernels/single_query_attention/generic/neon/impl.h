@@ -0,0 +1,118 @@
+#ifndef SRC_CPU_KERNELS_SINGLE_QUERY_ATTENTION_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_SINGLE_QUERY_ATTENTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/flash_attention/generic/neon/impl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Attention of a single new token against the key/value cache
+ *
+ * The window spans the heads along X and the batches along Z. Every head first appends its slice of the
+ * new key/value row at row @p cache_len of the caches, then scores the query against the
+ * @p cache_len + 1 cached keys (a matrix-vector product) with the same online softmax as
+ * @ref neon_flash_attention, so a decoding step costs O(cache_len) instead of recomputing the whole sequence.
+ */
+template <typename T>
+void neon_single_query_attention(const ITensor                              *query,
+                                 const ITensor                              *key,
+                                 const ITensor                              *value,
+                                 ITensor                                    *key_cache,
+                                 ITensor                                    *value_cache,
+                                 ITensor                                    *dst,
+                                 const ScaleDotProductionAttentionLayerInfo &info,
+                                 unsigned int                                cache_len,
+                                 const Window                               &window)
+{
+    using namespace flash_attention;
+
+    const int   head_dim = static_cast<int>(info.d_model() / info.h());
+    const float scale    = 1.f / std::sqrt(static_cast<float>(head_dim));
+    const int   kv_len   = static_cast<int>(cache_len) + 1;
+
+    const size_t kc_stride_y = key_cache->info()->strides_in_bytes().y();
+    const size_t vc_stride_y = value_cache->info()->strides_in_bytes().y();
+
+    const int head_start = window.x().start();
+    const int head_end   = window.x().end();
+
+    float q_buf[max_head_dim];
+    float acc[max_head_dim];
+    float scores[key_block];
+
+    // Heads are handled manually, the window loop only walks the batch dimensions
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator q_it(query, win);
+    Iterator k_it(key, win);
+    Iterator v_it(value, win);
+    Iterator kc_it(key_cache, win);
+    Iterator vc_it(value_cache, win);
+    Iterator dst_it(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            for (int head = head_start; head < head_end; ++head)
+            {
+                const int head_offset = head * head_dim;
+
+                // Append the new token, each head only writes its own slice of the cached rows
+                std::memcpy(reinterpret_cast<T *>(kc_it.ptr() + cache_len * kc_stride_y) + head_offset,
+                            reinterpret_cast<const T *>(k_it.ptr()) + head_offset, head_dim * sizeof(T));
+                std::memcpy(reinterpret_cast<T *>(vc_it.ptr() + cache_len * vc_stride_y) + head_offset,
+                            reinterpret_cast<const T *>(v_it.ptr()) + head_offset, head_dim * sizeof(T));
+
+                load_row(q_buf, reinterpret_cast<const T *>(q_it.ptr()) + head_offset, scale, head_dim);
+                std::fill_n(acc, head_dim, 0.f);
+
+                float max_val = -std::numeric_limits<float>::infinity();
+                float sum_val = 0.f;
+
+                for (int k0 = 0; k0 < kv_len; k0 += key_block)
+                {
+                    const int cols = std::min(key_block, kv_len - k0);
+
+                    for (int j = 0; j < cols; ++j)
+                    {
+                        const T *k_row = reinterpret_cast<const T *>(kc_it.ptr() + (k0 + j) * kc_stride_y) + head_offset;
+                        scores[j]      = dot(q_buf, k_row, head_dim);
+                    }
+
+                    // Rescale what has been accumulated so far to the new running maximum
+                    const float new_max    = std::max(max_val, row_max(scores, cols));
+                    const float correction = std::exp(max_val - new_max);
+                    sum_val                = sum_val * correction + exp_row(scores, new_max, cols);
+                    scale_acc(acc, correction, head_dim);
+                    max_val = new_max;
+
+                    for (int j = 0; j < cols; ++j)
+                    {
+                        const T *v_row = reinterpret_cast<const T *>(vc_it.ptr() + (k0 + j) * vc_stride_y) + head_offset;
+                        axpy(acc, scores[j], v_row, head_dim);
+                    }
+                }
+
+                store_row(reinterpret_cast<T *>(dst_it.ptr()) + head_offset, acc, 1.f / sum_val, head_dim);
+            }
+        },
+        q_it, k_it, v_it, kc_it, vc_it, dst_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_SINGLE_QUERY_ATTENTION_GENERIC_NEON_IMPL_H
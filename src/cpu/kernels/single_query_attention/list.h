@@ -0,0 +1,20 @@
+#ifndef SRC_CPU_KERNELS_SINGLE_QUERY_ATTENTION_LIST_H
+#define SRC_CPU_KERNELS_SINGLE_QUERY_ATTENTION_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_SINGLE_QUERY_ATTENTION_KERNEL(func_name)                                                         \
+    void func_name(const ITensor *query, const ITensor *key, const ITensor *value, ITensor *key_cache,          \
+                   ITensor *value_cache, ITensor *dst, const ScaleDotProductionAttentionLayerInfo &info,        \
+                   unsigned int cache_len, const Window &window)
+
+DECLARE_SINGLE_QUERY_ATTENTION_KERNEL(neon_fp32_single_query_attention);
+DECLARE_SINGLE_QUERY_ATTENTION_KERNEL(neon_fp16_single_query_attention);
+
+#undef DECLARE_SINGLE_QUERY_ATTENTION_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_SINGLE_QUERY_ATTENTION_LIST_H
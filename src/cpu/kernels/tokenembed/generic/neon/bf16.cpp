@@ -0,0 +1,17 @@
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+
+#include "src/cpu/kernels/tokenembed/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_bf16_token_embed(
+    const ITensor *src, const ITensor *vocab, ITensor *dst, const EmbeddingLayerInfo &tkemb_info, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(tkemb_info);
+    return neon_token_embed<bfloat16>(src, vocab, dst, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(ARM_COMPUTE_ENABLE_BF16) */
@@ -0,0 +1,17 @@
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/tokenembed/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_token_embed(
+    const ITensor *src, const ITensor *vocab, ITensor *dst, const EmbeddingLayerInfo &tkemb_info, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(tkemb_info);
+    return neon_token_embed<float16_t>(src, vocab, dst, window);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
@@ -0,0 +1,185 @@
+#ifndef SRC_CPU_KERNELS_TOKENEMBED_GENERIC_NEON_IMPL_H
+#define SRC_CPU_KERNELS_TOKENEMBED_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "support/Bfloat16.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace token_embed
+{
+/** Number of tokens ahead of the current one whose table row is prefetched */
+constexpr unsigned int prefetch_distance = 2;
+/** Cache line size assumed by the prefetches */
+constexpr size_t cache_line = 64;
+
+/** Dequantisation parameters of an integer table, unused for floating point tables */
+struct DequantParams
+{
+    DequantParams(const ITensorInfo *vocab)
+        : scale(vocab->quantization_info().uniform().scale),
+          offset(vocab->quantization_info().uniform().offset),
+          row_scales(vocab->data_type() == DataType::QSYMM8_PER_CHANNEL ? vocab->quantization_info().scale().data()
+                                                                          : nullptr)
+    {
+    }
+    float        scale;
+    int32_t      offset;
+    const float *row_scales; /**< One scale per table row for per-channel quantised tables */
+};
+
+inline void prefetch_row(const uint8_t *row, size_t row_bytes)
+{
+    for (size_t i = 0; i < row_bytes; i += cache_line)
+    {
+        __builtin_prefetch(row + i);
+    }
+}
+
+/** Copy one table row to the F32 destination, converting or dequantising it */
+inline void convert_row(const float *src, float *dst, unsigned int len, const DequantParams &, unsigned int)
+{
+    std::memcpy(dst, src, len * sizeof(float));
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline void convert_row(const float16_t *src, float *dst, unsigned int len, const DequantParams &, unsigned int)
+{
+    unsigned int x = 0;
+    for (; x + 8 <= len; x += 8)
+    {
+        const float16x8_t v = vld1q_f16(src + x);
+        vst1q_f32(dst + x, vcvt_f32_f16(vget_low_f16(v)));
+        vst1q_f32(dst + x + 4, vcvt_f32_f16(vget_high_f16(v)));
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = static_cast<float>(src[x]);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+inline void convert_row(const bfloat16 *src, float *dst, unsigned int len, const DequantParams &, unsigned int)
+{
+    // bfloat16 is the upper half of a F32
+    const auto   src_u16 = reinterpret_cast<const uint16_t *>(src);
+    unsigned int x       = 0;
+    for (; x + 8 <= len; x += 8)
+    {
+        const uint16x8_t v = vld1q_u16(src_u16 + x);
+        vst1q_f32(dst + x, vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(v), 16)));
+        vst1q_f32(dst + x + 4, vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(v), 16)));
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = static_cast<float>(src[x]);
+    }
+}
+
+inline void convert_row(const int8_t *src, float *dst, unsigned int len, const DequantParams &dq, unsigned int row)
+{
+    const float       scale  = (dq.row_scales != nullptr) ? dq.row_scales[row] : dq.scale;
+    const int32_t     offset = (dq.row_scales != nullptr) ? 0 : dq.offset;
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const int32x4_t   voff   = vdupq_n_s32(offset);
+
+    unsigned int x = 0;
+    for (; x + 8 <= len; x += 8)
+    {
+        const int16x8_t v  = vmovl_s8(vld1_s8(src + x));
+        const int32x4_t lo = vsubq_s32(vmovl_s16(vget_low_s16(v)), voff);
+        const int32x4_t hi = vsubq_s32(vmovl_s16(vget_high_s16(v)), voff);
+        vst1q_f32(dst + x, vmulq_f32(vcvtq_f32_s32(lo), vscale));
+        vst1q_f32(dst + x + 4, vmulq_f32(vcvtq_f32_s32(hi), vscale));
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = static_cast<float>(static_cast<int32_t>(src[x]) - offset) * scale;
+    }
+}
+} // namespace token_embed
+
+/** Gather the table rows of a block of token ids into a F32 [d_model, seq, batch] destination
+ *
+ * The window spans the token ids along X and the sequences of the batch along Y. An id past the last table
+ * row is an error in every build, and the rows of the next tokens are prefetched while the current one is
+ * converted since the table does not fit in the caches.
+ */
+template <typename T>
+void neon_token_embed(const ITensor *src, const ITensor *vocab, ITensor *dst, const Window &window)
+{
+    using namespace token_embed;
+
+    /* Runtime reshape valid tensor region if input has been reshaped during preprocess */
+    const size_t reshape_input_x = src->info()->valid_region().shape.x();
+    if (src->info()->tensor_shape().x() != reshape_input_x)
+    {
+        dst->info()->set_valid_region(dst->info()->valid_region().set(0, 0, reshape_input_x));
+    }
+
+    const unsigned int window_start_x = static_cast<unsigned int>(window.x().start());
+    const unsigned int window_end_x   = static_cast<unsigned int>(window.x().end());
+
+    const unsigned int d_model   = vocab->info()->dimension(0);
+    const uint32_t     last_row  = static_cast<uint32_t>(vocab->info()->dimension(1) - 1);
+    const size_t       row_bytes = d_model * sizeof(T);
+
+    const size_t   vocab_stride_y = vocab->info()->strides_in_bytes().y();
+    const uint8_t *vocab_base     = vocab->buffer() + vocab->info()->offset_first_element_in_bytes();
+    const size_t   dst_stride_y   = dst->info()->strides_in_bytes().y();
+    const size_t   dst_stride_z   = dst->info()->strides_in_bytes().z();
+    uint8_t       *dst_base       = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    const DequantParams dq(vocab->info());
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator src_iter(src, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto ids     = reinterpret_cast<const uint32_t *>(src_iter.ptr());
+            uint8_t   *dst_seq = dst_base + id.y() * dst_stride_z;
+
+            // Ids are checked when their row is gathered, the prefetches are only kept inside the table
+            for (unsigned int x = window_start_x; x < std::min(window_start_x + prefetch_distance, window_end_x); ++x)
+            {
+                prefetch_row(vocab_base + std::min(ids[x], last_row) * vocab_stride_y, row_bytes);
+            }
+
+            for (unsigned int x = window_start_x; x < window_end_x; ++x)
+            {
+                if (x + prefetch_distance < window_end_x)
+                {
+                    prefetch_row(vocab_base + std::min(ids[x + prefetch_distance], last_row) * vocab_stride_y,
+                                 row_bytes);
+                }
+
+                const uint32_t row = ids[x];
+                if (row > last_row)
+                {
+                    ARM_COMPUTE_ERROR_VAR("Token id %u is out of range of the %u-row vocabulary table", row,
+                                          last_row + 1);
+                }
+                convert_row(reinterpret_cast<const T *>(vocab_base + row * vocab_stride_y),
+                            reinterpret_cast<float *>(dst_seq + x * dst_stride_y), d_model, dq, row);
+            }
+        },
+        src_iter);
+}
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // SRC_CPU_KERNELS_TOKENEMBED_GENERIC_NEON_IMPL_H
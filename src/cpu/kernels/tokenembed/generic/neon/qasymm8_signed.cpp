@@ -0,0 +1,14 @@
+#include "src/cpu/kernels/tokenembed/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_qs8_token_embed(
+    const ITensor *src, const ITensor *vocab, ITensor *dst, const EmbeddingLayerInfo &tkemb_info, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(tkemb_info);
+    return neon_token_embed<int8_t>(src, vocab, dst, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -8,13 +8,13 @@ namespace cpu
 #define DECLARE_TOKEN_EMBED_KERNEL(func_name) \
     void func_name(const ITensor *src, const ITensor *vocab, ITensor *dst, const EmbeddingLayerInfo &tkemb_info, const Window &window)
 
-#ifdef __aarch64__
-DECLARE_TOKEN_EMBED_KERNEL(neon_token_embed_char_2_float32);
-#endif // __aarch64__
+DECLARE_TOKEN_EMBED_KERNEL(neon_fp32_token_embed);
+DECLARE_TOKEN_EMBED_KERNEL(neon_fp16_token_embed);
+DECLARE_TOKEN_EMBED_KERNEL(neon_bf16_token_embed);
+DECLARE_TOKEN_EMBED_KERNEL(neon_qs8_token_embed);
 
-#undef DECLARE_ACTIVATION_KERNEL
+#undef DECLARE_TOKEN_EMBED_KERNEL
 } // namespace cpu
 } // namespace arm_compute
 
 #endif // SRC_CPU_KERNELS_TOKEN_EMBED_LIST_H
-
@@ -0,0 +1,44 @@
+#include "src/cpu/operators/CpuAddLayerNorm.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuAddLayerNorm::configure(const ITensorInfo *input1,
+                                const ITensorInfo *input2,
+                                const ITensorInfo *gamma,
+                                const ITensorInfo *beta,
+                                ITensorInfo       *output,
+                                ITensorInfo       *sum,
+                                const LayerNormLayerInfo &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(input1, input2, gamma, beta, output, sum);
+
+    _add_layer_norm_kernel = std::make_unique<kernels::CpuAddLayerNormKernel>();
+    _add_layer_norm_kernel->configure(input1, input2, gamma, beta, output, sum, info);
+}
+
+Status
+CpuAddLayerNorm::validate(const ITensorInfo *input1,
+                          const ITensorInfo *input2,
+                          const ITensorInfo *gamma,
+                          const ITensorInfo *beta,
+                          const ITensorInfo *output,
+                          const ITensorInfo *sum,
+                          const LayerNormLayerInfo &info)
+{
+    return kernels::CpuAddLayerNormKernel::validate(input1, input2, gamma, beta, output, sum, info);
+}
+
+void CpuAddLayerNorm::run(ITensorPack &tensors)
+{
+    NEScheduler::get().schedule_op(_add_layer_norm_kernel.get(), Window::DimY, _add_layer_norm_kernel->window(),
+                                   tensors);
+}
+
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,60 @@
+#ifndef ARM_COMPUTE_CPU_ADD_LAYER_NORM_H
+#define ARM_COMPUTE_CPU_ADD_LAYER_NORM_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuAddLayerNormKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+/** Basic function to run @ref kernels::CpuAddLayerNormKernel
+ * @note Performs residual addition and LayerNorm [LayerNorm(A + B) * gamma + beta]
+*/
+class CpuAddLayerNorm : public ICpuOperator
+{
+public:
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  input1     First addend. Data type supported: F32/F16/BFLOAT16.
+     * @param[in]  input2     Second addend. Data type supported: Same as @p input1.
+     * @param[in]  gamma      Per-channel scale tensor. Can be nullptr, in which case the gamma of @p info is used.
+     * @param[in]  beta       Per-channel offset tensor. Can be nullptr, in which case the beta of @p info is used.
+     * @param[out] output     Normalized output tensor. Data type supported: Same as @p input1.
+     * @param[out] sum        Pre-normalization sum output. Can be nullptr if not required.
+     * @param[in]  info       (Optional)LayerNorm layer operation information
+     */
+    void configure(const ITensorInfo *input1,
+                   const ITensorInfo *input2,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *output,
+                   ITensorInfo       *sum,
+                   const LayerNormLayerInfo& info = LayerNormLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuAddLayerNorm
+     *
+     * Similar to @ref CpuAddLayerNorm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input1,
+                           const ITensorInfo *input2,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           const ITensorInfo *sum,
+                           const LayerNormLayerInfo& info = LayerNormLayerInfo());
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    std::unique_ptr<kernels::CpuAddLayerNormKernel> _add_layer_norm_kernel{nullptr};
+};
+
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_ADD_LAYER_NORM_H */
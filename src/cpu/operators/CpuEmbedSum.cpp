@@ -1,5 +1,6 @@
 #include "src/cpu/operators/CpuEmbedSum.h"
 
+#include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/IOperator.h"
@@ -25,6 +26,8 @@ void CpuEmbedSum::configure(const ITensorInfo *token,
     _add_kernel_1 = std::make_unique<kernels::CpuAddKernel>();
     _add_kernel_2 = std::make_unique<kernels::CpuAddKernel>();
 
+    ARM_COMPUTE_ERROR_THROW_ON(CpuEmbedSum::validate(token, segemnt, position, output, emb_info));
+
     _add_kernel_1->configure(token,segemnt,&_tmp_token_segment,emb_info.c_policy());
     
     _aux_mem[TokenSegmentOutput] =
@@ -32,6 +35,7 @@ void CpuEmbedSum::configure(const ITensorInfo *token,
                                          experimental::MemoryLifetime::Persistent,
                                          _tmp_token_segment.total_size());
     
+    // Position embeddings are broadcast along the batch dimension
     _add_kernel_2->configure(&_tmp_token_segment,position,output,emb_info.c_policy());
 }
 
@@ -42,11 +46,16 @@ CpuEmbedSum::validate(const ITensorInfo *token,
                       ITensorInfo *output,
                       const EmbeddingLayerInfo &emb_info)
 {
-    ARM_COMPUTE_UNUSED(token);
-    ARM_COMPUTE_UNUSED(segemnt);
-    ARM_COMPUTE_UNUSED(position);
     ARM_COMPUTE_UNUSED(output);
-    ARM_COMPUTE_UNUSED(emb_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(token, segemnt, position);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(token, segemnt);
+
+    // Position embeddings [d_model, seq] are shared by all the sequences of a batch
+    ARM_COMPUTE_RETURN_ERROR_ON(position->dimension(0) != token->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(position->dimension(1) != token->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(position->tensor_shape().total_size_upper(2) != 1);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuAddKernel::validate(token, segemnt, token, emb_info.c_policy()));
     return Status{};
 }
 
@@ -62,13 +71,15 @@ void CpuEmbedSum::run(ITensorPack &tensors)
 
 
     ITensorPack run_pack{{ACL_SRC_0, token}, {ACL_SRC_1, segment}, {ACL_DST, aux_token_segemnt.get()}};
-    NEScheduler::get().schedule_op(_add_kernel_1.get(), Window::DimY, _add_kernel_1->window(), run_pack);
+    NEScheduler::get().schedule_op(_add_kernel_1.get(), _add_kernel_1->get_split_dimension(),
+                                   _add_kernel_1->window(), run_pack);
 
     // Add position
     run_pack.add_const_tensor(ACL_SRC_0,aux_token_segemnt.get());
     run_pack.add_const_tensor(ACL_SRC_1,position);
     run_pack.add_tensor(ACL_DST,output);
-    NEScheduler::get().schedule_op(_add_kernel_2.get(), Window::DimY, _add_kernel_2->window(), run_pack);
+    NEScheduler::get().schedule_op(_add_kernel_2.get(), _add_kernel_2->get_split_dimension(),
+                                   _add_kernel_2->window(), run_pack);
 
 
     /*
@@ -18,10 +18,10 @@ class CpuEmbedSum : public ICpuOperator
 public:
     /** Configure operator for a given list of arguments
      *
-     * @param[in]  token        Token embedding input, Data type supported: F32
-     * @param[in]  segemnt      Token embedding input, Data type supported: F32
-     * @param[in]  position     Token embedding input, Data type supported: F32
-     * @param[out] output       Destination tensor info. Data type supported: F32
+     * @param[in]  token        Token embedding input, shape [d_model, seq, batch]. Data type supported: F32
+     * @param[in]  segemnt      Token embedding input, shape [d_model, seq, batch]. Data type supported: F32
+     * @param[in]  position     Token embedding input, shape [d_model, seq], broadcast over the batch. Data type supported: F32
+     * @param[out] output       Destination tensor info, shape [d_model, seq, batch]. Data type supported: F32
      * @param[in]  emb_info     Embedding layer parameters.
      */
     void configure(const ITensorInfo *token,
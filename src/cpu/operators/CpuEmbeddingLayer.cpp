@@ -0,0 +1,116 @@
+#include "src/cpu/operators/CpuEmbeddingLayer.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuEmbeddingLayerKernel.h"
+#include "src/cpu/kernels/CpuPositionalEncodingKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+TensorInfo encoding_table_info(const ITensorInfo *tokens, const ITensorInfo *token_table)
+{
+    // One sinusoidal row for every position of the longest sequence the operator is configured for
+    return token_table->clone()->set_tensor_shape(TensorShape(token_table->dimension(0), tokens->dimension(0)));
+}
+} // namespace
+
+void CpuEmbeddingLayer::configure(const ITensorInfo        *tokens,
+                                  const ITensorInfo        *segments,
+                                  const ITensorInfo        *token_table,
+                                  const ITensorInfo        *segment_table,
+                                  const ITensorInfo        *position_table,
+                                  const ITensorInfo        *gamma,
+                                  const ITensorInfo        *beta,
+                                  ITensorInfo              *dst,
+                                  const EmbeddingLayerInfo &emb_info,
+                                  bool                      layer_norm,
+                                  const LayerNormLayerInfo &ln_info)
+{
+    ARM_COMPUTE_LOG_PARAMS(tokens, segments, token_table, segment_table, position_table, gamma, beta, dst, emb_info);
+    ARM_COMPUTE_UNUSED(emb_info);
+
+    _is_prepared        = false;
+    _use_encoding_table = position_table == nullptr;
+    if (_use_encoding_table)
+    {
+        _encoding_table = encoding_table_info(tokens, token_table);
+        position_table  = &_encoding_table;
+
+        _aux_mem[EncodingTable] = experimental::MemoryInfo(
+            offset_int_vec(EncodingTable), experimental::MemoryLifetime::Persistent, _encoding_table.total_size());
+    }
+
+    auto k = std::make_unique<kernels::CpuEmbeddingLayerKernel>();
+    k->configure(tokens, segments, token_table, segment_table, position_table, gamma, beta, dst, layer_norm, ln_info);
+    _kernel = std::move(k);
+}
+
+Status CpuEmbeddingLayer::validate(const ITensorInfo        *tokens,
+                                   const ITensorInfo        *segments,
+                                   const ITensorInfo        *token_table,
+                                   const ITensorInfo        *segment_table,
+                                   const ITensorInfo        *position_table,
+                                   const ITensorInfo        *gamma,
+                                   const ITensorInfo        *beta,
+                                   const ITensorInfo        *dst,
+                                   const EmbeddingLayerInfo &emb_info,
+                                   bool                      layer_norm,
+                                   const LayerNormLayerInfo &ln_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(tokens, token_table);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(position_table == nullptr && emb_info.pretrained(),
+                                    "Pretrained positional encoding requires a position table");
+
+    const TensorInfo encoding_table = encoding_table_info(tokens, token_table);
+    return kernels::CpuEmbeddingLayerKernel::validate(tokens, segments, token_table, segment_table,
+                                                      position_table != nullptr ? position_table : &encoding_table,
+                                                      gamma, beta, dst, layer_norm, ln_info);
+}
+
+void CpuEmbeddingLayer::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    if (_use_encoding_table)
+    {
+        CpuAuxTensorHandler encoding_table(offset_int_vec(EncodingTable), _encoding_table, tensors);
+
+        ITensorPack pack = tensors;
+        pack.add_const_tensor(ACL_SRC_4, encoding_table.get());
+        NEScheduler::get().schedule_op(_kernel.get(), Window::DimX, _kernel->window(), pack);
+    }
+    else
+    {
+        NEScheduler::get().schedule_op(_kernel.get(), Window::DimX, _kernel->window(), tensors);
+    }
+}
+
+void CpuEmbeddingLayer::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_use_encoding_table)
+        {
+            CpuAuxTensorHandler encoding_table(offset_int_vec(EncodingTable), _encoding_table, tensors);
+            kernels::CpuPositionalEncodingKernel::compute_encoding_table(encoding_table.get());
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuEmbeddingLayer::workspace() const
+{
+    return _aux_mem;
+}
+
+} // namespace cpu
+} // namespace arm_compute
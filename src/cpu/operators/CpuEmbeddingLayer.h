@@ -0,0 +1,87 @@
+#ifndef ARM_COMPUTE_CPU_EMBEDDING_LAYER_H
+#define ARM_COMPUTE_CPU_EMBEDDING_LAYER_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuEmbeddingLayerKernel
+ *
+ * @note Gathers and sums the token, segment and position embeddings of every token in a single pass,
+ *       optionally followed by layer normalization [LayerNorm(T + S + P) * gamma + beta]
+ *
+ * Without a pretrained position table the sinusoidal encoding is computed on the first run into a
+ * persistent auxiliary tensor and gathered like a pretrained table.
+ */
+class CpuEmbeddingLayer : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  tokens         Token id tensor info, shape [seq, batch]. Data types supported: any 32-bit type holding U32 ids.
+     * @param[in]  segments       Segment id tensor info. Shape and data type supported: Same as @p tokens
+     * @param[in]  token_table    Token embedding table info, shape [d_model, vocab_size]. Data type supported: F16/F32
+     * @param[in]  segment_table  Segment embedding table info. Data type supported: Same as @p token_table
+     * @param[in]  position_table Position embedding table info, nullptr to use the sinusoidal encoding.
+     *                            Data type supported: Same as @p token_table
+     * @param[in]  gamma          Per-channel scale tensor info. Can be nullptr, in which case the gamma of @p ln_info is used.
+     * @param[in]  beta           Per-channel offset tensor info. Can be nullptr, in which case the beta of @p ln_info is used.
+     * @param[out] dst            Destination tensor info, shape [d_model, seq, batch]. Data type supported: Same as @p token_table
+     * @param[in]  emb_info       Embedding layer parameters.
+     * @param[in]  layer_norm     (Optional) Normalize the sum of the embeddings
+     * @param[in]  ln_info        (Optional) LayerNorm layer operation information
+     */
+    void configure(const ITensorInfo        *tokens,
+                   const ITensorInfo        *segments,
+                   const ITensorInfo        *token_table,
+                   const ITensorInfo        *segment_table,
+                   const ITensorInfo        *position_table,
+                   const ITensorInfo        *gamma,
+                   const ITensorInfo        *beta,
+                   ITensorInfo              *dst,
+                   const EmbeddingLayerInfo &emb_info,
+                   bool                      layer_norm = false,
+                   const LayerNormLayerInfo &ln_info    = LayerNormLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuEmbeddingLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *tokens,
+                           const ITensorInfo        *segments,
+                           const ITensorInfo        *token_table,
+                           const ITensorInfo        *segment_table,
+                           const ITensorInfo        *position_table,
+                           const ITensorInfo        *gamma,
+                           const ITensorInfo        *beta,
+                           const ITensorInfo        *dst,
+                           const EmbeddingLayerInfo &emb_info,
+                           bool                      layer_norm = false,
+                           const LayerNormLayerInfo &ln_info    = LayerNormLayerInfo());
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        EncodingTable = 0,
+        Count
+    };
+
+    TensorInfo                       _encoding_table{};
+    bool                             _use_encoding_table{false};
+    bool                             _is_prepared{false};
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_EMBEDDING_LAYER_H */
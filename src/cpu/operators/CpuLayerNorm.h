@@ -11,19 +11,25 @@ namespace arm_compute
 namespace cpu
 {
 
-/** Basic function to run @ref kernels::CpuLayerNormKernel 
- * @note Performs LayerNorm function [alpha * A * B + beta * C]
+/** Basic function to run @ref kernels::CpuLayerNormKernel
+ * @note Performs LayerNorm function [(A - mean(A)) / sqrt(var(A) + epsilon) * gamma + beta]
 */
 class CpuLayerNorm : public ICpuOperator
 {
 public:
     /** Initialise the kernel's inputs and output
      *
-     * @param[in]  input      Input tensor. Data type supported: f32.
-     * @param[out] output     Output tensor. Data type supported: F32.
+     * @param[in]  input      Input tensor. Data type supported: F32/F16/BFLOAT16.
+     * @param[in]  gamma      Per-channel scale tensor. Can be nullptr, in which case the gamma of @p info is used.
+     *                        Data type supported: Same as @p input.
+     * @param[in]  beta       Per-channel offset tensor. Can be nullptr, in which case the beta of @p info is used.
+     *                        Data type supported: Same as @p input.
+     * @param[out] output     Output tensor. Data type supported: Same as @p input.
      * @param[in]  info       (Optional)LayerNorm layer operation information
      */
     void configure(const ITensorInfo *input,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
                    ITensorInfo       *output,
                    const LayerNormLayerInfo& info = LayerNormLayerInfo());
     /** Static function to check if given info will lead to a valid configuration of @ref CpuLayerNormKernel
@@ -33,7 +39,9 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *input,
-                           ITensorInfo       *output,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
                            const LayerNormLayerInfo& info = LayerNormLayerInfo());
 
     // Inherited methods overridden:
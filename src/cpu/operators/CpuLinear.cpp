@@ -11,10 +11,35 @@
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+cpu::AsmGemmInfo init_assembly_metadata(const ITensorInfo *b, const LinearLayerInfo &linear_info)
+{
+    const ActivationLayerInfo &act_info = linear_info.activation_info();
+
+    cpu::AsmGemmInfo asm_info;
+    asm_info.method                      = cpu::AsmConvMethod::Im2Col;
+    asm_info.reshape_b_only_on_first_run = b->are_values_constant();
+    // Weights are stored as [in, out]: let the assembly dispatch transpose them while packing
+    asm_info.transpose_b = true;
+    // Fast math lets F32 operands use the BF16 MMLA kernels, the weights are converted to BF16 while they are packed
+    asm_info.fast_mode = linear_info.fast_math();
+    // Activations the output merge can apply are fused there, the others run after the GEMM
+    if (cpu::CpuGemmAssemblyDispatch::is_activation_supported(act_info))
+    {
+        asm_info.activation_info = act_info;
+    }
+
+    return asm_info;
+}
+} // namespace
+
 void CpuLinear::configure(const ITensorInfo *a,
                           const ITensorInfo *b,
                           const ITensorInfo *c,
@@ -23,21 +48,62 @@ void CpuLinear::configure(const ITensorInfo *a,
                           float              beta, const LinearLayerInfo &linear_info)
 {
     ARM_COMPUTE_LOG_PARAMS(a, b, c, d, alpha, beta, linear_info);
-    ARM_COMPUTE_UNUSED(linear_info);
-    ARM_COMPUTE_UNUSED(beta);
 
-    const bool is_c_bias = c != nullptr;
-    const bool run_optimised = false;
+    // Batched inputs [K, seq, batch] run as a single [K, seq * batch] GEMM: the rows of all the sequences are
+    // contiguous, so the batch dimensions are folded into M instead of running one skinny GEMM per sequence
+    _original_a_shape = a->tensor_shape();
+    _original_d_shape = d->tensor_shape();
+    _collapse_batches = a->num_dimensions() > 2;
+
+    TensorInfo a_collapsed = *a->clone();
+    TensorInfo d_collapsed = *d->clone();
+    if (_collapse_batches)
+    {
+        a_collapsed.set_tensor_shape(_original_a_shape.collapsed_from(1));
+        d_collapsed.set_tensor_shape(_original_d_shape.collapsed_from(1));
+        a = &a_collapsed;
+        d = &d_collapsed;
+    }
+
+    const ActivationLayerInfo &act_info  = linear_info.activation_info();
+    const cpu::AsmGemmInfo     asm_info  = init_assembly_metadata(b, linear_info);
+    const bool             is_c_bias = c != nullptr;
+    const bool             run_optimised =
+        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, c, d, asm_info)) &&
+        alpha == 1.f && (c == nullptr || beta == 1.f); // Optimized GeMM doesn't support alpha and beta coefficients.
 
     _run_vector_matrix_multiplication = a->dimension(1) < 2;
     _run_bias_addition                = is_c_bias;
     _reshape_b_only_on_first_run      = b->are_values_constant();
-    
-    if (run_optimised)
-    {
-        _run_interleave_transpose   = false;
+    _is_prepared                      = false;
+    _run_activation =
+        act_info.enabled() && (!run_optimised || !cpu::CpuGemmAssemblyDispatch::is_activation_supported(act_info));
 
-    }else /* Normal matrix multiplication*/
+    if (linear_info.dynamic_quantization_type() != DataType::UNKNOWN)
+    {
+        // Bias and activation are applied in float once the accumulators are dequantized
+        _run_dynamic_quantization = true;
+        _run_interleave_transpose = false;
+        _run_bias_addition        = false;
+        _run_activation           = act_info.enabled();
+        configure_dynamic_quantization(a, b, c, d);
+    }
+    else if (run_optimised)
+    {
+        // Bias is accumulated in the output stage of the assembly kernel
+        _run_interleave_transpose = false;
+        _run_bias_addition        = false;
+        _asm_glue                 = std::make_unique<cpu::CpuGemmAssemblyDispatch>();
+        _asm_glue->configure(a, b, c, d, asm_info);
+        ARM_COMPUTE_ERROR_ON(!_asm_glue->is_configured());
+
+        const auto asm_mem_req = _asm_glue->workspace();
+        for (unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+        {
+            _aux_mem[slot] = asm_mem_req[slot];
+        }
+    }
+    else /* Normal matrix multiplication*/
     {
         _run_interleave_transpose = !_run_vector_matrix_multiplication;
 
@@ -47,7 +113,26 @@ void CpuLinear::configure(const ITensorInfo *a,
         const ITensorInfo *b_to_use = b;
 
         _mm_kernel = std::make_unique<cpu::kernels::CpuGemmMatrixMultiplyKernel>();
-        
+
+        // Weights are stored as [in, out], pretranspose them to the [out, in] layout expected by the GEMM kernels
+        _pretranspose_b_func = std::make_unique<CpuTranspose>();
+        _pretranspose_b_func->configure(b_to_use, &_pretransposed_b);
+        experimental::MemoryLifetime lifetime;
+        if (_reshape_b_only_on_first_run)
+        {
+            // Constant weights are only reshaped in prepare(), the pretransposed copy only needs to
+            // outlive prepare() when it is the final transformation of rhs
+            lifetime = _run_interleave_transpose ? experimental::MemoryLifetime::Prepare
+                                                 : experimental::MemoryLifetime::Persistent;
+        }
+        else
+        {
+            lifetime = experimental::MemoryLifetime::Temporary;
+        }
+        _aux_mem[PreTransposedRHS] =
+            experimental::MemoryInfo(offset_int_vec(PreTransposedRHS), lifetime, _pretransposed_b.total_size());
+        b_to_use = &_pretransposed_b;
+
         if (_run_vector_matrix_multiplication)
         {
             // Configure the matrix multiply kernel
@@ -55,24 +140,21 @@ void CpuLinear::configure(const ITensorInfo *a,
         }
         else
         {
-            _pretranspose_b_func = std::make_unique<CpuTranspose>();
-            _pretranspose_b_func->configure(b_to_use, &_pretransposed_b);
-            _aux_mem[PreTransposedRHS] =
-                experimental::MemoryInfo(offset_int_vec(PreTransposedRHS), experimental::MemoryLifetime::Persistent, _pretransposed_b.total_size());
-            b_to_use = &_pretransposed_b;
-
             // Configure interleave kernel
             _interleave_kernel = std::make_unique<cpu::kernels::CpuGemmInterleave4x4Kernel>();
             _interleave_kernel->configure(a, &_tmp_a);
             _aux_mem[InterleavedLHS] =
-                experimental::MemoryInfo(offset_int_vec(InterleavedLHS), experimental::MemoryLifetime::Persistent, _tmp_a.total_size());
-            
+                experimental::MemoryInfo(offset_int_vec(InterleavedLHS), experimental::MemoryLifetime::Temporary, _tmp_a.total_size());
+
             // Configure rhs transpose1xw kernel
             _transpose1xW_b_kernel = std::make_unique<cpu::kernels::CpuGemmTranspose1xWKernel>();
             _transpose1xW_b_kernel->configure(b_to_use, &_tmp_b);
             _aux_mem[Transposed1xWRHS] =
-                experimental::MemoryInfo(offset_int_vec(Transposed1xWRHS), experimental::MemoryLifetime::Persistent, _tmp_b.total_size());
-            
+                experimental::MemoryInfo(offset_int_vec(Transposed1xWRHS),
+                                         _reshape_b_only_on_first_run ? experimental::MemoryLifetime::Persistent
+                                                                      : experimental::MemoryLifetime::Temporary,
+                                         _tmp_b.total_size());
+
             // Use a and b here instead of _tmp_a and _tmp_b because CpuGemmMatrixMultiplyKernel requires the original m,n,k in case of interleaved a and transposed1xw b
             const int m = a->dimension(1);
             const int n = b_to_use->dimension(0);
@@ -81,22 +163,74 @@ void CpuLinear::configure(const ITensorInfo *a,
             // Configure matrix multiplication kernel
             _mm_kernel->configure(&_tmp_a, &_tmp_b, gemm_output_to_use, alpha, _run_interleave_transpose,
                                   GEMMReshapeInfo(m, n, k));
-
-            std::cout << "gemm_output_to_use x " << gemm_output_to_use->tensor_shape().x() << std::endl;
-            std::cout << "gemm_output_to_use y " << gemm_output_to_use->tensor_shape().y() << std::endl;
-            std::cout << "gemm_output_to_use z " << gemm_output_to_use->tensor_shape().z() << std::endl;
         }
-        
+
         if (_run_bias_addition)
         {
             _add_bias = std::make_unique<cpu::kernels::CpuAddVecKernel>();
             _add_bias->configure(gemm_output_to_use, c, d, Window::DimX, Window::DimX, ConvertPolicy::SATURATE);
             _aux_mem[TempResult] =
-                experimental::MemoryInfo(offset_int_vec(TempResult), experimental::MemoryLifetime::Persistent, _tmp_d.total_size());
+                experimental::MemoryInfo(offset_int_vec(TempResult), experimental::MemoryLifetime::Temporary, _tmp_d.total_size());
         }
     }
 
-    
+    if (_run_activation)
+    {
+        // In place on the destination while it is still warm in cache, no intermediate tensor is needed
+        _activation_func = std::make_unique<CpuActivation>();
+        _activation_func->configure(d, nullptr, act_info);
+    }
+}
+
+void CpuLinear::configure_dynamic_quantization(const ITensorInfo *a,
+                                               const ITensorInfo *b,
+                                               const ITensorInfo *c,
+                                               ITensorInfo       *d)
+{
+    // The input is quantized per row (token) on every run, the weights per output channel: their [in, out]
+    // layout makes every output channel a row, so they are quantized first and transposed afterwards
+    _quantize_a_kernel = std::make_unique<kernels::CpuDynamicQuantizeKernel>();
+    _quantize_a_kernel->configure(a, &_quantized_a, &_a_scales);
+    _quantize_b_kernel = std::make_unique<kernels::CpuDynamicQuantizeKernel>();
+    _quantize_b_kernel->configure(b, &_quantized_b, &_b_scales);
+    _transpose_quantized_b_func = std::make_unique<CpuTranspose>();
+    _transpose_quantized_b_func->configure(&_quantized_b, &_transposed_quantized_b);
+
+    // Both operands have a zero offset, so the GEMM is a plain 8-bit dot product into 32-bit accumulators
+    _gemmlowp_func = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
+    _gemmlowp_func->configure(&_quantized_a, &_transposed_quantized_b, nullptr, &_accumulators,
+                              GEMMInfo(false, false, _reshape_b_only_on_first_run));
+
+    _dequantize_kernel = std::make_unique<kernels::CpuDynamicDequantizeKernel>();
+    _dequantize_kernel->configure(&_accumulators, &_a_scales, &_b_scales, c, d);
+
+    const auto gemm_mem_req = _gemmlowp_func->workspace();
+    for (unsigned int slot = 0; slot < gemm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = gemm_mem_req[slot];
+    }
+
+    using experimental::MemoryInfo;
+    using experimental::MemoryLifetime;
+    const MemoryLifetime weights_lifetime =
+        _reshape_b_only_on_first_run ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
+    // The assembly kernel keeps its own packed copy of the weights (slot 1), the transposed ones are then only
+    // read in prepare()
+    const MemoryLifetime transposed_weights_lifetime =
+        (_reshape_b_only_on_first_run && _aux_mem[1].size > 0) ? MemoryLifetime::Prepare : weights_lifetime;
+
+    _aux_mem[QuantizedLHS] =
+        MemoryInfo(offset_int_vec(QuantizedLHS), MemoryLifetime::Temporary, _quantized_a.total_size());
+    _aux_mem[LHSScales] = MemoryInfo(offset_int_vec(LHSScales), MemoryLifetime::Temporary, _a_scales.total_size());
+    _aux_mem[QuantizedRHS] =
+        MemoryInfo(offset_int_vec(QuantizedRHS),
+                   _reshape_b_only_on_first_run ? MemoryLifetime::Prepare : MemoryLifetime::Temporary,
+                   _quantized_b.total_size());
+    _aux_mem[TransposedQuantizedRHS] = MemoryInfo(offset_int_vec(TransposedQuantizedRHS), transposed_weights_lifetime,
+                                                  _transposed_quantized_b.total_size());
+    _aux_mem[RHSScales] = MemoryInfo(offset_int_vec(RHSScales), weights_lifetime, _b_scales.total_size());
+    _aux_mem[AccumulatorS32] =
+        MemoryInfo(offset_int_vec(AccumulatorS32), MemoryLifetime::Temporary, _accumulators.total_size());
 }
 
 Status
@@ -107,46 +241,100 @@ CpuLinear::validate(const ITensorInfo *a,
                     float              alpha,
                     float              beta, const LinearLayerInfo &linear_info)
 {
-    ARM_COMPUTE_UNUSED(a);
-    ARM_COMPUTE_UNUSED(b);
-    ARM_COMPUTE_UNUSED(c);
-    ARM_COMPUTE_UNUSED(d);
     ARM_COMPUTE_UNUSED(alpha);
     ARM_COMPUTE_UNUSED(beta);
-    ARM_COMPUTE_UNUSED(linear_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, b);
+    // Weights are [in, out]: the reduction dimension is the first one of both operands
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(0), "Input and weights reduction size mismatch");
+    if (c != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(a, c);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(c->dimension(0) != b->dimension(1), "Bias size mismatch");
+    }
+    if (a->num_dimensions() > 2)
+    {
+        // The batch dimensions are folded into the rows of the GEMM
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->strides_in_bytes()[2] != a->strides_in_bytes()[1] * a->dimension(1),
+                                        "Batched input must be contiguous across sequences");
+        if (d->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(a->tensor_shape().total_size_upper(1) != d->tensor_shape().total_size_upper(1));
+        }
+    }
+    if (linear_info.dynamic_quantization_type() != DataType::UNKNOWN)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(linear_info.dynamic_quantization_type() != DataType::QASYMM8_SIGNED,
+                                        "Only signed 8-bit dynamic quantization is supported");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(alpha != 1.f || (c != nullptr && beta != 1.f),
+                                        "Dynamic quantization does not support alpha and beta coefficients");
+    }
+    if (linear_info.activation_info().enabled() && d->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(d, nullptr, linear_info.activation_info()));
+    }
     return Status{};
 }
 
 void CpuLinear::run(ITensorPack &tensors)
 {
-
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    auto a = tensors.get_const_tensor(ACL_SRC_0);
+    auto d = tensors.get_tensor(ACL_DST);
+
+    // Reshape lhs and dst to the [K, seq * batch] and [N, seq * batch] matrices the GEMM was configured with
+    const ValidRegion a_valid_region = a->info()->valid_region();
+    const ValidRegion d_valid_region = d->info()->valid_region();
+    if (_collapse_batches)
+    {
+        a->info()->set_tensor_shape(_original_a_shape.collapsed_from(1));
+        d->info()->set_tensor_shape(_original_d_shape.collapsed_from(1));
+    }
+
+    if (_run_dynamic_quantization)
+    {
+        run_quantized_gemm(tensors);
+    }
+    else
+    {
+        run_gemm(tensors);
+    }
+
+    // Undo reshape of tensors
+    if (_collapse_batches)
+    {
+        a->info()->set_tensor_shape(_original_a_shape);
+        a->info()->set_valid_region(a_valid_region);
+        d->info()->set_tensor_shape(_original_d_shape);
+        d->info()->set_valid_region(d_valid_region);
+    }
+}
+
+void CpuLinear::run_gemm(ITensorPack &tensors)
+{
     auto a = tensors.get_const_tensor(ACL_SRC_0);
     auto b = tensors.get_const_tensor(ACL_SRC_1);
     auto c = tensors.get_const_tensor(ACL_SRC_2);
     auto d = tensors.get_tensor(ACL_DST);
-    /*
-    std::cout <<"Linear x: " << a->info()->tensor_shape().x() << std::endl;
-    std::cout <<"Linear y: " << a->info()->tensor_shape().y() << std::endl;
-    std::cout <<"Linear z: " << a->info()->tensor_shape().z() << std::endl;
-    std::cout << *reinterpret_cast<float *>(a->ptr_to_element(Coordinates(0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(a->ptr_to_element(Coordinates(0,1)))  << std::endl;
-
-    std::cout << *reinterpret_cast<float *>(a->ptr_to_element(Coordinates(1,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(a->ptr_to_element(Coordinates(2,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(a->ptr_to_element(Coordinates(3071,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(a->ptr_to_element(Coordinates(3072,0,0)))  << std::endl;
-    */
 
+    if (_asm_glue && _asm_glue->is_configured())
+    {
+        _asm_glue->run(tensors);
+        run_activation(d);
+        return;
+    }
 
     CpuAuxTensorHandler interleaved_a(offset_int_vec(InterleavedLHS), _tmp_a, tensors, true);
-    CpuAuxTensorHandler pretransposed_b(offset_int_vec(PreTransposedRHS), _pretransposed_b, tensors,true);
+    CpuAuxTensorHandler pretransposed_b(offset_int_vec(PreTransposedRHS), _pretransposed_b, tensors);
     CpuAuxTensorHandler transposed1xw_b(offset_int_vec(Transposed1xWRHS), _tmp_b, tensors, true);
     CpuAuxTensorHandler temp_d(offset_int_vec(TempResult), _tmp_d, tensors, true);
 
     ITensorPack mm_pack{{ACL_SRC_0, a}, {ACL_SRC_1, b}, {ACL_DST, (_run_bias_addition) ? temp_d.get() : d}};
 
-
     if (_run_interleave_transpose)
     {
         // Run interleave kernel
@@ -158,23 +346,26 @@ void CpuLinear::run(ITensorPack &tensors)
     }
 
     const ITensor *b_to_use = b;
-    
     if (_pretranspose_b_func)
     {
-        // Run pretranspose kernel
-        ITensorPack pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pretransposed_b.get()}};
-        _pretranspose_b_func->run(pretranspose_pack);
+        if (!_reshape_b_only_on_first_run)
+        {
+            // Run pretranspose kernel
+            ITensorPack pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pretransposed_b.get()}};
+            _pretranspose_b_func->run(pretranspose_pack);
+        }
         b_to_use = pretransposed_b.get();
     }
-    
 
     if (_run_interleave_transpose)
     {
-        // Run transpose1xw kernel
-        ITensorPack transpose_pack{{ACL_SRC, b_to_use}, {ACL_DST, transposed1xw_b.get()}};
-        NEScheduler::get().schedule_op(_transpose1xW_b_kernel.get(), Window::DimY,
-                                        _transpose1xW_b_kernel->window(), transpose_pack);
-
+        if (!_reshape_b_only_on_first_run)
+        {
+            // Run transpose1xw kernel
+            ITensorPack transpose_pack{{ACL_SRC, b_to_use}, {ACL_DST, transposed1xw_b.get()}};
+            NEScheduler::get().schedule_op(_transpose1xW_b_kernel.get(), Window::DimY,
+                                           _transpose1xW_b_kernel->window(), transpose_pack);
+        }
         b_to_use = transposed1xw_b.get();
     }
 
@@ -187,25 +378,156 @@ void CpuLinear::run(ITensorPack &tensors)
 
     // Run bias addition kernel
     if (_run_bias_addition)
-    {   
+    {
         ITensorPack pack{{ACL_SRC_0, temp_d.get()}, {ACL_SRC_1, c}, {ACL_DST, d}};
         NEScheduler::get().schedule_op(_add_bias.get(), Window::DimX, _add_bias->window(), pack);
     }
 
-    /*
-    std::cout <<"Linear dst x: " << d->info()->tensor_shape().x() << std::endl;
-    std::cout <<"Linear dst y: " << d->info()->tensor_shape().y() << std::endl;
-    std::cout <<"Linear dst z: " << d->info()->tensor_shape().z() << std::endl;
-    std::cout << *reinterpret_cast<float *>(d->ptr_to_element(Coordinates(0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(d->ptr_to_element(Coordinates(0,1)))  << std::endl;
+    run_activation(d);
+}
+
+void CpuLinear::run_quantized_gemm(ITensorPack &tensors)
+{
+    auto a = tensors.get_const_tensor(ACL_SRC_0);
+    auto b = tensors.get_const_tensor(ACL_SRC_1);
+    auto c = tensors.get_const_tensor(ACL_SRC_2);
+    auto d = tensors.get_tensor(ACL_DST);
+
+    CpuAuxTensorHandler quantized_a(offset_int_vec(QuantizedLHS), _quantized_a, tensors, true);
+    CpuAuxTensorHandler a_scales(offset_int_vec(LHSScales), _a_scales, tensors, true);
+    CpuAuxTensorHandler transposed_quantized_b(offset_int_vec(TransposedQuantizedRHS), _transposed_quantized_b, tensors,
+                                               true, _reshape_b_only_on_first_run /*bypass_alloc*/);
+    CpuAuxTensorHandler b_scales(offset_int_vec(RHSScales), _b_scales, tensors, true);
+    CpuAuxTensorHandler accumulators(offset_int_vec(AccumulatorS32), _accumulators, tensors, true);
+
+    if (!_reshape_b_only_on_first_run)
+    {
+        CpuAuxTensorHandler quantized_b(offset_int_vec(QuantizedRHS), _quantized_b, tensors);
+        quantize_weights(b, quantized_b.get(), b_scales.get(), transposed_quantized_b.get());
+    }
+
+    ITensorPack quantize_pack{{ACL_SRC, a}, {ACL_DST_0, quantized_a.get()}, {ACL_DST_1, a_scales.get()}};
+    NEScheduler::get().schedule_op(_quantize_a_kernel.get(), Window::DimY, _quantize_a_kernel->window(), quantize_pack);
+
+    // The float bias is added by the dequantization, the GEMM only accumulates the 8-bit products
+    ITensorPack gemm_pack = tensors;
+    gemm_pack.add_const_tensor(ACL_SRC_0, quantized_a.get());
+    gemm_pack.add_const_tensor(ACL_SRC_1, transposed_quantized_b.get());
+    gemm_pack.add_const_tensor(ACL_SRC_2, nullptr);
+    gemm_pack.add_tensor(ACL_DST, accumulators.get());
+    _gemmlowp_func->run(gemm_pack);
+
+    ITensorPack dequantize_pack{{ACL_SRC_0, accumulators.get()},
+                                {ACL_SRC_1, a_scales.get()},
+                                {ACL_SRC_2, b_scales.get()},
+                                {ACL_SRC_3, c},
+                                {ACL_DST, d}};
+    NEScheduler::get().schedule_op(_dequantize_kernel.get(), Window::DimY, _dequantize_kernel->window(),
+                                   dequantize_pack);
+
+    run_activation(d);
+}
+
+void CpuLinear::quantize_weights(const ITensor *b,
+                                 ITensor       *quantized_b,
+                                 ITensor       *b_scales,
+                                 ITensor       *transposed_quantized_b)
+{
+    ITensorPack quantize_pack{{ACL_SRC, b}, {ACL_DST_0, quantized_b}, {ACL_DST_1, b_scales}};
+    NEScheduler::get().schedule_op(_quantize_b_kernel.get(), Window::DimY, _quantize_b_kernel->window(), quantize_pack);
 
-    std::cout << *reinterpret_cast<float *>(d->ptr_to_element(Coordinates(1,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(d->ptr_to_element(Coordinates(2,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(d->ptr_to_element(Coordinates(767,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(d->ptr_to_element(Coordinates(768,0,0)))  << std::endl;
-    */
+    ITensorPack transpose_pack{{ACL_SRC, quantized_b}, {ACL_DST, transposed_quantized_b}};
+    _transpose_quantized_b_func->run(transpose_pack);
 }
 
+void CpuLinear::run_activation(ITensor *d)
+{
+    if (_run_activation)
+    {
+        ITensorPack pack{{ACL_SRC, d}, {ACL_DST, d}};
+        _activation_func->run(pack);
+    }
+}
+
+void CpuLinear::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_run_dynamic_quantization)
+        {
+            if (_reshape_b_only_on_first_run)
+            {
+                const ITensor      *b = tensors.get_const_tensor(ACL_SRC_1);
+                CpuAuxTensorHandler quantized_b(offset_int_vec(QuantizedRHS), _quantized_b, tensors);
+                CpuAuxTensorHandler transposed_quantized_b(offset_int_vec(TransposedQuantizedRHS),
+                                                           _transposed_quantized_b, tensors);
+                CpuAuxTensorHandler b_scales(offset_int_vec(RHSScales), _b_scales, tensors);
+                quantize_weights(b, quantized_b.get(), b_scales.get(), transposed_quantized_b.get());
+
+                // Let the GEMM pack the quantized weights, the float ones are not needed anymore
+                ITensorPack gemm_pack = tensors;
+                gemm_pack.add_const_tensor(ACL_SRC_1, transposed_quantized_b.get());
+                _gemmlowp_func->prepare(gemm_pack);
+
+                b->mark_as_unused();
+            }
+        }
+        else if (_asm_glue && _asm_glue->is_configured())
+        {
+            // Packs (and transposes) the weights once and releases the original ones
+            _asm_glue->prepare(tensors);
+        }
+        else if (_reshape_b_only_on_first_run)
+        {
+            const ITensor      *b        = tensors.get_const_tensor(ACL_SRC_1);
+            const ITensor      *b_to_use = b;
+            CpuAuxTensorHandler pretransposed_b(
+                offset_int_vec(PreTransposedRHS), _pretransposed_b, tensors,
+                false /*pack_inject: no need to inject into tensors*/,
+                _pretranspose_b_func ==
+                    nullptr /*bypass_alloc: no need to allocate if _pretranspose_b_func is not run*/);
+            CpuAuxTensorHandler transposed1xw_b(offset_int_vec(Transposed1xWRHS), _tmp_b, tensors,
+                                                false /*pack_inject*/, !_run_interleave_transpose /*bypass_alloc*/);
+
+            if (_pretranspose_b_func)
+            {
+                // Run pretranspose kernel
+                ITensorPack pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pretransposed_b.get()}};
+                _pretranspose_b_func->run(pretranspose_pack);
+                b_to_use = pretransposed_b.get();
+            }
+            if (_run_interleave_transpose)
+            {
+                // Run transpose kernel
+                ITensorPack transpose_pack{{ACL_SRC, b_to_use}, {ACL_DST, transposed1xw_b.get()}};
+                NEScheduler::get().schedule_op(_transpose1xW_b_kernel.get(), Window::DimY,
+                                               _transpose1xW_b_kernel->window(), transpose_pack);
+            }
+
+            // The packed copy is used from now on, the original weights can be released
+            b->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
+
+bool CpuLinear::reshapes_b_only_on_first_run() const
+{
+    if (_reshape_b_only_on_first_run && _asm_glue && _asm_glue->is_configured())
+    {
+        // Only the assembly kernels that pretranspose B keep a persistent copy of it, the others read B on every run
+        const auto asm_mem_req = _asm_glue->workspace();
+        return std::any_of(asm_mem_req.begin(), asm_mem_req.end(),
+                           [](const experimental::MemoryInfo &m)
+                           { return m.lifetime == experimental::MemoryLifetime::Persistent && m.size > 0; });
+    }
+    return _reshape_b_only_on_first_run;
+}
+
+experimental::MemoryRequirements CpuLinear::workspace() const
+{
+    return _aux_mem;
+}
 
 } // namespace cpu
 } // namespace arm_compute
@@ -10,24 +10,52 @@
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/kernels/CpuAddVecKernel.h"
+#include "src/cpu/kernels/CpuDynamicDequantizeKernel.h"
+#include "src/cpu/kernels/CpuDynamicQuantizeKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 namespace arm_compute
 {
 namespace cpu
 {
 
-/** Basic function to run @ref kernels::CpuLinearKernel 
+/** Basic function to run the linear (fully connected) projection of transformer layers
+ *
+ * Uses @ref CpuGemmAssemblyDispatch with the bias fused in the output stage when an optimised
+ * assembly kernel is available, otherwise falls back to:
+ *  -# @ref CpuTranspose
+ *  -# @ref kernels::CpuGemmInterleave4x4Kernel
+ *  -# @ref kernels::CpuGemmTranspose1xWKernel
+ *  -# @ref kernels::CpuGemmMatrixMultiplyKernel
+ *  -# @ref kernels::CpuAddVecKernel
+ *
+ * The activation of @ref LinearLayerInfo is applied in the output stage of the assembly kernel when it
+ * supports it, otherwise @ref CpuActivation runs in place on the destination straight after the GEMM.
+ *
+ * With @ref LinearLayerInfo::fast_math() the assembly kernels may compute F32 projections with BF16 operands
+ * and F32 accumulation: the weights are converted to BF16 once, when they are packed in prepare().
+ *
+ * When @ref LinearLayerInfo::dynamic_quantization_type() is QASYMM8_SIGNED the GEMM runs in 8-bit instead:
+ *  -# @ref kernels::CpuDynamicQuantizeKernel (weights per output channel, only on first run when they are constant)
+ *  -# @ref CpuTranspose (quantized weights, only on first run when they are constant)
+ *  -# @ref kernels::CpuDynamicQuantizeKernel (input per row)
+ *  -# @ref CpuGemmLowpMatrixMultiplyCore
+ *  -# @ref kernels::CpuDynamicDequantizeKernel (scales and bias)
+ *
  * @note Performs linear function [alpha * A * B + beta * C]
+ * @note Inputs of shape [K, seq, batch] are computed as a single [K, seq * batch] GEMM
 */
 class CpuLinear : public ICpuOperator
 {
 public:
     /** Initialise the kernel's inputs and output
      *
-     * @param[in]  a      An input tensor. Data type supported: f32.
-     * @param[in]  b      An input tensor. Data type supported: f32.
-     * @param[in]  c      An input bias ensor. Data type supported: f32.
-     * @param[out] d      Output tensor. Data type supported: F32.
+     * @param[in]  a      An input tensor, shape [K, M] or [K, seq, batch]. Data type supported: F16/F32.
+     * @param[in]  b      An input tensor. Data type supported: Same as @p a.
+     * @param[in]  c      An input bias ensor. Data type supported: Same as @p a.
+     * @param[out] d      Output tensor, shape [N, M] or [N, seq, batch]. Data type supported: Same as @p a.
      * @param[in]  alpha  Weight of the matrix product
      * @param[in]  beta   Weight of matrix C
      * @param[in]  info   (Optional)Linear layer operation information
@@ -52,37 +80,83 @@ public:
                            float              alpha,
                            float              beta,
                            const LinearLayerInfo& info = LinearLayerInfo());
+    /** Indicates whether @p b is only read by prepare(), run() then reads a reshaped copy of it
+     *
+     * @return True if @p b is constant and reshaped on first run, false if run() reads it directly
+     */
+    bool reshapes_b_only_on_first_run() const;
 
     // Inherited methods overridden:
-    void run(ITensorPack &tensors) override;
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &constants) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
     enum AuxTensorIdx
     {
-        /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
-        InterleavedLHS = 3,
+        /* Slots 0 - 9 reserved for CpuGemmAssemblyDispatch or CpuGemmLowpMatrixMultiplyCore */
+        InterleavedLHS = 10,
         PreTransposedRHS,
         Transposed1xWRHS,
         TempResult,
+        QuantizedLHS,
+        LHSScales,
+        QuantizedRHS,
+        TransposedQuantizedRHS,
+        RHSScales,
+        AccumulatorS32,
         Count
     };
 
+    /** Configure the 8-bit GEMM on dynamically quantized operands */
+    void
+    configure_dynamic_quantization(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *d);
+    /** Run the GEMM on the (batch collapsed) operands */
+    void run_gemm(ITensorPack &tensors);
+    /** Run the 8-bit GEMM on the (batch collapsed) operands */
+    void run_quantized_gemm(ITensorPack &tensors);
+    /** Quantize the weights per output channel and transpose them for the 8-bit GEMM */
+    void
+    quantize_weights(const ITensor *b, ITensor *quantized_b, ITensor *b_scales, ITensor *transposed_quantized_b);
+    /** Apply the activation the assembly output stage could not fuse, in place on @p d */
+    void run_activation(ITensor *d);
+
+    TensorShape _original_a_shape{};
+    TensorShape _original_d_shape{};
+
     TensorInfo _tmp_a{};
     TensorInfo _pretransposed_b{};
     TensorInfo _tmp_b{};
     TensorInfo _tmp_d{};
+    TensorInfo _quantized_a{};
+    TensorInfo _a_scales{};
+    TensorInfo _quantized_b{};
+    TensorInfo _transposed_quantized_b{};
+    TensorInfo _b_scales{};
+    TensorInfo _accumulators{};
 
     bool _run_vector_matrix_multiplication{false};
     bool _run_bias_addition{false};
     bool _reshape_b_only_on_first_run{false};
+    bool _is_prepared{false};
+    bool _collapse_batches{false};
+    bool _run_activation{false};
+    bool _run_dynamic_quantization{false};
     bool _run_interleave_transpose{
         true}; /**< If we run CpuGemmInterleave4x4Kernel on lhs and CpuGemmTranspose1xWKernel on rhs */
 
+    std::unique_ptr<CpuGemmAssemblyDispatch>              _asm_glue{nullptr};
     std::unique_ptr<kernels::CpuGemmMatrixMultiplyKernel> _mm_kernel{nullptr};
     std::unique_ptr<CpuTranspose>                         _pretranspose_b_func{nullptr};
     std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>  _interleave_kernel{nullptr};
     std::unique_ptr<kernels::CpuGemmTranspose1xWKernel>   _transpose1xW_b_kernel{nullptr};
     std::unique_ptr<kernels::CpuAddVecKernel>             _add_bias{nullptr};
+    std::unique_ptr<CpuActivation>                        _activation_func{nullptr};
+    std::unique_ptr<kernels::CpuDynamicQuantizeKernel>    _quantize_a_kernel{nullptr};
+    std::unique_ptr<kernels::CpuDynamicQuantizeKernel>    _quantize_b_kernel{nullptr};
+    std::unique_ptr<CpuTranspose>                         _transpose_quantized_b_func{nullptr};
+    std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>        _gemmlowp_func{nullptr};
+    std::unique_ptr<kernels::CpuDynamicDequantizeKernel>  _dequantize_kernel{nullptr};
 
     experimental::MemoryRequirements _aux_mem{Count};
 };
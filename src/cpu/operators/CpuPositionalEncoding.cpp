@@ -0,0 +1,77 @@
+#include "src/cpu/operators/CpuPositionalEncoding.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuPositionalEncodingKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuPositionalEncoding::configure(const ITensorInfo *src, ITensorInfo *dst, const PositionalEncodingLayerInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuPositionalEncoding::validate(src, dst, info));
+
+    // The graph is configured for its longest sequence, so that is the only length the table must cover
+    _table_info = src->clone()->set_tensor_shape(TensorShape(src->dimension(0), src->dimension(1)));
+    _is_prepared = false;
+
+    auto k = std::make_unique<kernels::CpuPositionalEncodingKernel>();
+    k->configure(src, &_table_info, dst);
+    _kernel = std::move(k);
+
+    _aux_mem[EncodingTable] = experimental::MemoryInfo(offset_int_vec(EncodingTable),
+                                                       experimental::MemoryLifetime::Persistent,
+                                                       _table_info.total_size());
+}
+
+Status CpuPositionalEncoding::validate(const ITensorInfo                 *src,
+                                       const ITensorInfo                 *dst,
+                                       const PositionalEncodingLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) != info.d_model());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(1) > info.seq_len(), "Sequence longer than the encoded length");
+
+    const TensorInfo table_info = src->clone()->set_tensor_shape(TensorShape(src->dimension(0), src->dimension(1)));
+    return kernels::CpuPositionalEncodingKernel::validate(src, &table_info, dst);
+}
+
+void CpuPositionalEncoding::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    CpuAuxTensorHandler table(offset_int_vec(EncodingTable), _table_info, tensors);
+
+    ITensorPack pack = {{ACL_SRC_0, tensors.get_const_tensor(ACL_SRC_0)},
+                        {ACL_SRC_1, table.get()},
+                        {ACL_DST, tensors.get_tensor(ACL_DST)}};
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), pack);
+}
+
+void CpuPositionalEncoding::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        CpuAuxTensorHandler table(offset_int_vec(EncodingTable), _table_info, tensors);
+        kernels::CpuPositionalEncodingKernel::compute_encoding_table(table.get());
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuPositionalEncoding::workspace() const
+{
+    return _aux_mem;
+}
+
+} // namespace cpu
+} // namespace arm_compute
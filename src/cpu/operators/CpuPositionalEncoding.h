@@ -0,0 +1,54 @@
+#ifndef ARM_COMPUTE_CPU_POSITIONAL_ENCODING_H
+#define ARM_COMPUTE_CPU_POSITIONAL_ENCODING_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuPositionalEncodingKernel
+ *
+ * The sinusoidal table is computed on the first run into a persistent auxiliary tensor sized for the
+ * sequence length the operator is configured for, the following runs only add it to the embeddings.
+ */
+class CpuPositionalEncoding : public ICpuOperator
+{
+public:
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src  Source embeddings, shape [d_model, seq, batch]. Data types supported: F32/F16
+     * @param[out] dst  Destination tensor info. Data type supported: Same as @p src
+     * @param[in]  info Positional encoding layer parameters.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const PositionalEncodingLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuPositionalEncoding::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const PositionalEncodingLayerInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        EncodingTable = 0,
+        Count
+    };
+
+    TensorInfo                       _table_info{};
+    bool                             _is_prepared{false};
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_POSITIONAL_ENCODING_H */
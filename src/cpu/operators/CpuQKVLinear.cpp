@@ -0,0 +1,180 @@
+#include "src/cpu/operators/CpuQKVLinear.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+TensorShape compute_qkv_output_shape(const ITensorInfo *src, const ITensorInfo *query_w)
+{
+    TensorShape output_shape = src->tensor_shape();
+    output_shape.set(Window::DimX, 3 * query_w->dimension(1));
+    return output_shape;
+}
+} // namespace
+
+void CpuQKVLinear::configure(const ITensorInfo     *src,
+                             const ITensorInfo     *query_w,
+                             const ITensorInfo     *query_b,
+                             const ITensorInfo     *key_w,
+                             const ITensorInfo     *key_b,
+                             const ITensorInfo     *value_w,
+                             const ITensorInfo     *value_b,
+                             ITensorInfo           *dst,
+                             const LinearLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, query_w, query_b, key_w, key_b, value_w, value_b, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, query_w, query_b, key_w, key_b, value_w, value_b, dst, info);
+
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(compute_qkv_output_shape(src, query_w)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(
+        CpuQKVLinear::validate(src, query_w, query_b, key_w, key_b, value_w, value_b, dst, info));
+
+    _is_prepared            = false;
+    _pack_only_on_first_run = query_w->are_values_constant() && key_w->are_values_constant() &&
+                              value_w->are_values_constant() && query_b->are_values_constant() &&
+                              key_b->are_values_constant() && value_b->are_values_constant();
+
+    // Weights are stored as [in, out]: stacking them along Y gives the [K, 3 * N] packed matrix
+    _weights_concat_func = std::make_unique<CpuConcatenate>();
+    _weights_concat_func->configure({query_w, key_w, value_w}, &_packed_weights, Window::DimY);
+    _packed_weights.set_are_values_constant(_pack_only_on_first_run);
+
+    _bias_concat_func = std::make_unique<CpuConcatenate>();
+    _bias_concat_func->configure({query_b, key_b, value_b}, &_packed_bias, Window::DimX);
+    _packed_bias.set_are_values_constant(_pack_only_on_first_run);
+
+    _linear_func = std::make_unique<CpuLinear>();
+    _linear_func->configure(src, &_packed_weights, &_packed_bias, dst, 1.f, 1.f, info);
+
+    const auto linear_mem_req = _linear_func->workspace();
+    ARM_COMPUTE_ERROR_ON(linear_mem_req.size() > static_cast<size_t>(PackedWeights));
+    for (unsigned int slot = 0; slot < linear_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = linear_mem_req[slot];
+    }
+
+    // The packed weights are only read in prepare() when CpuLinear keeps its own reshaped copy of them, otherwise
+    // every run reads them. The packed bias is always read by run(), by the output stage or the bias addition.
+    const experimental::MemoryLifetime lifetime = _pack_only_on_first_run ? experimental::MemoryLifetime::Persistent
+                                                                           : experimental::MemoryLifetime::Temporary;
+    const experimental::MemoryLifetime weights_lifetime =
+        (_pack_only_on_first_run && _linear_func->reshapes_b_only_on_first_run())
+            ? experimental::MemoryLifetime::Prepare
+            : lifetime;
+    _aux_mem[PackedWeights] =
+        experimental::MemoryInfo(offset_int_vec(PackedWeights), weights_lifetime, _packed_weights.total_size());
+    _aux_mem[PackedBias] = experimental::MemoryInfo(offset_int_vec(PackedBias), lifetime, _packed_bias.total_size());
+}
+
+Status CpuQKVLinear::validate(const ITensorInfo     *src,
+                              const ITensorInfo     *query_w,
+                              const ITensorInfo     *query_b,
+                              const ITensorInfo     *key_w,
+                              const ITensorInfo     *key_b,
+                              const ITensorInfo     *value_w,
+                              const ITensorInfo     *value_b,
+                              const ITensorInfo     *dst,
+                              const LinearLayerInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, query_w, query_b, key_w, key_b, value_w, value_b, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, query_w, query_b, key_w, key_b, value_w, value_b);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(query_w, key_w, value_w);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(query_b, key_b, value_b);
+    ARM_COMPUTE_RETURN_ERROR_ON(query_w->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != query_w->dimension(0),
+                                    "Input and weights reduction size mismatch");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(query_b->dimension(0) != query_w->dimension(1), "Bias size mismatch");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->tensor_shape() != compute_qkv_output_shape(src, query_w));
+    }
+
+    return Status{};
+}
+
+void CpuQKVLinear::pack_weights(ITensorPack &tensors, ITensor *packed_weights, ITensor *packed_bias)
+{
+    ITensorPack weights_pack{{ACL_SRC_VEC, tensors.get_const_tensor(ACL_SRC_1)},
+                             {ACL_SRC_VEC + 1, tensors.get_const_tensor(ACL_SRC_3)},
+                             {ACL_SRC_VEC + 2, tensors.get_const_tensor(ACL_SRC_5)},
+                             {ACL_DST, packed_weights}};
+    _weights_concat_func->run(weights_pack);
+
+    ITensorPack bias_pack{{ACL_SRC_VEC, tensors.get_const_tensor(ACL_SRC_2)},
+                          {ACL_SRC_VEC + 1, tensors.get_const_tensor(ACL_SRC_4)},
+                          {ACL_SRC_VEC + 2, tensors.get_const_tensor(ACL_SRC_6)},
+                          {ACL_DST, packed_bias}};
+    _bias_concat_func->run(bias_pack);
+}
+
+void CpuQKVLinear::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    // Weights released after prepare() are not read anymore, there is nothing to allocate for them
+    CpuAuxTensorHandler packed_weights(
+        offset_int_vec(PackedWeights), _packed_weights, tensors, false /*pack_inject*/,
+        _aux_mem[PackedWeights].lifetime == experimental::MemoryLifetime::Prepare /*bypass_alloc*/);
+    CpuAuxTensorHandler packed_bias(offset_int_vec(PackedBias), _packed_bias, tensors);
+
+    if (!_pack_only_on_first_run)
+    {
+        pack_weights(tensors, packed_weights.get(), packed_bias.get());
+    }
+
+    // Hand the packed operands to the GEMM, the auxiliary slots of CpuLinear are forwarded as they are
+    ITensorPack linear_pack = tensors;
+    linear_pack.add_const_tensor(ACL_SRC_1, packed_weights.get());
+    linear_pack.add_const_tensor(ACL_SRC_2, packed_bias.get());
+    _linear_func->run(linear_pack);
+}
+
+void CpuQKVLinear::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_pack_only_on_first_run)
+        {
+            CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors);
+            CpuAuxTensorHandler packed_bias(offset_int_vec(PackedBias), _packed_bias, tensors);
+
+            pack_weights(tensors, packed_weights.get(), packed_bias.get());
+
+            ITensorPack linear_pack = tensors;
+            linear_pack.add_const_tensor(ACL_SRC_1, packed_weights.get());
+            linear_pack.add_const_tensor(ACL_SRC_2, packed_bias.get());
+            _linear_func->prepare(linear_pack);
+
+            // Only the packed copies are used from now on, the original weights can be released
+            for (auto slot : {ACL_SRC_1, ACL_SRC_2, ACL_SRC_3, ACL_SRC_4, ACL_SRC_5, ACL_SRC_6})
+            {
+                tensors.get_const_tensor(slot)->mark_as_unused();
+            }
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuQKVLinear::workspace() const
+{
+    return _aux_mem;
+}
+
+} // namespace cpu
+} // namespace arm_compute
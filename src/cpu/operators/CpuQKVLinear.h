@@ -0,0 +1,97 @@
+#ifndef ARM_COMPUTE_CPU_QKV_LINEAR_H
+#define ARM_COMPUTE_CPU_QKV_LINEAR_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/operators/CpuConcatenate.h"
+#include "src/cpu/operators/CpuLinear.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run the query, key and value projections of an attention layer as a single GEMM
+ *
+ * The three weight matrices and biases are concatenated once in prepare() into a [K, 3 * N] packed
+ * matrix and a [3 * N] bias, then a single @ref CpuLinear computes [query | key | value] for every token:
+ *  -# @ref CpuConcatenate (weights and biases, only on first run when they are constant)
+ *  -# @ref CpuLinear
+ *
+ * @note The destination holds the three projections side by side along X, i.e. [3 * N, M].
+ */
+class CpuQKVLinear : public ICpuOperator
+{
+public:
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src      Input tensor info, shape [K, M] or [K, seq, batch]. Data type supported: F16/F32.
+     * @param[in]  query_w  Query weights tensor info, shape [K, N]. Data type supported: Same as @p src.
+     * @param[in]  query_b  Query bias tensor info, shape [N]. Data type supported: Same as @p src.
+     * @param[in]  key_w    Key weights tensor info. Shape and data type supported: Same as @p query_w.
+     * @param[in]  key_b    Key bias tensor info. Shape and data type supported: Same as @p query_b.
+     * @param[in]  value_w  Value weights tensor info. Shape and data type supported: Same as @p query_w.
+     * @param[in]  value_b  Value bias tensor info. Shape and data type supported: Same as @p query_b.
+     * @param[out] dst      Output tensor info, shape [3 * N, M] or [3 * N, seq, batch]. Data type supported: Same as @p src.
+     * @param[in]  info     (Optional) Linear layer operation information
+     */
+    void configure(const ITensorInfo     *src,
+                   const ITensorInfo     *query_w,
+                   const ITensorInfo     *query_b,
+                   const ITensorInfo     *key_w,
+                   const ITensorInfo     *key_b,
+                   const ITensorInfo     *value_w,
+                   const ITensorInfo     *value_b,
+                   ITensorInfo           *dst,
+                   const LinearLayerInfo &info = LinearLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuQKVLinear::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *src,
+                           const ITensorInfo     *query_w,
+                           const ITensorInfo     *query_b,
+                           const ITensorInfo     *key_w,
+                           const ITensorInfo     *key_b,
+                           const ITensorInfo     *value_w,
+                           const ITensorInfo     *value_b,
+                           const ITensorInfo     *dst,
+                           const LinearLayerInfo &info = LinearLayerInfo());
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &constants) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        /* Slots 0 - 19 reserved for CpuLinear */
+        PackedWeights = 20,
+        PackedBias,
+        Count
+    };
+
+    /** Concatenate the query, key and value weights and biases into the packed tensors */
+    void pack_weights(ITensorPack &tensors, ITensor *packed_weights, ITensor *packed_bias);
+
+    std::unique_ptr<CpuConcatenate> _weights_concat_func{nullptr};
+    std::unique_ptr<CpuConcatenate> _bias_concat_func{nullptr};
+    std::unique_ptr<CpuLinear>      _linear_func{nullptr};
+
+    TensorInfo _packed_weights{};
+    TensorInfo _packed_bias{};
+
+    bool _pack_only_on_first_run{false};
+    bool _is_prepared{false};
+
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_QKV_LINEAR_H */
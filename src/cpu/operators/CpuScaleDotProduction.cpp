@@ -7,6 +7,7 @@
 #include "src/common/utils/Log.h"
 #include "src/cpu/CpuContext.h"
 
+#include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
@@ -15,136 +16,198 @@ namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+/** Describe a [d_model, seq] tensor as [d_head, seq, h] over the same memory
+ *
+ * Only the strides change: moving along Z steps d_head elements into the row instead of to a new plane.
+ */
+TensorInfo head_split_view(const ITensorInfo &src, unsigned int h)
+{
+    const size_t d_head = src.dimension(0) / h;
+
+    Strides strides = src.strides_in_bytes();
+    strides.set(Window::DimZ, d_head * src.element_size());
+
+    TensorInfo view;
+    view.init(TensorShape(d_head, src.dimension(1), h), src.num_channels(), src.data_type(), strides,
+              src.offset_first_element_in_bytes(), src.total_size());
+    return view;
+}
+
+/** Describe a [x, y, z] tensor as [x, y, 1, z] over the same memory
+ *
+ * The assembly GEMM takes its batches from dimension 2 and its multis, which may each use a different B
+ * matrix, from dimension 3: moving Z to dimension 3 computes every head with its own key or value.
+ */
+TensorInfo heads_as_multis(const ITensorInfo &src)
+{
+    Strides strides = src.strides_in_bytes();
+    strides.set(3, src.strides_in_bytes()[Window::DimZ]);
+
+    TensorInfo view;
+    view.init(TensorShape(src.dimension(0), src.dimension(1), 1U, src.dimension(2)), src.num_channels(),
+              src.data_type(), strides, src.offset_first_element_in_bytes(), src.total_size());
+    view.set_are_values_constant(src.are_values_constant());
+    return view;
+}
+} // namespace
+
 
 void CpuScaleDotProduction::configure(const ITensorInfo *query,
                                       const ITensorInfo *key,
                                       const ITensorInfo *value,
+                                      const ITensorInfo *mask,
                                       ITensorInfo *output,
                                       const ScaleDotProductionAttentionLayerInfo& info)
 {
-    ARM_COMPUTE_LOG_PARAMS(key, value, query, output);
-    
-    // Query multi-Head reshape 
-    TensorShape query_reshape = TensorShape(query->tensor_shape().x()/info.h(),
-                                            info.h(),
-                                            query->tensor_shape().y(),
-                                            1);
-    _reshaped_query = query->clone()->set_tensor_shape(query_reshape);
-    TensorShape query_permute = TensorShape(query->tensor_shape().x()/info.h(),
-                                            query->tensor_shape().y(),
-                                            info.h(),
-                                            1);
-    _permuted_query = query->clone()->set_tensor_shape(query_permute);
-    _query_reshape_kernel = std::make_unique<kernels::CpuReshapeKernel>();
-    _query_reshape_kernel->configure(query, &_reshaped_query);
-    _query_permute_func = std::make_unique<CpuPermute>();
-    _query_permute_func->configure(&_reshaped_query, &_permuted_query, PermutationVector(0U, 2U, 1U));
-
-
-    // Key multi-Head reshape 
-    TensorShape key_reshape = TensorShape(key->tensor_shape().x()/info.h(),
-                                          info.h(),
-                                          key->tensor_shape().y(),
-                                          1);
-    _reshaped_key = key->clone()->set_tensor_shape(key_reshape);
-    TensorShape key_permute = TensorShape(key->tensor_shape().x()/info.h(),
-                                          key->tensor_shape().y(),
-                                          info.h(),
-                                          1);
-    _permuted_key = key->clone()->set_tensor_shape(key_permute);
-    _key_reshape_kernel = std::make_unique<kernels::CpuReshapeKernel>();
-    _key_reshape_kernel->configure(key, &_reshaped_key);
-    _key_permute_func = std::make_unique<CpuPermute>();
-    _key_permute_func->configure(&_reshaped_key, &_permuted_key, PermutationVector(0U, 2U, 1U));
-    // Pretranspose Key, K=K^T 
-    _key_transpose_func = std::make_unique<CpuTranspose>();
-    _key_transpose_func->configure(&_permuted_key, &_transposed_key);
-
-    
-    // Value multi-Head reshape 
-    TensorShape value_reshape = TensorShape(value->tensor_shape().x()/info.h(),
-                                            info.h(),
-                                            value->tensor_shape().y(),
-                                            1);
-    _reshaped_value = value->clone()->set_tensor_shape(value_reshape);
-    TensorShape value_permute = TensorShape(value->tensor_shape().x()/info.h(),
-                                            value->tensor_shape().y(),
-                                            info.h(),
-                                            1);
-    _permuted_value = value->clone()->set_tensor_shape(value_permute);
-    _value_reshape_kernel = std::make_unique<kernels::CpuReshapeKernel>();
-    _value_reshape_kernel->configure(value, &_reshaped_value);
-    _value_permute_func = std::make_unique<CpuPermute>();
-    _value_permute_func->configure(&_reshaped_value, &_permuted_value, PermutationVector(0U, 2U, 1U));
-
-
-
-    // Configure interleave kernel
-    _query_interleave_kernel = std::make_unique<cpu::kernels::CpuGemmInterleave4x4Kernel>();
-    _query_interleave_kernel->configure(&_permuted_query, &_tmp_query);
-    _aux_mem[InterleavedLHS] =
-        experimental::MemoryInfo(offset_int_vec(InterleavedLHS), experimental::MemoryLifetime::Persistent, _tmp_query.total_size());
-    
-    // Configure rhs transpose1xw kernel
-    _key_transpose1xW_kernel = std::make_unique<cpu::kernels::CpuGemmTranspose1xWKernel>();
-    _key_transpose1xW_kernel->configure(&_transposed_key, &_tmp_key);
-    _aux_mem[Transposed1xWRHS] =
-        experimental::MemoryInfo(offset_int_vec(Transposed1xWRHS),experimental::MemoryLifetime::Persistent, _tmp_key.total_size());
-
-    // Matrix multiply compute multi-head attention between Query and Key
-    _product_mm_kernel = std::make_unique<cpu::kernels::CpuGemmMatrixMultiplyKernel>();
-    const int m = _permuted_query.dimension(1);
-    const int n = _transposed_key.dimension(0);
-    const int k = _permuted_query.dimension(0);
+    ARM_COMPUTE_LOG_PARAMS(key, value, query, mask, output);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuScaleDotProduction::validate(query, key, value, mask, output, info));
+
+    // Incremental decoding: the caches live in persistent workspace slots, each run writes one token
+    _run_cached = info.max_cache_len() > 0;
+    if (_run_cached)
+    {
+        TensorShape cache_shape = query->tensor_shape();
+        cache_shape.set(Window::DimY, info.max_cache_len());
+        _key_cache   = query->clone()->set_tensor_shape(cache_shape);
+        _value_cache = query->clone()->set_tensor_shape(cache_shape);
+        _cache_len     = 0;
+        _max_cache_len = info.max_cache_len();
+
+        _single_query_kernel = std::make_unique<kernels::CpuSingleQueryAttentionKernel>();
+        _single_query_kernel->configure(query, key, value, &_key_cache, &_value_cache, output, info);
+
+        _aux_mem[KeyCache] = experimental::MemoryInfo(offset_int_vec(KeyCache), experimental::MemoryLifetime::Persistent,
+                                                      _key_cache.total_size());
+        _aux_mem[ValueCache] = experimental::MemoryInfo(offset_int_vec(ValueCache),
+                                                        experimental::MemoryLifetime::Persistent, _value_cache.total_size());
+        return;
+    }
+
+    // Fused attention: streams key/value blocks and writes the merged heads directly into output
+    _run_fused = bool(kernels::CpuFlashAttentionKernel::validate(query, key, value, mask, output, info));
+    if (_run_fused)
+    {
+        _flash_attention_kernel = std::make_unique<kernels::CpuFlashAttentionKernel>();
+        _flash_attention_kernel->configure(query, key, value, mask, output, info);
+        return;
+    }
+
+    // The heads are strided views of the projections: head i is columns [i * d_head, (i + 1) * d_head) of
+    // every row, so [d_model, seq] is read as [d_head, seq, h] without a permute. Both products run as a
+    // single batched assembly GEMM whose multis are the heads; key and value are re-packed on every run,
+    // which transposes the whole key
+    const unsigned int seq_q = query->dimension(1);
+    const unsigned int seq_k = key->dimension(1);
+    _permuted_query = heads_as_multis(head_split_view(*query, info.h()));
+    _permuted_key   = head_split_view(*key, info.h());
+    _permuted_value = head_split_view(*value, info.h());
+    _permuted_key.set_are_values_constant(false);
+    _permuted_value.set_are_values_constant(false);
+
+    _scaled_query_key        = TensorInfo(TensorShape(seq_k, seq_q, info.h()), 1, query->data_type());
+    _scaled_query_key_multis = heads_as_multis(_scaled_query_key);
+
+    // Scores of every head, Q * K^T: the transposition of the key is left to the assembly dispatch
+    // TODO: Let the QKV projection write K transposed and drop this per-run transposition
+    AsmGemmInfo query_key_info{};
+    query_key_info.transpose_b = true;
+    _query_key_gemm            = std::make_unique<CpuGemmAssemblyDispatch>();
+    _query_key_gemm->configure(&_permuted_query, &_permuted_key, nullptr, &_scaled_query_key_multis, query_key_info);
+    ARM_COMPUTE_ERROR_ON(!_query_key_gemm->is_configured());
+
+    // Softmax of the raw scores: the 1/sqrt(d_head) scale and the additive mask (broadcast over the heads)
+    // are applied while the scores are read, in a single pass over them
     const float scale = 1.0f/sqrt(info.d_model()/info.h());
-    _product_mm_kernel->configure(&_tmp_query,&_tmp_key,&_scaled_query_key,scale,true,GEMMReshapeInfo(m, n, k));
-
-    //  Softmax of previous product 
-    _softmax_func = std::make_unique<cpu::CpuSoftmaxGeneric>();
-    _softmax_func->configure(&_scaled_query_key,&_softmaxed_product);
-
-
-
-    // Configure interleave kernel
-    _product_interleave_kernel = std::make_unique<cpu::kernels::CpuGemmInterleave4x4Kernel>();
-    _product_interleave_kernel->configure(&_softmaxed_product, &_interleaved_product);
-    _aux_mem[InterleavedProduct] =
-        experimental::MemoryInfo(offset_int_vec(InterleavedProduct), experimental::MemoryLifetime::Persistent, _interleaved_product.total_size());
-    
-    // Configure rhs transpose1xw kernel
-    _value_transpose1xW_kernel = std::make_unique<cpu::kernels::CpuGemmTranspose1xWKernel>();
-    _value_transpose1xW_kernel->configure(&_permuted_value, &_transposed1xW_value);
-    _aux_mem[Transposed1xWValue] =
-        experimental::MemoryInfo(offset_int_vec(Transposed1xWValue),experimental::MemoryLifetime::Persistent, _transposed1xW_value.total_size());
-
-    //  Multiply between scaled product and value 
-    _context_mm_kernel = std::make_unique<cpu::kernels::CpuGemmMatrixMultiplyKernel>();
-    const int m1 = _softmaxed_product.dimension(1);
-    const int n1 = _permuted_value.dimension(0);
-    const int k1 = _softmaxed_product.dimension(0);
-    _context_mm_kernel->configure(&_interleaved_product,&_permuted_value,&_gemmed_context,1.0f,true,GEMMReshapeInfo(m1, n1, k1));
-
-    // Concat multi-Head reshape 
-
-    TensorShape concat_permute = TensorShape(query->tensor_shape().x()/info.h(),
-                                             info.h(),
-                                             query->tensor_shape().y(),
-                                             1);
-    _permuted_concat = query->clone()->set_tensor_shape(concat_permute);
-    _concat_permute_func = std::make_unique<CpuPermute>();
-    _concat_permute_func->configure(&_gemmed_context, &_permuted_concat, PermutationVector(0U, 2U, 1U));
-
-    _concat_reshape_kernel = std::make_unique<kernels::CpuReshapeKernel>();
-    _concat_reshape_kernel->configure(&_permuted_concat, output);
+    _softmax_kernel = std::make_unique<kernels::CpuOnlineSoftmaxKernel>();
+    _softmax_kernel->configure(&_scaled_query_key,
+                               (info.mask_type() == AttentionMaskType::ADDITIVE) ? mask : nullptr,
+                               &_softmaxed_product, scale);
+    _softmaxed_product_multis = heads_as_multis(_softmaxed_product);
+
+    // The context of every head is stored straight into its columns of the output, which merges the heads
+    auto_init_if_empty(*output, query->clone()->set_tensor_shape(query->tensor_shape()));
+    _merged_context = heads_as_multis(head_split_view(*output, info.h()));
+
+    _context_gemm = std::make_unique<CpuGemmAssemblyDispatch>();
+    _context_gemm->configure(&_softmaxed_product_multis, &_permuted_value, nullptr, &_merged_context, AsmGemmInfo{});
+    ARM_COMPUTE_ERROR_ON(!_context_gemm->is_configured());
+
+    // The two GEMMs run one after the other and neither keeps its packed B across runs, so they share the
+    // assembly slots, each sized for the larger of the two
+    const auto query_key_mem = _query_key_gemm->workspace();
+    const auto context_mem   = _context_gemm->workspace();
+    for (size_t idx = 0; idx < query_key_mem.size() && idx < QueryKeyScale; ++idx)
+    {
+        _aux_mem[idx] = (query_key_mem[idx].size >= context_mem[idx].size) ? query_key_mem[idx] : context_mem[idx];
+    }
+    _aux_mem[QueryKeyScale] = experimental::MemoryInfo(offset_int_vec(QueryKeyScale),
+                                                       experimental::MemoryLifetime::Temporary,
+                                                       _scaled_query_key.total_size());
+    _aux_mem[Softmax]       = experimental::MemoryInfo(offset_int_vec(Softmax), experimental::MemoryLifetime::Temporary,
+                                                       _softmaxed_product.total_size());
 }
 
 Status
-CpuScaleDotProduction::validate(const ITensorInfo *query, const ITensorInfo *key, const ITensorInfo *value, ITensorInfo *output)
+CpuScaleDotProduction::validate(const ITensorInfo *query,
+                                const ITensorInfo *key,
+                                const ITensorInfo *value,
+                                const ITensorInfo *mask,
+                                ITensorInfo       *output,
+                                const ScaleDotProductionAttentionLayerInfo &info)
 {
-    ARM_COMPUTE_UNUSED(key);
-    ARM_COMPUTE_UNUSED(value);
-    ARM_COMPUTE_UNUSED(query);
-    ARM_COMPUTE_UNUSED(output);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(query, key, value, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.h() == 0 || info.d_model() % info.h() != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((info.mask_type() == AttentionMaskType::NONE) != (mask == nullptr),
+                                    "Mask tensor and mask type mismatch");
+
+    if (info.max_cache_len() > 0)
+    {
+        // Every cached token is attended to, padding is never written to the caches
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.mask_type() != AttentionMaskType::NONE,
+                                        "Attention masks are not supported with a key/value cache");
+        TensorShape cache_shape = query->tensor_shape();
+        cache_shape.set(Window::DimY, info.max_cache_len());
+        const TensorInfo key_cache = query->clone()->set_tensor_shape(cache_shape);
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuSingleQueryAttentionKernel::validate(
+            query, key, value, &key_cache, &key_cache, output, info));
+        return Status{};
+    }
+
+    if (!bool(kernels::CpuFlashAttentionKernel::validate(query, key, value, mask, output, info)))
+    {
+        // The unfused path handles a single sequence and additive masks without batch broadcast only
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(query->tensor_shape().total_size_upper(2) != 1,
+                                        "Batched inputs with a head depth above 256 are not supported: the unfused "
+                                        "attention handles a single sequence");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.mask_type() == AttentionMaskType::VALID_LENGTH,
+                                        "Valid-length masks with a head depth above 256 are not supported: the "
+                                        "unfused attention only applies additive masks");
+        if (info.mask_type() == AttentionMaskType::ADDITIVE)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(query, mask);
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(0) != key->dimension(1));
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->dimension(1) != 1 && mask->dimension(1) != query->dimension(1));
+            ARM_COMPUTE_RETURN_ERROR_ON(mask->tensor_shape().total_size_upper(2) != 1);
+        }
+
+        TensorInfo permuted_query = heads_as_multis(head_split_view(*query, info.h()));
+        TensorInfo permuted_key   = head_split_view(*key, info.h());
+        TensorInfo permuted_value = head_split_view(*value, info.h());
+        permuted_key.set_are_values_constant(false);
+        permuted_value.set_are_values_constant(false);
+        const TensorInfo scaled_query_key =
+            heads_as_multis(TensorInfo(TensorShape(key->dimension(1), query->dimension(1), info.h()), 1, query->data_type()));
+
+        AsmGemmInfo query_key_info{};
+        query_key_info.transpose_b = true;
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            CpuGemmAssemblyDispatch::validate(&permuted_query, &permuted_key, nullptr, &scaled_query_key, query_key_info));
+        // The merged context has the shape of the query
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            CpuGemmAssemblyDispatch::validate(&scaled_query_key, &permuted_value, nullptr, &permuted_query, AsmGemmInfo{}));
+    }
     return Status{};
 }
 
@@ -152,97 +215,78 @@ void CpuScaleDotProduction::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_UNUSED(tensors);
 
+    if (_run_cached)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(_cache_len >= _max_cache_len, "Key/value cache is full");
+
+        CpuAuxTensorHandler key_cache(offset_int_vec(KeyCache), _key_cache, tensors);
+        CpuAuxTensorHandler value_cache(offset_int_vec(ValueCache), _value_cache, tensors);
+
+        ITensorPack cached_pack{{ACL_SRC_0, tensors.get_const_tensor(ACL_SRC_0)},
+                                {ACL_SRC_1, tensors.get_const_tensor(ACL_SRC_1)},
+                                {ACL_SRC_2, tensors.get_const_tensor(ACL_SRC_2)},
+                                {ACL_INT_0, key_cache.get()},
+                                {ACL_INT_1, value_cache.get()},
+                                {ACL_DST, tensors.get_tensor(ACL_DST)}};
+        _single_query_kernel->set_cache_length(_cache_len);
+        NEScheduler::get().schedule_op(_single_query_kernel.get(), Window::DimX, _single_query_kernel->window(),
+                                       cached_pack);
+        return;
+    }
+
+    if (_run_fused)
+    {
+        NEScheduler::get().schedule_op(_flash_attention_kernel.get(), Window::DimY, _flash_attention_kernel->window(),
+                                       tensors);
+        return;
+    }
+
     auto query    = tensors.get_const_tensor(ACL_SRC_0);
     auto key  = tensors.get_const_tensor(ACL_SRC_1);
     auto value  = tensors.get_const_tensor(ACL_SRC_2);
+    auto mask   = tensors.get_const_tensor(ACL_SRC_3);
     auto output = tensors.get_tensor(ACL_DST);
 
-    CpuAuxTensorHandler reshaped_query(offset_int_vec(QueryReshape), _reshaped_query, tensors);
-    CpuAuxTensorHandler permuted_query(offset_int_vec(QueryPermute), _permuted_query, tensors);
-    CpuAuxTensorHandler reshaped_key(offset_int_vec(KeyReshape), _reshaped_key, tensors);
-    CpuAuxTensorHandler permuted_key(offset_int_vec(KeyPermute), _permuted_key, tensors);
-    CpuAuxTensorHandler transposed_key(offset_int_vec(KeyTranspose), _transposed_key, tensors);
-    CpuAuxTensorHandler reshaped_value(offset_int_vec(ValueReshape), _reshaped_value, tensors);
-    CpuAuxTensorHandler permuted_value(offset_int_vec(ValuePermute), _permuted_value, tensors);
-    CpuAuxTensorHandler permuted_concat(offset_int_vec(ConcatPermute), _permuted_concat, tensors);
-
     CpuAuxTensorHandler scaled_query_key(offset_int_vec(QueryKeyScale), _scaled_query_key, tensors);
-    CpuAuxTensorHandler interleaved_query(offset_int_vec(InterleavedLHS), _tmp_query, tensors, true);
-    CpuAuxTensorHandler transposed1xw_key(offset_int_vec(Transposed1xWRHS), _tmp_key, tensors, true);
     CpuAuxTensorHandler softmaxed_product(offset_int_vec(Softmax), _softmaxed_product, tensors);
-    CpuAuxTensorHandler interleaved_product(offset_int_vec(InterleavedProduct), _interleaved_product, tensors, true);
-    CpuAuxTensorHandler transposed1xW_value(offset_int_vec(Transposed1xWValue), _transposed1xW_value, tensors, true);
-    CpuAuxTensorHandler gemmed_context(offset_int_vec(GemmedContext), _gemmed_context, tensors);
-
-    // Run Query multi-Head reshape 
-    ITensorPack query_reshape_pack{{ACL_SRC_0, query},{ACL_DST, reshaped_query.get()}};
-    const auto query_split_dimension = _query_reshape_kernel->get_split_dimension();
-    NEScheduler::get().schedule_op(_query_reshape_kernel.get(), query_split_dimension, _query_reshape_kernel->window(), query_reshape_pack);
-
-    ITensorPack query_permute_pack{{ACL_SRC, reshaped_query.get()},{ACL_DST, permuted_query.get()}};
-    _query_permute_func->run(query_permute_pack);
-
-    // Run Key multi-Head reshape 
-    ITensorPack key_reshape_pack{{ACL_SRC_0, key},{ACL_DST, reshaped_key.get()}};
-    const auto key_split_dimension = _key_reshape_kernel->get_split_dimension();
-    NEScheduler::get().schedule_op(_key_reshape_kernel.get(), key_split_dimension, _key_reshape_kernel->window(), key_reshape_pack);
-
-    ITensorPack key_permute_pack{{ACL_SRC, reshaped_key.get()},{ACL_DST, permuted_key.get()}};
-    _key_permute_func->run(key_permute_pack);
-
-    ITensorPack key_transpose_pack{{ACL_SRC, permuted_key.get()}, {ACL_DST, transposed_key.get()}};
-    _key_transpose_func->run(key_transpose_pack);
 
-    // Run Value multi-Head reshape 
-    ITensorPack value_reshape_pack{{ACL_SRC_0, value},{ACL_DST, reshaped_value.get()}};
-    const auto value_split_dimension = _value_reshape_kernel->get_split_dimension();
-    NEScheduler::get().schedule_op(_value_reshape_kernel.get(), value_split_dimension, _value_reshape_kernel->window(), value_reshape_pack);
-
-    ITensorPack value_permute_pack{{ACL_SRC, reshaped_value.get()},{ACL_DST, permuted_value.get()}};
-    _value_permute_func->run(value_permute_pack);
-
-    // Run interleave kernel
-    ITensorPack interleave_pack{{ACL_SRC, permuted_query.get()}, {ACL_DST, interleaved_query.get()}};
-    NEScheduler::get().schedule_op(_query_interleave_kernel.get(), Window::DimY, _query_interleave_kernel->window(),
-                                    interleave_pack);
-
-    // Run transpose1xw kernel
-    ITensorPack transpose_pack{{ACL_SRC, transposed_key.get()}, {ACL_DST, transposed1xw_key.get()}};
-    NEScheduler::get().schedule_op(_key_transpose1xW_kernel.get(), Window::DimY,
-                                    _key_transpose1xW_kernel->window(), transpose_pack);
-
-
-    // Run matrix multiply compute multi-head attention between Query and Key
-    ITensorPack gemm_QK_pack{{ACL_SRC_0, interleaved_query.get()}, {ACL_SRC_1, transposed1xw_key.get()}, {ACL_DST, scaled_query_key.get()}};
-    NEScheduler::get().schedule_op(_product_mm_kernel.get(),Window::DimZ,_product_mm_kernel->window(),gemm_QK_pack);
-
-
-    ITensorPack softmax_pack = {{ACL_SRC, scaled_query_key.get()}, {ACL_DST, softmaxed_product.get()}};
-    _softmax_func->run(softmax_pack);
-
-
-    // Run interleave kernel
-    ITensorPack interleave_product_pack{{ACL_SRC, softmaxed_product.get()}, {ACL_DST, interleaved_product.get()}};
-    NEScheduler::get().schedule_op(_product_interleave_kernel.get(), Window::DimY, _product_interleave_kernel->window(),
-                                    interleave_product_pack);
-
-    // Run transpose1xw kernel
-    ITensorPack transpose_value_pack{{ACL_SRC, permuted_value.get()}, {ACL_DST, transposed1xW_value.get()}};
-    NEScheduler::get().schedule_op(_value_transpose1xW_kernel.get(), Window::DimY,
-                                   _value_transpose1xW_kernel->window(), transpose_value_pack);
-
-    // Run matrix multiply compute multi-head attention between Query and Key
-    ITensorPack gemm_context_pack{{ACL_SRC_0, interleaved_product.get()}, {ACL_SRC_1, transposed1xW_value.get()}, {ACL_DST, gemmed_context.get()}};
-    NEScheduler::get().schedule_op(_context_mm_kernel.get(),Window::DimZ,_context_mm_kernel->window(),gemm_context_pack);
-
-    // Concat all attention head together
-    ITensorPack concat_permute_pack{{ACL_SRC, gemmed_context.get()},{ACL_DST, permuted_concat.get()}};
-    _concat_permute_func->run(concat_permute_pack);
+    // Head-split views over the projections, the output and the scores, no permute is needed
+    CpuAuxTensorHandler permuted_query(_permuted_query, *query);
+    CpuAuxTensorHandler permuted_key(_permuted_key, *key);
+    CpuAuxTensorHandler permuted_value(_permuted_value, *value);
+    CpuAuxTensorHandler merged_context(_merged_context, *output);
+    CpuAuxTensorHandler scaled_query_key_multis(_scaled_query_key_multis, *scaled_query_key.get());
+    CpuAuxTensorHandler softmaxed_product_multis(_softmaxed_product_multis, *softmaxed_product.get());
+
+    // Scores of all the heads in one batched GEMM
+    ITensorPack gemm_QK_pack(tensors);
+    gemm_QK_pack.add_const_tensor(ACL_SRC_0, permuted_query.get());
+    gemm_QK_pack.add_const_tensor(ACL_SRC_1, permuted_key.get());
+    gemm_QK_pack.remove_tensor(ACL_SRC_2);
+    gemm_QK_pack.add_tensor(ACL_DST, scaled_query_key_multis.get());
+    _query_key_gemm->run(gemm_QK_pack);
+
+    ITensorPack softmax_pack = {{ACL_SRC_0, scaled_query_key.get()}, {ACL_SRC_1, mask}, {ACL_DST, softmaxed_product.get()}};
+    NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimY, _softmax_kernel->window(), softmax_pack);
+
+    // Context of all the heads in one batched GEMM, written through the head-split view of the output
+    ITensorPack gemm_context_pack(tensors);
+    gemm_context_pack.add_const_tensor(ACL_SRC_0, softmaxed_product_multis.get());
+    gemm_context_pack.add_const_tensor(ACL_SRC_1, permuted_value.get());
+    gemm_context_pack.remove_tensor(ACL_SRC_2);
+    gemm_context_pack.add_tensor(ACL_DST, merged_context.get());
+    _context_gemm->run(gemm_context_pack);
+}
 
-    ITensorPack concat_reshape_pack{{ACL_SRC_0, permuted_concat.get()},{ACL_DST, output}};
-    const auto concat_split_dimension = _concat_reshape_kernel->get_split_dimension();
-    NEScheduler::get().schedule_op(_concat_reshape_kernel.get(), concat_split_dimension, _concat_reshape_kernel->window(), concat_reshape_pack);
+void CpuScaleDotProduction::set_cache_length(unsigned int cache_len)
+{
+    ARM_COMPUTE_ERROR_ON(cache_len > _max_cache_len);
+    _cache_len = cache_len;
+}
 
+unsigned int CpuScaleDotProduction::cache_length() const
+{
+    return _cache_len;
 }
 
 experimental::MemoryRequirements CpuScaleDotProduction::workspace() const
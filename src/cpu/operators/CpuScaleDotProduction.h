@@ -8,16 +8,12 @@
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/CpuScaleKernel.h"
 #include "src/cpu/kernels/CpuSoftmaxKernel.h"
-#include "src/cpu/operators/CpuTranspose.h"
-#include "src/cpu/kernels/CpuGemmMatrixMultiplyKernel.h"
 #include "src/cpu/operators/CpuActivation.h"
-#include "src/cpu/kernels/CpuGemmInterleave4x4Kernel.h"
-#include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
+#include "src/cpu/kernels/CpuFlashAttentionKernel.h"
+#include "src/cpu/kernels/CpuSingleQueryAttentionKernel.h"
+#include "src/cpu/kernels/CpuOnlineSoftmaxKernel.h"
 
-#include "src/cpu/kernels/CpuReshapeKernel.h"
-#include "src/cpu/operators/CpuPermute.h"
-#include "src/cpu/operators/CpuSoftmax.h"
-#include "src/cpu/operators/CpuGemm.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 #include <memory>
 
@@ -26,7 +22,22 @@ namespace arm_compute
 namespace cpu
 {
 /** Function implementation for scale dot production, uses kernels:
- * @ref kernels::CpuEmbedKernel
+ * @ref kernels::CpuFlashAttentionKernel
+ *
+ * @note When the fused kernel does not support the configuration, falls back to the unfused GEMM and softmax
+ *       pipeline. The fallback only supports a single sequence and additive masks, which are applied with the
+ *       scale by @ref kernels::CpuOnlineSoftmaxKernel. Query, key, value and output are read and written as
+ *       strided [d_head, seq, h] views of their [d_model, seq] tensors, so splitting and merging the heads
+ *       needs no permute, and Q * K^T and P * V each run as one batched @ref CpuGemmAssemblyDispatch with a
+ *       multi per head. The key and the value are not zero-copy: the assembly GEMM re-packs its right-hand
+ *       side on every run, and for the key this packing is a full transposition.
+ * @note TODO: Have the QKV projection write K transposed, [seq, d_head] per head, so that Q * K^T reads it
+ *       without the per-run transposition.
+ * @note When info.max_cache_len() is set the operator decodes one token per run with
+ *       @ref kernels::CpuSingleQueryAttentionKernel: the key and value of the new token are written to
+ *       persistent key/value caches held in the workspace, so the workspace must be kept alive between runs.
+ *       The caller owns the cache position: run() writes the new token at @ref cache_length() and leaves it
+ *       unchanged, @ref set_cache_length() must be called to advance it.
 */
 class CpuScaleDotProduction : public ICpuOperator
 {
@@ -38,22 +49,40 @@ public:
     
     /** Configure operator for a given list of arguments
      * 
-     * @param[in]  query           Attention key tensor info. Data types supported: F32.
-     * @param[in]  key             Attention key tensor info. Data types supported: F32.
-     * @param[in]  value           Attention value tensor info. Data types supported: F32.
-     * @param[out] output          Destination tensor info. Data type supported: F32
+     * @param[in]  query           Attention key tensor info. Data types supported: F16/F32.
+     * @param[in]  key             Attention key tensor info. Data types supported: Same as @p query.
+     * @param[in]  value           Attention value tensor info. Data types supported: Same as @p query.
+     * @param[in]  mask            Attention mask tensor info, nullptr when info.mask_type() is @ref AttentionMaskType::NONE.
+     *                             See @ref kernels::CpuFlashAttentionKernel for the supported shapes.
+     * @param[out] output          Destination tensor info. Data type supported: Same as @p query
+     * @param[in]  info            Scale dot production attention layer information.
      */
-    void configure( const ITensorInfo *query, const ITensorInfo *key, const ITensorInfo *value, ITensorInfo *output, const ScaleDotProductionAttentionLayerInfo& info);
+    void configure( const ITensorInfo *query, const ITensorInfo *key, const ITensorInfo *value, const ITensorInfo *mask, ITensorInfo *output, const ScaleDotProductionAttentionLayerInfo& info);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuScaleDotProduction::configure()
      *
      * @return a status
      */
-    static Status validate( const ITensorInfo *query, const ITensorInfo *key, const ITensorInfo *value, ITensorInfo *output);
+    static Status validate(const ITensorInfo *query,
+                           const ITensorInfo *key,
+                           const ITensorInfo *value,
+                           const ITensorInfo *mask,
+                           ITensorInfo       *output,
+                           const ScaleDotProductionAttentionLayerInfo &info = ScaleDotProductionAttentionLayerInfo());
 
     void transpose(ITensorPack &tensors);
 
+    /** Set the number of tokens held in the key/value caches, the next run writes its token after them
+     *
+     * Only meaningful when configured with info.max_cache_len() greater than zero. Setting 0 starts a new sequence.
+     *
+     * @param[in] cache_len Number of cached tokens, at most info.max_cache_len()
+     */
+    void set_cache_length(unsigned int cache_len);
+    /** Number of tokens currently held in the key/value caches */
+    unsigned int cache_length() const;
+
     // Inherited methods overridden:
     void run(ITensorPack &tensors) override;
     experimental::MemoryRequirements workspace() const override;
@@ -62,68 +91,39 @@ private:
     enum AuxTensorIdx
     {
         /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
-        InterleavedLHS = 3,
-        Transposed1xWRHS,
-        InterleavedProduct,
-        Transposed1xWValue,
-        QueryReshape,
-        QueryPermute,
-        KeyReshape,
-        KeyPermute,
-        ValueReshape,
-        ValuePermute,
-        KeyTranspose,
-        QueryKeyScale,
+        QueryKeyScale = 3,
         Softmax,
-        GemmedContext,
-        ConcatPermute,
+        KeyCache,
+        ValueCache,
         Count
     };
 
-    std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>    _query_interleave_kernel{nullptr};
-    std::unique_ptr<kernels::CpuGemmMatrixMultiplyKernel>   _product_mm_kernel{nullptr};
-    std::unique_ptr<kernels::CpuGemmTranspose1xWKernel>     _key_transpose1xW_kernel{nullptr};
-    std::unique_ptr<CpuActivation>                          _scale_func{nullptr};
-    std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>    _product_interleave_kernel{nullptr};
-    std::unique_ptr<kernels::CpuGemmMatrixMultiplyKernel>   _context_mm_kernel{nullptr};
-    std::unique_ptr<kernels::CpuGemmTranspose1xWKernel>     _value_transpose1xW_kernel{nullptr};
-    
+    std::unique_ptr<kernels::CpuFlashAttentionKernel>       _flash_attention_kernel{nullptr};
+    std::unique_ptr<kernels::CpuSingleQueryAttentionKernel> _single_query_kernel{nullptr};
 
-    std::unique_ptr<kernels::CpuReshapeKernel>              _query_reshape_kernel{nullptr};
-    std::unique_ptr<CpuPermute>                             _query_permute_func{nullptr};
-    std::unique_ptr<kernels::CpuReshapeKernel>              _key_reshape_kernel{nullptr};
-    std::unique_ptr<CpuPermute>                             _key_permute_func{nullptr};
-    std::unique_ptr<kernels::CpuReshapeKernel>              _value_reshape_kernel{nullptr};
-    std::unique_ptr<CpuPermute>                             _value_permute_func{nullptr};
-    std::unique_ptr<kernels::CpuReshapeKernel>              _concat_reshape_kernel{nullptr};
-    std::unique_ptr<CpuPermute>                             _concat_permute_func{nullptr};
-    std::unique_ptr<CpuTranspose>                           _key_transpose_func{nullptr};
-    std::unique_ptr<CpuSoftmaxGeneric>                      _softmax_func{nullptr};
-
-    
-
-    TensorInfo _tmp_query{};
-    TensorInfo _tmp_key{};
-    TensorInfo _interleaved_product{};
-    TensorInfo _transposed1xW_value{};
-
-    TensorInfo _reshaped_query{};
-    TensorInfo _permuted_query{};
-    TensorInfo _reshaped_key{};
-    TensorInfo _permuted_key{};
-    TensorInfo _reshaped_value{};
-    TensorInfo _permuted_value{};
-    TensorInfo _permuted_concat{};
-    TensorInfo _transposed_key{};
+    std::unique_ptr<CpuActivation>                          _scale_func{nullptr};
+    std::unique_ptr<CpuGemmAssemblyDispatch>                _query_key_gemm{nullptr};
+    std::unique_ptr<CpuGemmAssemblyDispatch>                _context_gemm{nullptr};
+    std::unique_ptr<kernels::CpuOnlineSoftmaxKernel>        _softmax_kernel{nullptr};
+
+    TensorInfo _permuted_query{}; /**< Head-split view of the query, one multi per head */
+    TensorInfo _permuted_key{};   /**< Head-split view of the key */
+    TensorInfo _permuted_value{}; /**< Head-split view of the value */
+    TensorInfo _merged_context{}; /**< Head-split view of the output, one multi per head */
     TensorInfo _scaled_query_key{};
     TensorInfo _softmaxed_product{};
-    TensorInfo _gemmed_context{};
-
+    TensorInfo _scaled_query_key_multis{};  /**< Scores seen by the Q * K^T GEMM, one multi per head */
+    TensorInfo _softmaxed_product_multis{}; /**< Probabilities seen by the P * V GEMM, one multi per head */
+    TensorInfo _key_cache{};
+    TensorInfo _value_cache{};
+
+    bool _run_fused{false}; /**< If we run the whole attention in CpuFlashAttentionKernel */
+    bool _run_cached{false}; /**< If we decode one token per run against the key/value caches */
+    unsigned int _cache_len{0}; /**< Number of tokens currently held in the key/value caches */
+    unsigned int _max_cache_len{0}; /**< Capacity in tokens of the key/value caches */
     bool _run_pretranspose{false};
     bool _run_scale{false};
     bool _run_vector_matrix_multiplication{false};
-    bool _run_interleave_transpose{
-        true}; /**< If we run CpuGemmInterleave4x4Kernel on lhs and CpuGemmTranspose1xWKernel on rhs */
 
     experimental::MemoryRequirements _aux_mem{Count};
 
@@ -10,14 +10,14 @@ namespace arm_compute
 {
 namespace cpu
 {
-/** Basic function to run @ref kernels::CpuVectorizeKernel */
+/** Basic function to run @ref kernels::CpuTokenEmbedKernel */
 class CpuTokenEmbed : public ICpuOperator
 {
 public:
     /** Configure operator for a given list of arguments
      *
-     * @param[in]  input           Source tensor info. Data types supported: U8.
-     * @param[in]  vocab           Char 2 Vec const tensor info, Data type supported: F32
+     * @param[in]  input           Token id tensor info, shape [seq, batch]. Data types supported: any 32-bit type holding U32 ids.
+     * @param[in]  vocab           Embedding table tensor info, Data type supported: F32/F16/BFLOAT16/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL
      * @param[out] output          Destination tensor info. Data type supported: F32
      * @param[in]  tkemb_info      Token embed layer parameters.
      */
@@ -633,9 +633,15 @@ NodeID GraphBuilder::add_generate_proposals_node(Graph                &g,
     return nid;
 }
 
-NodeID GraphBuilder::add_multi_head_attention_node(Graph &g, NodeParams params, NodeIdxPair input, MultiHeadAttentionLayerInfo mha_info)
+NodeID GraphBuilder::add_multi_head_attention_node(Graph                      &g,
+                                                   NodeParams                  params,
+                                                   NodeIdxPair                 input,
+                                                   MultiHeadAttentionLayerInfo mha_info,
+                                                   NodeIdxPair                 mask)
 {
     check_nodeidx_pair(input, g);
+    ARM_COMPUTE_ERROR_ON_MSG((mha_info.mask_type() == AttentionMaskType::NONE) != (mask.node_id == EmptyNodeID),
+                             "Attention mask and mask type mismatch");
 
     /* Scale dot production Layer */
     NodeID sdp_nid = g.add_node<ScaleDotProductionAttentionNode>(ScaleDotProductionAttentionLayerInfo(mha_info));
@@ -643,18 +649,57 @@ NodeID GraphBuilder::add_multi_head_attention_node(Graph &g, NodeParams params,
     g.add_connection(input.node_id, 0 /*query*/ , sdp_nid, 0);
     g.add_connection(input.node_id, 1 /*key*/   , sdp_nid, 1);
     g.add_connection(input.node_id, 2 /*value*/ , sdp_nid, 2);
+    if (mask.node_id != EmptyNodeID)
+    {
+        check_nodeidx_pair(mask, g);
+        g.add_connection(mask.node_id, mask.index, sdp_nid, 3);
+    }
 
     set_node_params(g, sdp_nid, params);
 
     return sdp_nid;
 }
 
-NodeID GraphBuilder::add_layer_norm_node(Graph &g, NodeParams params, NodeIdxPair input, LayerNormLayerInfo info)
+NodeID GraphBuilder::add_layer_norm_node(Graph              &g,
+                                         NodeParams          params,
+                                         NodeIdxPair         input,
+                                         LayerNormLayerInfo  info,
+                                         ITensorAccessorUPtr gamma,
+                                         ITensorAccessorUPtr beta)
 {
     check_nodeidx_pair(input, g);
+
+    bool has_gamma = (gamma != nullptr);
+    bool has_beta  = (beta != nullptr);
+
+    // Gamma and beta hold one value per element of the normalized axis
+    const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+    TensorDescriptor       common_desc       = input_tensor_desc;
+    common_desc.shape                        = TensorShape(input_tensor_desc.shape[info.axis()]);
+
+    NodeID gamma_nid = EmptyNodeID;
+    if (has_gamma)
+    {
+        gamma_nid = add_const_node_with_name(g, params, "Gamma", common_desc, std::move(gamma));
+    }
+
+    NodeID beta_nid = EmptyNodeID;
+    if (has_beta)
+    {
+        beta_nid = add_const_node_with_name(g, params, "Beta", common_desc, std::move(beta));
+    }
+
     NodeID l_nid = g.add_node<LayerNormNode>(info);
 
-    g.add_connection(input.node_id, 0, l_nid, 0);
+    g.add_connection(input.node_id, input.index, l_nid, 0);
+    if (has_gamma)
+    {
+        g.add_connection(gamma_nid, 0, l_nid, 1);
+    }
+    if (has_beta)
+    {
+        g.add_connection(beta_nid, 0, l_nid, 2);
+    }
 
     set_node_params(g, l_nid, params);
 
@@ -702,43 +747,26 @@ NodeID GraphBuilder::add_multi_head_linear_layer(Graph &g, NodeParams params, No
     NodeID          v_b_nid  = add_const_node_with_name(g, params, "Value Bias", v_b_desc, std::move(value_bias));
 
     
-    // Specific Linear attention operation
-    LinearLayerInfo  q_linear_info = linear_info;
-    LinearLayerInfo  k_linear_info = linear_info;
-    LinearLayerInfo  v_linear_info = linear_info;
-
-    // Value, Key, Query Linear Nodes
-    NodeID q_nid    = g.add_node<LinearLayerNode>(q_linear_info);
-    NodeID k_nid    = g.add_node<LinearLayerNode>(k_linear_info);
-    NodeID v_nid    = g.add_node<LinearLayerNode>(v_linear_info);
-    
+    // Query, Key and Value are computed by a single GEMM over the concatenated weights
+    NodeID qkv_nid = g.add_node<QKVLinearLayerNode>(linear_info);
+
     // Connect input
-    g.add_connection(input.node_id, input.index, q_nid, 0);
-    g.add_connection(input.node_id, input.index, k_nid, 0);
-    g.add_connection(input.node_id, input.index, v_nid, 0);
+    g.add_connection(input.node_id, input.index, qkv_nid, 0);
 
     // Connect weights and bias
-    g.add_connection(q_w_nid, 0, q_nid, 1);
-    g.add_connection(q_b_nid, 0, q_nid, 2);
-    g.add_connection(k_w_nid, 0, k_nid, 1);
-    g.add_connection(k_b_nid, 0, k_nid, 2);
-    g.add_connection(v_w_nid, 0, v_nid, 1);
-    g.add_connection(v_b_nid, 0, v_nid, 2);
-
-
-    // A node to hold all the output
-    NodeID f_nid    = g.add_node<SimpleForwardLayerNode>(3);
-
-    // Connect all linear node to single node
-    g.add_connection(q_nid, 0, f_nid,0);
-    g.add_connection(k_nid, 0, f_nid,1);
-    g.add_connection(v_nid, 0, f_nid,2);
-
-
-    set_node_params(g, q_nid, params);
-    set_node_params(g, k_nid, params);
-    set_node_params(g, v_nid, params);
-
+    g.add_connection(q_w_nid, 0, qkv_nid, 1);
+    g.add_connection(q_b_nid, 0, qkv_nid, 2);
+    g.add_connection(k_w_nid, 0, qkv_nid, 3);
+    g.add_connection(k_b_nid, 0, qkv_nid, 4);
+    g.add_connection(v_w_nid, 0, qkv_nid, 5);
+    g.add_connection(v_b_nid, 0, qkv_nid, 6);
+
+    // Split the fused result back into Query, Key and Value, the outputs become sub-tensors of the
+    // fused result when the backend supports them
+    NodeID f_nid = g.add_node<SplitLayerNode>(3, 0);
+    g.add_connection(qkv_nid, 0, f_nid, 0);
+
+    set_node_params(g, qkv_nid, params);
     set_node_params(g, f_nid, params);
 
     return f_nid;
@@ -848,6 +876,14 @@ NodeID GraphBuilder::add_pooling_node(Graph &g, NodeParams params, NodeIdxPair i
     return create_simple_single_input_output_node<PoolingLayerNode>(g, params, input, pool_info);
 }
 
+NodeID GraphBuilder::add_positional_encoding_node(Graph                      &g,
+                                                  NodeParams                  params,
+                                                  NodeIdxPair                 input,
+                                                  PositionalEncodingLayerInfo pe_info)
+{
+    return create_simple_single_input_output_node<PositionalEncodingNode>(g, params, input, pe_info);
+}
+
 NodeID GraphBuilder::add_print_node(Graph                                    &g,
                                     NodeParams                                params,
                                     NodeIdxPair                               input,
@@ -999,10 +1035,14 @@ NodeID GraphBuilder::add_embedding_node(Graph &g,
     check_nodeidx_pair(input, g);
 
     // Get input tensor descriptor
-    const TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+    TensorDescriptor input_tensor_desc = get_tensor_descriptor(g, g.node(input.node_id)->outputs()[0]);
+
+    // The input only holds 32-bit ids, an explicit data type lets the tables run in another precision
+    if (emb_info.data_type() != DataType::UNKNOWN)
+    {
+        input_tensor_desc.data_type = emb_info.data_type();
+    }
 
-    std::cout <<"input_tensor_desc.shape.x() " <<  input_tensor_desc.shape.x() << std::endl;
-    std::cout <<"input_tensor_desc.shape.y() " <<  input_tensor_desc.shape.y() << std::endl;
     // Vocabulary const node output tensor descriptor
     TensorDescriptor v_desc = input_tensor_desc;
     // Reshape tensor to store weight with size of vocabulary and depth of d_model.
@@ -1013,42 +1053,31 @@ NodeID GraphBuilder::add_embedding_node(Graph &g,
     // Reshape tensor to store weight with size of vocabulary and depth of d_model.
     s_desc.shape = TensorShape(emb_info.d_model(),emb_info.d_segment());
 
-    // Position const node output tensor descriptor
-    TensorDescriptor p_desc = input_tensor_desc;
-    // Reshape tensor to store weight with size of vocabulary and depth of d_model.
-    p_desc.shape = TensorShape(emb_info.d_model(),emb_info.d_position());
-
     NodeID v_c_nid  = add_const_node_with_name(g, params, "vocabs", v_desc,    std::move(vocabs_accessor));
     NodeID s_c_nid  = add_const_node_with_name(g, params, "segements", s_desc, std::move(segemnts_accessor));
-    NodeID p_c_nid  = add_const_node_with_name(g, params, "position", p_desc, std::move(position_accessor));
-
-    // Create token embedding node and connect
-    NodeID t_nid = g.add_node<TokenEmbeddingLayerNode>(emb_info);
-    g.add_connection(input.node_id, 0 /* text input*/, t_nid, 0);
-    g.add_connection(v_c_nid, 0, t_nid, 1);
 
-    // Create segment embedding node
-    NodeID s_nid = g.add_node<SegmentEmbeddingLayerNode>();
-    g.add_connection(input.node_id, 1 /* segment input*/, s_nid, 0);
-    g.add_connection(s_c_nid, 0, s_nid, 1);
-    
-    NodeID p_nid = g.add_node<PositionEmbeddingLayerNode>();
-    g.add_connection(input.node_id, 0 /* text input*/, p_nid, 0);
-    g.add_connection(p_c_nid, 0, p_nid, 1);
+    // Gather and sum the token, segment and position rows in a single node
+    NodeID e_nid = g.add_node<EmbeddingLayerNode>(emb_info);
+    g.add_connection(input.node_id, 0 /* text input*/, e_nid, 0);
+    g.add_connection(input.node_id, 1 /* segment input*/, e_nid, 1);
+    g.add_connection(v_c_nid, 0, e_nid, 2);
+    g.add_connection(s_c_nid, 0, e_nid, 3);
 
-    // Sum token embedding vector and segment embedding vector
-    NodeID add_nid = g.add_node<EmbeddingSumLayerNode>(emb_info);
+    // Without a pretrained table the node gathers the sinusoidal encoding it computes once itself
+    if (emb_info.pretrained())
+    {
+        // Position const node output tensor descriptor
+        TensorDescriptor p_desc = input_tensor_desc;
+        // Reshape tensor to store weight with size of vocabulary and depth of d_model.
+        p_desc.shape = TensorShape(emb_info.d_model(),emb_info.d_position());
 
-    g.add_connection(t_nid, 0, add_nid, 0);
-    g.add_connection(s_nid, 0, add_nid, 1);
-    g.add_connection(p_nid, 0, add_nid, 2);
+        NodeID p_c_nid = add_const_node_with_name(g, params, "position", p_desc, std::move(position_accessor));
+        g.add_connection(p_c_nid, 0, e_nid, 4);
+    }
 
-    set_node_params(g, t_nid, params);
-    set_node_params(g, s_nid, params);
-    set_node_params(g, p_nid, params);
-    set_node_params(g, add_nid, params);
+    set_node_params(g, e_nid, params);
 
-    return add_nid;
+    return e_nid;
 }
 
 NodeID GraphBuilder::add_yolo_node(Graph &g, NodeParams params, NodeIdxPair input, ActivationLayerInfo act_info)
@@ -236,12 +236,21 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::PositionEmbeddingLayer:
             return detail::create_position_embedding_layer<NEPositionEmbeddingLayer, NETargetInfo>(
                 *polymorphic_downcast<PositionEmbeddingLayerNode *>(node));
+        case NodeType::PositionalEncodingLayer:
+            return detail::create_positional_encoding_layer<NEPositionalEncodingLayer, NETargetInfo>(
+                *polymorphic_downcast<PositionalEncodingNode *>(node));
         case NodeType::EmbeddingSumLayer:
             return detail::create_embedding_sum_layer<NEEmbeddingSumLayer, NETargetInfo>(
                 *polymorphic_downcast<EmbeddingSumLayerNode *>(node));
+        case NodeType::EmbeddingLayer:
+            return detail::create_embedding_layer<NEEmbeddingLayer, NETargetInfo>(
+                *polymorphic_downcast<EmbeddingLayerNode *>(node));
         case NodeType::LinearLayer:
             return detail::create_linear_layer<NELinearLayer, NETargetInfo>(
-                *polymorphic_downcast<LinearLayerNode *>(node));
+                *polymorphic_downcast<LinearLayerNode *>(node), ctx);
+        case NodeType::QKVLinearLayer:
+            return detail::create_qkv_linear_layer<NEQKVLinearLayer, NETargetInfo>(
+                *polymorphic_downcast<QKVLinearLayerNode *>(node), ctx);
         case NodeType::SimpleForwardLayer:
             return detail::create_simple_forward_layer<NESimpleForwardLayer, NETargetInfo>(
                 *polymorphic_downcast<SimpleForwardLayerNode *>(node));
@@ -251,6 +260,9 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::LayerNormLayer:
             return detail::create_layer_norm_layer<NELayerNormLayer, NETargetInfo>(
                 *polymorphic_downcast<LayerNormNode *>(node));
+        case NodeType::AddLayerNormLayer:
+            return detail::create_add_layer_norm_layer<NEAddLayerNormLayer, NETargetInfo>(
+                *polymorphic_downcast<AddLayerNormNode *>(node));
         default:
             return nullptr;
     }
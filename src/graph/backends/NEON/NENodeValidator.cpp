@@ -122,6 +122,9 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::ROIAlignLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : ROIAlignLayer");
+        case NodeType::ScaleDotProductionAttentionLayer:
+            return detail::validate_scale_dot_production_layer<NEScaleDotProductionAttentionLayer>(
+                *polymorphic_downcast<ScaleDotProductionAttentionNode *>(node));
         case NodeType::SliceLayer:
             return detail::validate_slice_layer<NESlice>(*polymorphic_downcast<SliceLayerNode *>(node));
         case NodeType::StridedSliceLayer:
@@ -29,6 +29,7 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Utils.h"
@@ -190,7 +191,7 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
 
     // Identify max number of tensors in flight
     HandleCounter tensors_in_flight;
-
+    size_t        max_tensors_in_flight = 0;
 
     // Acquires the given handles and sets them as in flight if they aren't already
     auto acquire = [&](std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> &handles)
@@ -216,6 +217,7 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
         // Marking all the input and output tensors of the task as in flight
         acquire(task_handle.input_handles);
         acquire(task_handle.output_handles);
+        max_tensors_in_flight = std::max(max_tensors_in_flight, tensors_in_flight.size());
 
         // Releasing the input tensors
         for (auto &input_handle : task_handle.input_handles)
@@ -234,6 +236,10 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
         }
     }
 
+    // Stacked identical blocks release their intermediates before the next block starts, so this stays constant
+    // with depth
+    ARM_COMPUTE_LOG_GRAPH_INFO("Maximum number of transition tensors in flight : " << max_tensors_in_flight
+                                                                                    << std::endl);
 }
 } // namespace
 
@@ -231,6 +231,165 @@ void fuse_depthwise_convolution_with_batch_normalization(Graph &g, const Edge *o
     }
 }
 
+void fuse_eltwise_add_with_layer_norm(Graph &g)
+{
+    // The residual sum usually feeds the next residual connection as well, so unlike fuse_layer()
+    // branching eltwise nodes are accepted: the remaining consumers read the sum from the second
+    // output of the fused node.
+    for (unsigned int i = 0; i < g.nodes().size(); ++i)
+    {
+        auto node = g.node(i);
+        if (node == nullptr || node->type() != EltwiseLayerNode::node_type || node->assigned_target() != Target::NEON)
+        {
+            continue;
+        }
+
+        auto *add_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(node);
+        if (add_node->eltwise_operation() != EltwiseOperation::Add || add_node->fused_activation().enabled())
+        {
+            continue;
+        }
+
+        // Broadcasting additions are not supported by the fused kernel
+        const Edge *input0_edge = add_node->input_edge(0);
+        const Edge *input1_edge = add_node->input_edge(1);
+        if (input0_edge == nullptr || input1_edge == nullptr || input0_edge->tensor() == nullptr ||
+            input1_edge->tensor() == nullptr ||
+            input0_edge->tensor()->desc().shape != input1_edge->tensor()->desc().shape)
+        {
+            continue;
+        }
+
+        // Find the layer normalization fed by the sum, any other consumer keeps reading the pre-norm sum
+        LayerNormNode           *ln_node = nullptr;
+        std::vector<NodeIdxPair> sum_consumers;
+        for (const auto &edge_id : add_node->output_edges())
+        {
+            const Edge *edge = g.edge(edge_id);
+            if (edge == nullptr || edge->consumer() == nullptr)
+            {
+                continue;
+            }
+            if (ln_node == nullptr && edge->consumer()->type() == LayerNormNode::node_type && edge->consumer_idx() == 0)
+            {
+                ln_node = arm_compute::utils::cast::polymorphic_downcast<LayerNormNode *>(edge->consumer());
+            }
+            else
+            {
+                sum_consumers.push_back({edge->consumer_id(), edge->consumer_idx()});
+            }
+        }
+
+        if (ln_node == nullptr || ln_node->assigned_target() != Target::NEON)
+        {
+            continue;
+        }
+
+        // Prevent fusion if the sum has an output accessor
+        if (add_node->output(0)->accessor() != nullptr)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+                "Prevented fusion of eltwise addition with layer normalization due to the presence of an output "
+                "accessor\n");
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing eltwise addition node with ID : "
+                                      << add_node->id() << " with LayerNorm Layer node with ID : " << ln_node->id()
+                                      << std::endl);
+
+        const Target assigned_target = add_node->assigned_target();
+        const bool   with_sum        = !sum_consumers.empty();
+
+        // Extract eltwise inputs
+        const NodeIdxPair input0{input0_edge->producer_id(), input0_edge->producer_idx()};
+        const NodeIdxPair input1{input1_edge->producer_id(), input1_edge->producer_idx()};
+
+        // Create the fused node
+        const NodeID fused_id = g.add_node<AddLayerNormNode>(ln_node->layer_norm_info(), with_sum);
+
+        // Add connections from the eltwise/layer_norm inputs to the fused node
+        g.add_connection(input0.node_id, input0.index, fused_id, 0);
+        g.add_connection(input1.node_id, input1.index, fused_id, 1);
+
+        if (ln_node->input_edge(1) != nullptr)
+        {
+            const Edge *ln_gamma_edge = ln_node->input_edge(1);
+            g.add_connection(ln_gamma_edge->producer_id(), ln_gamma_edge->producer_idx(), fused_id, 2);
+        }
+
+        if (ln_node->input_edge(2) != nullptr)
+        {
+            const Edge *ln_beta_edge = ln_node->input_edge(2);
+            g.add_connection(ln_beta_edge->producer_id(), ln_beta_edge->producer_idx(), fused_id, 3);
+        }
+
+        auto fused_node   = g.node(fused_id);
+        auto ln_node_name = ln_node->name();
+
+        transfer_driving_nodes_and_remove_old_node(g, fused_node, ln_node, true);
+
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{add_node->name() + "+" + ln_node_name, assigned_target});
+
+        // Remove eltwise node and hand its remaining consumers over to the sum output
+        g.remove_node(add_node->id());
+
+        for (auto &consumer : sum_consumers)
+        {
+            g.add_connection(fused_id, 1, consumer.node_id, consumer.index);
+        }
+        if (with_sum)
+        {
+            configure_tensor(fused_node->output(1));
+        }
+    }
+}
+
+void fuse_embedding_with_layer_norm(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *emb_node = arm_compute::utils::cast::polymorphic_downcast<EmbeddingLayerNode *>(output_edge->producer());
+    auto *ln_node  = arm_compute::utils::cast::polymorphic_downcast<LayerNormNode *>(output_edge->consumer());
+
+    ARM_COMPUTE_ERROR_ON(ln_node->output(0) == nullptr || emb_node->output(0) == nullptr);
+
+    // The fused kernel normalizes whole embedding rows on the CPU only
+    if (output_edge->consumer_idx() != 0 || ln_node->assigned_target() != Target::NEON ||
+        emb_node->has_fused_layer_norm() || ln_node->layer_norm_info().axis() != 0)
+    {
+        return;
+    }
+
+    // Prevent fusion if the summed embeddings have an output accessor
+    if (emb_node->output(0)->accessor() != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+            "Prevented fusion of embedding with layer normalization due to the presence of an output accessor\n");
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing embedding node with ID : " << emb_node->id()
+                                                                     << " with LayerNorm Layer node with ID : "
+                                                                     << ln_node->id() << std::endl);
+
+    // Hand the layer normalization parameters over to the embedding node
+    if (ln_node->input_edge(1) != nullptr)
+    {
+        const Edge *ln_gamma_edge = ln_node->input_edge(1);
+        g.add_connection(ln_gamma_edge->producer_id(), ln_gamma_edge->producer_idx(), emb_node->id(), 5);
+    }
+    if (ln_node->input_edge(2) != nullptr)
+    {
+        const Edge *ln_beta_edge = ln_node->input_edge(2);
+        g.add_connection(ln_beta_edge->producer_id(), ln_beta_edge->producer_idx(), emb_node->id(), 6);
+    }
+    emb_node->set_fused_layer_norm(ln_node->layer_norm_info());
+
+    transfer_driving_nodes_and_remove_old_node(g, emb_node, ln_node, false);
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph                      &g,
                                const Edge                 *output_edge,
@@ -386,6 +545,10 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::RELU,       Activation::SOFT_RELU,    Activation::SQRT,
         Activation::SQUARE,     Activation::TANH};
 
+    // Linear layers run any activation on their own output, including the GELU of transformer feed-forward blocks
+    std::set<Activation> linear_fused_activations = supported_fused_activations;
+    linear_fused_activations.insert({Activation::SWISH, Activation::GELU, Activation::GELU_TANH});
+
     // Preconditions
     auto empty_prec     = [](INode &) { return true; };
     auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
@@ -416,6 +579,8 @@ void NodeFusionMutator::mutate(Graph &g)
         g, qs8_prec, detail::fuse_node_with_activation<DepthwiseConvolutionLayerNode>, supported_fused_activations);
     detail::fuse_layer<FullyConnectedLayerNode, ActivationLayerNode>(
         g, empty_prec, detail::fuse_node_with_activation<FullyConnectedLayerNode>, supported_fused_activations);
+    detail::fuse_layer<LinearLayerNode, ActivationLayerNode>(
+        g, empty_prec, detail::fuse_node_with_activation<LinearLayerNode>, linear_fused_activations);
     detail::fuse_layer<EltwiseLayerNode, ActivationLayerNode>(
         g, cl_target_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
     // The fusion of BatchNormalizationLayer must occur after the fusion of ActivationLayer. Because FusedConvolutionBatchNormalizationNode assumes the BatchNormalization is already fused with activation, if any
@@ -423,6 +588,10 @@ void NodeFusionMutator::mutate(Graph &g)
         g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    // Residual connections followed by a layer normalization (transformer encoders)
+    detail::fuse_eltwise_add_with_layer_norm(g);
+    // Layer normalization of the summed embeddings (BERT-style encoders)
+    detail::fuse_layer<EmbeddingLayerNode, LayerNormNode>(g, empty_prec, detail::fuse_embedding_with_layer_norm);
 }
 } // namespace graph
 } // namespace arm_compute
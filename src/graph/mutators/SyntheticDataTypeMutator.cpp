@@ -75,6 +75,48 @@ bool is_mutation_supported(Graph &g)
     return true;
 }
 
+/** Check if the graph is a transformer graph
+ *
+ * @param[in] g Graph the mutation pass need to be applied on
+ *
+ * @return True if the graph contains transformer projections else false
+ */
+bool is_transformer_graph(Graph &g)
+{
+    const std::set<NodeType> transformer_node_types = {NodeType::LinearLayer, NodeType::QKVLinearLayer};
+
+    for (const auto &ttype : transformer_node_types)
+    {
+        if (!g.nodes(ttype).empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Run the projections of a transformer graph on dynamically quantized operands
+ *
+ * Tensors stay in float: the weights are quantized per output channel when the graph is prepared and the
+ * activations per token when it runs, while layer normalization and softmax keep working in float in between.
+ * The operands are symmetric, so signed 8-bit is used whatever the requested type.
+ *
+ * @param[in,out] g Graph to convert the projections of.
+ */
+void quantize_linear_layers(Graph &g)
+{
+    for (const auto &node_id : g.nodes(NodeType::LinearLayer))
+    {
+        auto *node = arm_compute::utils::cast::polymorphic_downcast<LinearLayerNode *>(g.node(node_id));
+        node->set_dynamic_quantization_type(DataType::QASYMM8_SIGNED);
+    }
+    for (const auto &node_id : g.nodes(NodeType::QKVLinearLayer))
+    {
+        auto *node = arm_compute::utils::cast::polymorphic_downcast<QKVLinearLayerNode *>(g.node(node_id));
+        node->set_dynamic_quantization_type(DataType::QASYMM8_SIGNED);
+    }
+}
+
 /** Remove nodes that get optimized out during conversion
  *
  * @param[in, out] g Graph to remove the nodes from.
@@ -277,7 +319,12 @@ IGraphMutator::MutationType SyntheticDataTypeMutator::type() const
 
 void SyntheticDataTypeMutator::mutate(Graph &g)
 {
-    if (is_mutation_supported(g))
+    if (is_transformer_graph(g))
+    {
+        // Layer normalization, softmax and the embeddings stay in float, only the projections are quantized
+        quantize_linear_layers(g);
+    }
+    else if (is_mutation_supported(g))
     {
         // Remove nodes that get optimized out (e.g. BatchNorm)
         remove_optimized_nodes(g);
@@ -0,0 +1,62 @@
+#include "arm_compute/graph/nodes/AddLayerNormNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+AddLayerNormNode::AddLayerNormNode(LayerNormLayerInfo info, bool with_sum) : _info(std::move(info))
+{
+    _input_edges.resize(4, EmptyEdgeID); // Input1, input2, gamma, beta
+    _outputs.resize(with_sum ? 2 : 1, NullTensorID);
+}
+
+const LayerNormLayerInfo &AddLayerNormNode::layer_norm_info() const
+{
+    return _info;
+}
+
+bool AddLayerNormNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(1) != NullTensorID))
+    {
+        for (size_t idx = 0; idx < _outputs.size(); ++idx)
+        {
+            if (output_id(idx) == NullTensorID)
+            {
+                return false;
+            }
+            Tensor *dst = output(idx);
+            ARM_COMPUTE_ERROR_ON(dst == nullptr);
+            dst->desc() = configure_output(idx);
+        }
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor AddLayerNormNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    // Both the normalized result and the sum have the shape of the addends
+    const Tensor *src = input(0);
+    ARM_COMPUTE_ERROR_ON(src == nullptr);
+
+    return src->desc();
+}
+
+NodeType AddLayerNormNode::type() const
+{
+    return NodeType::AddLayerNormLayer;
+}
+
+void AddLayerNormNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,87 @@
+#include "arm_compute/graph/nodes/EmbeddingLayerNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+EmbeddingLayerNode::EmbeddingLayerNode(EmbeddingLayerInfo info) : _info(std::move(info))
+{
+    // Token ids, segment ids, token table, segment table, position table, gamma, beta
+    _input_edges.resize(7, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+const EmbeddingLayerInfo &EmbeddingLayerNode::embedding_info() const
+{
+    return _info;
+}
+
+void EmbeddingLayerNode::set_fused_layer_norm(const LayerNormLayerInfo &ln_info)
+{
+    _ln_info    = ln_info;
+    _layer_norm = true;
+}
+
+bool EmbeddingLayerNode::has_fused_layer_norm() const
+{
+    return _layer_norm;
+}
+
+const LayerNormLayerInfo &EmbeddingLayerNode::fused_layer_norm_info() const
+{
+    return _ln_info;
+}
+
+TensorDescriptor EmbeddingLayerNode::compute_output_descriptor(const TensorDescriptor &tokens_descriptor,
+                                                               const TensorDescriptor &token_table_descriptor)
+{
+    TensorDescriptor output_descriptor = token_table_descriptor;
+
+    // Ids [seq, batch] are expanded to vectors [d_model, seq, batch]
+    TensorShape output_shape = tokens_descriptor.shape;
+    output_shape.shift_right(1);
+    output_shape.set(0, token_table_descriptor.shape.x());
+    output_descriptor.shape      = output_shape;
+    output_descriptor.quant_info = QuantizationInfo();
+
+    return output_descriptor;
+}
+
+bool EmbeddingLayerNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(2) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor EmbeddingLayerNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    const Tensor *tokens      = input(0);
+    const Tensor *token_table = input(2);
+    ARM_COMPUTE_ERROR_ON(tokens == nullptr || token_table == nullptr);
+
+    return compute_output_descriptor(tokens->desc(), token_table->desc());
+}
+
+NodeType EmbeddingLayerNode::type() const
+{
+    return NodeType::EmbeddingLayer;
+}
+
+void EmbeddingLayerNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
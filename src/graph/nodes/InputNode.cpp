@@ -43,8 +43,8 @@ InputNode::InputNode(TensorDescriptor desc, size_t size) : _desc(std::move(desc)
 
 bool InputNode::forward_descriptors()
 {
-    for(auto idx : outputs())
-    {   
+    for(size_t idx = 0; idx < num_outputs(); ++idx)
+    {
         if(output_id(idx) == NullTensorID) return false;
         Tensor *t = output(idx);
         ARM_COMPUTE_ERROR_ON(t == nullptr);
@@ -18,6 +18,21 @@ const LinearLayerInfo& LinearLayerNode::linear_info() const
     return _linear_info;
 }
 
+ActivationLayerInfo LinearLayerNode::fused_activation() const
+{
+    return _linear_info.activation_info();
+}
+
+void LinearLayerNode::set_fused_activation(ActivationLayerInfo fused_activation)
+{
+    _linear_info.set_activation_info(fused_activation);
+}
+
+void LinearLayerNode::set_dynamic_quantization_type(DataType data_type)
+{
+    _linear_info.set_dynamic_quantization_type(data_type);
+}
+
 bool LinearLayerNode::forward_descriptors()
 {
     if ((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
@@ -39,8 +54,14 @@ TensorDescriptor LinearLayerNode::configure_output(size_t idx) const
     const Tensor *src = input(0);
     ARM_COMPUTE_ERROR_ON(src == nullptr);
 
+    // Weights are [in, out]
+    const Tensor *weights = input(1);
+    const unsigned int d_out =
+        (weights != nullptr) ? weights->desc().shape.y() : static_cast<unsigned int>(_linear_info.d_linear_hidden());
+
     TensorDescriptor output_desc = src->desc();
-    return src->desc();
+    output_desc.shape.set(0, d_out);
+    return output_desc;
 }
 
 
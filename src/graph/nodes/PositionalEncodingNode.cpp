@@ -23,10 +23,9 @@ PositionalEncodingLayerInfo PositionalEncodingNode::positional_encoding_info() c
 TensorDescriptor PositionalEncodingNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                                    PositionalEncodingLayerInfo info)
 {
-    TensorDescriptor output_descriptor = input_descriptor;
-    const unsigned int seq_len  = info.seq_len();
-    output_descriptor.shape.set(1,seq_len);
-    return output_descriptor;
+    // The encoding is added to the embeddings in place of a separate [d_model, seq] tensor
+    ARM_COMPUTE_UNUSED(info);
+    return input_descriptor;
 }
 
 
@@ -0,0 +1,66 @@
+#include "arm_compute/graph/nodes/QKVLinearLayerNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+QKVLinearLayerNode::QKVLinearLayerNode(LinearLayerInfo info) : _linear_info(std::move(info))
+{
+    _input_edges.resize(7, EmptyEdgeID); // Input, query/key/value weights and biases
+    _outputs.resize(1, NullTensorID);
+}
+
+const LinearLayerInfo &QKVLinearLayerNode::linear_info() const
+{
+    return _linear_info;
+}
+
+void QKVLinearLayerNode::set_dynamic_quantization_type(DataType data_type)
+{
+    _linear_info.set_dynamic_quantization_type(data_type);
+}
+
+bool QKVLinearLayerNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor QKVLinearLayerNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    const Tensor *src = input(0);
+    ARM_COMPUTE_ERROR_ON(src == nullptr);
+
+    // Query, key and value are stacked along X
+    const Tensor      *weights = input(1);
+    const unsigned int d_out =
+        (weights != nullptr) ? weights->desc().shape.y() : static_cast<unsigned int>(_linear_info.d_linear_hidden());
+
+    TensorDescriptor output_desc = src->desc();
+    output_desc.shape.set(0, 3 * d_out);
+    return output_desc;
+}
+
+NodeType QKVLinearLayerNode::type() const
+{
+    return NodeType::QKVLinearLayer;
+}
+
+void QKVLinearLayerNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -10,7 +10,7 @@ namespace graph
 {
 ScaleDotProductionAttentionNode::ScaleDotProductionAttentionNode(ScaleDotProductionAttentionLayerInfo sdpa_info) : _sdpa_info(sdpa_info)
 {
-    _input_edges.resize(3, EmptyEdgeID);
+    _input_edges.resize(4, EmptyEdgeID); // Query, key, value, optional mask
     _outputs.resize(1, NullTensorID);
 }
 
@@ -44,46 +44,11 @@ TensorDescriptor SegmentEmbeddingLayerNode::compute_output_descriptor(const Tens
                                                                     const TensorDescriptor &vector_descriptor)
 {
     TensorDescriptor output_descriptor = vector_descriptor;
-    output_descriptor.shape.set(1, input_descriptor.shape.x());
-    std::cout << "src/graph/nodes/SegmentEmbeddingLayerNode.cpp compute_output_descriptor" << std::endl;
-    std::cout << "output_descriptor shape: " ;
-        for(auto v: output_descriptor.shape)std::cout << " "<<v;
-    std::cout << std::endl;
+    // Ids [seq, batch] are expanded to one vector per token: [d_model, seq, batch]
+    output_descriptor.shape = input_descriptor.shape;
+    output_descriptor.shape.shift_right(1);
+    output_descriptor.shape.set(0, vector_descriptor.shape.x());
 
-    switch (output_descriptor.layout)
-    {
-        case DataLayout::NCHW :
-            std::cout<< "DataLayout: NCHW" << std::endl;
-            break;
-        case DataLayout::NCDHW:
-            std::cout<< "DataLayout: NCDHW" << std::endl;
-            break;
-        case DataLayout::NDHWC :
-            std::cout<< "DataLayout: NDHWC" << std::endl;
-            break;
-        case DataLayout::NHWC :
-            std::cout<< "DataLayout: NHWC" << std::endl;
-            break;
-        
-        default:
-            std::cout<< "DataLayout: Unknown" << std::endl;
-            break;
-    }
-
-    switch (output_descriptor.data_type)
-    {
-        case DataType::F32 :
-            std::cout<< "DataType::F32" << std::endl;
-            break;
-        case DataType::U8 :
-            std::cout<< "DataType::U8" << std::endl;
-            break;
-        
-        default:
-            std::cout<< "DataLayout: Unknown" << std::endl;
-            break;
-    }
-    
     return output_descriptor;
 }
 
@@ -26,47 +26,14 @@ TensorDescriptor TokenEmbeddingLayerNode::compute_output_descriptor(const Tensor
 {
     ARM_COMPUTE_UNUSED(emb_info);
     TensorDescriptor output_descriptor = vector_descriptor;
-    output_descriptor.shape.set(1, input_descriptor.shape.x());
+    // Ids [seq, batch] are expanded to one vector per token: [d_model, seq, batch]
+    output_descriptor.shape = input_descriptor.shape;
+    output_descriptor.shape.shift_right(1);
+    output_descriptor.shape.set(0, vector_descriptor.shape.x());
+    // Reduced precision and quantised tables are converted to F32 while gathering
+    output_descriptor.data_type  = DataType::F32;
+    output_descriptor.quant_info = QuantizationInfo();
 
-    std::cout << "src/graph/nodes/TokenEmbeddingLayerNode.cpp compute_output_descriptor" << std::endl;
-    std::cout << "output_descriptor shape: " ;
-        for(auto v: output_descriptor.shape)std::cout << " "<<v;
-    std::cout << std::endl;
-
-    switch (output_descriptor.layout)
-    {
-        case DataLayout::NCHW :
-            std::cout<< "DataLayout: NCHW" << std::endl;
-            break;
-        case DataLayout::NCDHW:
-            std::cout<< "DataLayout: NCDHW" << std::endl;
-            break;
-        case DataLayout::NDHWC :
-            std::cout<< "DataLayout: NDHWC" << std::endl;
-            break;
-        case DataLayout::NHWC :
-            std::cout<< "DataLayout: NHWC" << std::endl;
-            break;
-        
-        default:
-            std::cout<< "DataLayout: Unknown" << std::endl;
-            break;
-    }
-
-    switch (output_descriptor.data_type)
-    {
-        case DataType::F32 :
-            std::cout<< "DataType::F32" << std::endl;
-            break;
-        case DataType::U8 :
-            std::cout<< "DataType::U8" << std::endl;
-            break;
-        
-        default:
-            std::cout<< "DataLayout: Unknown" << std::endl;
-            break;
-    }
-    
     return output_descriptor;
 }
 
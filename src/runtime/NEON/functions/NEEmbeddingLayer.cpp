@@ -0,0 +1,80 @@
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingLayer.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuEmbeddingLayer.h"
+
+namespace arm_compute
+{
+
+struct NEEmbeddingLayer::Impl
+{
+    MemoryGroup                             memory_group{};
+    ITensorPack                             run_pack{};
+    WorkspaceData<Tensor>                   workspace{};
+    experimental::MemoryRequirements        aux_mem_req{};
+    std::unique_ptr<cpu::CpuEmbeddingLayer> op{nullptr};
+};
+
+NEEmbeddingLayer::NEEmbeddingLayer() : _impl(std::make_unique<Impl>())
+{
+}
+NEEmbeddingLayer::~NEEmbeddingLayer() = default;
+
+void NEEmbeddingLayer::configure(const ITensor            *tokens,
+                                 const ITensor            *segments,
+                                 const ITensor            *token_table,
+                                 const ITensor            *segment_table,
+                                 const ITensor            *position_table,
+                                 const ITensor            *gamma,
+                                 const ITensor            *beta,
+                                 ITensor                  *output,
+                                 const EmbeddingLayerInfo &emb_info,
+                                 bool                      layer_norm,
+                                 const LayerNormLayerInfo &ln_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(tokens, segments, token_table, segment_table, output);
+    ARM_COMPUTE_LOG_PARAMS(tokens, segments, token_table, segment_table, position_table, gamma, beta, output);
+
+    _impl->op = std::make_unique<cpu::CpuEmbeddingLayer>();
+    _impl->op->configure(tokens->info(), segments->info(), token_table->info(), segment_table->info(),
+                         position_table != nullptr ? position_table->info() : nullptr,
+                         gamma != nullptr ? gamma->info() : nullptr, beta != nullptr ? beta->info() : nullptr,
+                         output->info(), emb_info, layer_norm, ln_info);
+
+    _impl->run_pack = {{ACL_SRC_0, tokens},        {ACL_SRC_1, segments},       {ACL_SRC_2, token_table},
+                       {ACL_SRC_3, segment_table}, {ACL_SRC_4, position_table}, {ACL_SRC_5, gamma},
+                       {ACL_SRC_6, beta},          {ACL_DST, output}};
+
+    // Without a pretrained position table the sinusoidal encoding lives in a persistent workspace tensor
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->workspace = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->run_pack);
+}
+
+Status NEEmbeddingLayer::validate(const ITensorInfo        *tokens,
+                                  const ITensorInfo        *segments,
+                                  const ITensorInfo        *token_table,
+                                  const ITensorInfo        *segment_table,
+                                  const ITensorInfo        *position_table,
+                                  const ITensorInfo        *gamma,
+                                  const ITensorInfo        *beta,
+                                  const ITensorInfo        *output,
+                                  const EmbeddingLayerInfo &emb_info,
+                                  bool                      layer_norm,
+                                  const LayerNormLayerInfo &ln_info)
+{
+    return cpu::CpuEmbeddingLayer::validate(tokens, segments, token_table, segment_table, position_table, gamma, beta,
+                                            output, emb_info, layer_norm, ln_info);
+}
+
+void NEEmbeddingLayer::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+} // namespace arm_compute
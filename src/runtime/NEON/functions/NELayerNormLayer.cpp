@@ -12,6 +12,8 @@ namespace arm_compute
 struct  NELayerNormLayer::Impl
 {
     const ITensor                       *src{nullptr};
+    const ITensor                       *gamma{nullptr};
+    const ITensor                       *beta{nullptr};
     ITensor                             *dst{nullptr};
     std::unique_ptr<cpu::CpuLayerNorm>  op{nullptr};
 };
@@ -22,47 +24,43 @@ NELayerNormLayer::NELayerNormLayer() : _impl(std::make_unique<Impl>())
 NELayerNormLayer::~NELayerNormLayer() = default;
 
 void NELayerNormLayer::configure(const ITensor *input,
-                              ITensor *output,
-                              const LayerNormLayerInfo& LayerNorm_info)
+                                 const ITensor *gamma,
+                                 const ITensor *beta,
+                                 ITensor *output,
+                                 const LayerNormLayerInfo& LayerNorm_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_LOG_PARAMS(input, output);
+    ARM_COMPUTE_LOG_PARAMS(input, gamma, beta, output);
 
     _impl->src      = input;
+    _impl->gamma    = gamma;
+    _impl->beta     = beta;
     _impl->dst      = output;
 
     _impl->op = std::make_unique<cpu::CpuLayerNorm>();
-    _impl->op->configure(input->info(), output->info(), LayerNorm_info);
+    _impl->op->configure(input->info(), gamma != nullptr ? gamma->info() : nullptr,
+                         beta != nullptr ? beta->info() : nullptr, output->info(), LayerNorm_info);
 }
 
-Status NELayerNormLayer::validate(const ITensor *input,
-                                  ITensor *output, 
+Status NELayerNormLayer::validate(const ITensorInfo *input,
+                                  const ITensorInfo *gamma,
+                                  const ITensorInfo *beta,
+                                  const ITensorInfo *output,
                                   const LayerNormLayerInfo& LayerNorm_info)
 {
-    ARM_COMPUTE_UNUSED(LayerNorm_info);
-    return cpu::CpuLayerNorm::validate(input->info(), output->info(), LayerNorm_info);
+    return cpu::CpuLayerNorm::validate(input, gamma, beta, output, LayerNorm_info);
 }
 
 void NELayerNormLayer::run()
 {
     ITensorPack pack;
 
-    pack.add_tensor(TensorType::ACL_SRC, _impl->src);
+    pack.add_const_tensor(TensorType::ACL_SRC_0, _impl->src);
+    pack.add_const_tensor(TensorType::ACL_SRC_1, _impl->gamma);
+    pack.add_const_tensor(TensorType::ACL_SRC_2, _impl->beta);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
-    
-    _impl->op->run(pack);
-
-    std::cout <<"src/runtime/NEON/functions/NELayerNormLayer.cpp x: " << _impl->dst->info()->tensor_shape().x() << std::endl;
-    std::cout <<"src/runtime/NEON/functions/NELayerNormLayer.cpp y: " << _impl->dst->info()->tensor_shape().y() << std::endl;
-    std::cout <<"src/runtime/NEON/functions/NELayerNormLayer.cpp z: " << _impl->dst->info()->tensor_shape().z() << std::endl;
-    std::cout << *reinterpret_cast<float *>(_impl->dst->ptr_to_element(Coordinates(0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(_impl->dst->ptr_to_element(Coordinates(0,1)))  << std::endl;
-
-    std::cout << *reinterpret_cast<float *>(_impl->dst->ptr_to_element(Coordinates(1,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(_impl->dst->ptr_to_element(Coordinates(2,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(_impl->dst->ptr_to_element(Coordinates(767,0,0)))  << std::endl;
-    std::cout << *reinterpret_cast<float *>(_impl->dst->ptr_to_element(Coordinates(768,0,0)))  << std::endl;
 
+    _impl->op->run(pack);
 }
 
 } // namespace arm_compute
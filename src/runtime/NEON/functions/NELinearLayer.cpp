@@ -1,13 +1,16 @@
 #include "arm_compute/runtime/NEON/functions/NELinearLayer.h"
 
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuLinear.h"
 
 namespace arm_compute
 {
+using namespace arm_compute::experimental;
 
 struct  NELinearLayer::Impl
 {
@@ -16,10 +19,21 @@ struct  NELinearLayer::Impl
     const ITensor                      *bias{nullptr};
     ITensor                            *dst{nullptr};
     std::unique_ptr<cpu::CpuLinear>    kernel{nullptr};
+
+    MemoryGroup                        memory_group{};
+    IWeightsManager                   *weights_manager{nullptr};
+    ITensorPack                        run_pack{};
+    WorkspaceData<Tensor>              workspace{};
+    experimental::MemoryRequirements   aux_mem_req{};
+
+    bool is_prepared{false};
 };
 
-NELinearLayer::NELinearLayer() : _impl(std::make_unique<Impl>())
+NELinearLayer::NELinearLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _impl(std::make_unique<Impl>())
 {
+    _impl->memory_group    = MemoryGroup(std::move(memory_manager));
+    _impl->weights_manager = weights_manager;
 }
 NELinearLayer::~NELinearLayer() = default;
 
@@ -29,36 +43,68 @@ void NELinearLayer::configure(const ITensor *input,
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_LOG_PARAMS(input, output);
-    ARM_COMPUTE_UNUSED(linear_info);
 
     _impl->src      = input;
     _impl->weight   = weight;
     _impl->bias     = bias;
     _impl->dst      = output;
+    _impl->is_prepared = false;
 
     _impl->kernel = std::make_unique<cpu::CpuLinear>();
-    _impl->kernel->configure(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f);
+    _impl->kernel->configure(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f,
+                             linear_info);
+
+    if (_impl->weights_manager != nullptr)
+    {
+        _impl->weights_manager->manage(_impl->weight);
+    }
+
+    _impl->aux_mem_req = _impl->kernel->workspace();
+    _impl->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_1, weight}, {ACL_SRC_2, bias}, {ACL_DST, output}};
+    _impl->workspace =
+        manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->run_pack);
 }
 
 Status NELinearLayer::validate(const ITensor *input, 
                               const ITensor *weight, 
                               const ITensor *bias, ITensor *output, const LinearLayerInfo& linear_info)
 {
-    ARM_COMPUTE_UNUSED(linear_info);
-    return cpu::CpuLinear::validate(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f);
+    return cpu::CpuLinear::validate(input->info(), weight->info(), bias->info(), output->info(), 1.0f, 1.0f,
+                                    linear_info);
 }
 
 void NELinearLayer::run()
 {
-    ITensorPack pack;
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->kernel->run(_impl->run_pack);
+}
+
+void NELinearLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        _impl->kernel->prepare(_impl->run_pack);
 
-    pack.add_tensor(TensorType::ACL_SRC_0, _impl->src);
-    pack.add_tensor(TensorType::ACL_SRC_1, _impl->weight);
-    pack.add_tensor(TensorType::ACL_SRC_2, _impl->bias);
-    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
-    
-    _impl->kernel->run(pack);
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
 
+        // Handle weights managed infrastructure
+        if (_impl->weights_manager != nullptr && _impl->weights_manager->are_weights_managed(_impl->weight))
+        {
+            // Ensure that the weights get marked as unused (memory released) only after the last function which
+            // uses them also finishes its prepare
+            const ITensor *original_b = _impl->weight;
+            if (!original_b->is_used())
+            {
+                _impl->weights_manager->pre_mark_as_unused(original_b);
+            }
+            _impl->weight->mark_as_used();
+            _impl->weights_manager->release(_impl->weight);
+        }
+    }
 }
 
 } // namespace arm_compute
@@ -0,0 +1,56 @@
+#include "arm_compute/runtime/NEON/functions/NEPositionalEncodingLayer.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuPositionalEncoding.h"
+
+namespace arm_compute
+{
+
+struct NEPositionalEncodingLayer::Impl
+{
+    MemoryGroup                                 memory_group{};
+    ITensorPack                                 run_pack{};
+    WorkspaceData<Tensor>                       workspace{};
+    experimental::MemoryRequirements            aux_mem_req{};
+    std::unique_ptr<cpu::CpuPositionalEncoding> op{nullptr};
+};
+
+NEPositionalEncodingLayer::NEPositionalEncodingLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEPositionalEncodingLayer::~NEPositionalEncodingLayer() = default;
+
+void NEPositionalEncodingLayer::configure(const ITensor *input, ITensor *output, const PositionalEncodingLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    _impl->op = std::make_unique<cpu::CpuPositionalEncoding>();
+    _impl->op->configure(input->info(), output->info(), info);
+    _impl->run_pack = {{ACL_SRC_0, input}, {ACL_DST, output}};
+
+    // The encoding table is a persistent workspace tensor, computed on the first run only
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->workspace = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->run_pack);
+}
+
+Status NEPositionalEncodingLayer::validate(const ITensorInfo                 *input,
+                                           const ITensorInfo                 *output,
+                                           const PositionalEncodingLayerInfo &info)
+{
+    return cpu::CpuPositionalEncoding::validate(input, output, info);
+}
+
+void NEPositionalEncodingLayer::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+} // namespace arm_compute
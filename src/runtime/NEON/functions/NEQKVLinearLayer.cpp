@@ -0,0 +1,95 @@
+#include "arm_compute/runtime/NEON/functions/NEQKVLinearLayer.h"
+
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuQKVLinear.h"
+
+namespace arm_compute
+{
+using namespace arm_compute::experimental;
+
+struct NEQKVLinearLayer::Impl
+{
+    std::unique_ptr<cpu::CpuQKVLinear> kernel{nullptr};
+
+    MemoryGroup                      memory_group{};
+    ITensorPack                      run_pack{};
+    WorkspaceData<Tensor>            workspace{};
+    experimental::MemoryRequirements aux_mem_req{};
+
+    bool is_prepared{false};
+};
+
+NEQKVLinearLayer::NEQKVLinearLayer(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+NEQKVLinearLayer::~NEQKVLinearLayer() = default;
+
+void NEQKVLinearLayer::configure(const ITensor         *input,
+                                 const ITensor         *query_weights,
+                                 const ITensor         *query_bias,
+                                 const ITensor         *key_weights,
+                                 const ITensor         *key_bias,
+                                 const ITensor         *value_weights,
+                                 const ITensor         *value_bias,
+                                 ITensor               *output,
+                                 const LinearLayerInfo &linear_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, query_weights, query_bias, key_weights, key_bias, value_weights, value_bias,
+                                 output);
+    ARM_COMPUTE_LOG_PARAMS(input, output);
+
+    _impl->is_prepared = false;
+
+    _impl->kernel = std::make_unique<cpu::CpuQKVLinear>();
+    _impl->kernel->configure(input->info(), query_weights->info(), query_bias->info(), key_weights->info(),
+                             key_bias->info(), value_weights->info(), value_bias->info(), output->info(), linear_info);
+
+    _impl->aux_mem_req = _impl->kernel->workspace();
+    _impl->run_pack    = {{ACL_SRC_0, input},       {ACL_SRC_1, query_weights}, {ACL_SRC_2, query_bias},
+                          {ACL_SRC_3, key_weights}, {ACL_SRC_4, key_bias},      {ACL_SRC_5, value_weights},
+                          {ACL_SRC_6, value_bias},  {ACL_DST, output}};
+    _impl->workspace =
+        manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->run_pack);
+}
+
+Status NEQKVLinearLayer::validate(const ITensorInfo     *input,
+                                  const ITensorInfo     *query_weights,
+                                  const ITensorInfo     *query_bias,
+                                  const ITensorInfo     *key_weights,
+                                  const ITensorInfo     *key_bias,
+                                  const ITensorInfo     *value_weights,
+                                  const ITensorInfo     *value_bias,
+                                  const ITensorInfo     *output,
+                                  const LinearLayerInfo &linear_info)
+{
+    return cpu::CpuQKVLinear::validate(input, query_weights, query_bias, key_weights, key_bias, value_weights,
+                                       value_bias, output, linear_info);
+}
+
+void NEQKVLinearLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->kernel->run(_impl->run_pack);
+}
+
+void NEQKVLinearLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        _impl->kernel->prepare(_impl->run_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
+    }
+}
+
+} // namespace arm_compute
@@ -1,6 +1,9 @@
 #include "arm_compute/runtime/NEON/functions/NEScaleDotProductionAttentionLayer.h"
 
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuScaleDotProduction.h"
 #include "src/cpu/operators/CpuGemm.h"
@@ -14,11 +17,16 @@ struct NEScaleDotProductionAttentionLayer::Impl
     MemoryGroup                         memory_group{};
 
     ITensorPack                         scale_dot_pack{};
+    WorkspaceData<Tensor>               workspace{};
+    experimental::MemoryRequirements    aux_mem_req{};
 
     IRuntimeContext                    *ctx{nullptr};
 
     std::unique_ptr<cpu::CpuScaleDotProduction> scale_dot_production_op{nullptr};
 
+    bool         run_cached{false}; /**< If each run decodes one token against the key/value caches */
+    unsigned int cache_len{0};      /**< Number of tokens held in the key/value caches */
+
     bool is_prepared{false};
 };
 
@@ -33,22 +41,59 @@ NEScaleDotProductionAttentionLayer::~NEScaleDotProductionAttentionLayer() = defa
 void NEScaleDotProductionAttentionLayer::configure(const ITensor *query,
                                                    const ITensor *key,
                                                    const ITensor *value,
+                                                   const ITensor *mask,
                                                    ITensor *output,
                                                    const ScaleDotProductionAttentionLayerInfo& info)
 {
     /* Scale dot production of key and query */
     _impl->scale_dot_production_op  = std::make_unique<cpu::CpuScaleDotProduction>();
-    _impl->scale_dot_production_op->configure(query->info(),key->info(),value->info(),output->info(),info);
-    _impl->scale_dot_pack = {{ACL_SRC_0, query}, {ACL_SRC_1, key}, {ACL_SRC_2, value}, {ACL_DST, output}};
+    _impl->scale_dot_production_op->configure(query->info(),key->info(),value->info(),
+                                              (mask != nullptr) ? mask->info() : nullptr,output->info(),info);
+    _impl->run_cached     = info.max_cache_len() > 0;
+    _impl->cache_len      = 0;
+    _impl->scale_dot_pack = {{ACL_SRC_0, query}, {ACL_SRC_1, key}, {ACL_SRC_2, value}, {ACL_SRC_3, mask}, {ACL_DST, output}};
+
+    // The key/value caches are persistent workspace tensors, so they survive between decoding steps
+    _impl->aux_mem_req = _impl->scale_dot_production_op->workspace();
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->scale_dot_pack,
+                                                  _impl->scale_dot_pack);
 
 }
 
-void NEScaleDotProductionAttentionLayer::run()
+Status NEScaleDotProductionAttentionLayer::validate(const ITensorInfo *query,
+                                                    const ITensorInfo *key,
+                                                    const ITensorInfo *value,
+                                                    const ITensorInfo *mask,
+                                                    const ITensorInfo *output,
+                                                    const ScaleDotProductionAttentionLayerInfo &info)
 {
-    ITensorPack pack;
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+    // The operator only reads the output info, work on a copy to keep this check side-effect free
+    auto output_copy = output->clone();
+    return cpu::CpuScaleDotProduction::validate(query, key, value, mask, output_copy.get(), info);
+}
 
+void NEScaleDotProductionAttentionLayer::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->scale_dot_production_op->set_cache_length(_impl->cache_len);
     _impl->scale_dot_production_op->run(_impl->scale_dot_pack);
 
+    // The new token now sits in the caches, the next run attends to it
+    if (_impl->run_cached)
+    {
+        ++_impl->cache_len;
+    }
+}
+
+void NEScaleDotProductionAttentionLayer::reset_kv_cache()
+{
+    _impl->cache_len = 0;
+}
+
+unsigned int NEScaleDotProductionAttentionLayer::kv_cache_length() const
+{
+    return _impl->cache_len;
 }
 
 } // namespace arm_compute
\ No newline at end of file
@@ -104,6 +104,33 @@ public:
     }
 };
 
+/** This template synthetizes a simple ICpuOperator which runs the given kernel K on a tensor pack */
+template <typename K>
+class NESynthetizeOperator : public cpu::ICpuOperator
+{
+public:
+    /** Configure the kernel.
+     *
+     * @param[in] args Configuration arguments.
+     */
+    template <typename... Args>
+    void configure(Args &&... args)
+    {
+        auto k = std::make_unique<K>();
+        k->configure(std::forward<Args>(args)...);
+        _kernel = std::move(k);
+    }
+    /** Validate input arguments
+     *
+     * @param[in] args Configuration arguments.
+     */
+    template <typename... Args>
+    static Status validate(Args &&... args)
+    {
+        return K::validate(std::forward<Args>(args)...);
+    }
+};
+
 /** As above but this also setups a Zero border on the input tensor of the kernel's bordersize */
 template <typename K>
 class NESynthetizeFunctionWithZeroConstantKernelBorder : public cpu::ICpuOperator
@@ -71,6 +71,7 @@ RelativeTolerance<float> relative_tolerance(DataType data_type, ActivationLayerI
         case ActivationLayerInfo::ActivationFunction::HARD_SWISH:
         case ActivationLayerInfo::ActivationFunction::SWISH:
         case ActivationLayerInfo::ActivationFunction::GELU:
+        case ActivationLayerInfo::ActivationFunction::GELU_TANH:
             switch(data_type)
             {
                 case DataType::F16:
@@ -177,7 +178,7 @@ const auto CNNDataTypes = framework::dataset::make("DataType",
 });
 
 const auto NeonActivationFunctionsDataset = concat(datasets::ActivationFunctions(),
-                                                   framework::dataset::make("ActivationFunction", { ActivationLayerInfo::ActivationFunction::HARD_SWISH, ActivationLayerInfo::ActivationFunction::SWISH }));
+                                                   framework::dataset::make("ActivationFunction", { ActivationLayerInfo::ActivationFunction::HARD_SWISH, ActivationLayerInfo::ActivationFunction::SWISH, ActivationLayerInfo::ActivationFunction::GELU_TANH }));
 
 /** Input data sets. */
 const auto ActivationDataset = combine(combine(framework::dataset::make("InPlace", { false, true }), NeonActivationFunctionsDataset), framework::dataset::make("AlphaBeta", { 0.5f, 1.f }));
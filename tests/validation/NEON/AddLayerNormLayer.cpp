@@ -0,0 +1,117 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEAddLayerNormLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/AddLayerNormLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float> tolerance_f16(0.02f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-4f);
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(AddLayerNormLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("Input1Info", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F32), // Mismatching addend shapes
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F32), // Mismatching addend data types
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F32), // Mismatching sum shape
+                                  }),
+               make("Input2Info", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(27U, 1U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F16),
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                  }),
+               make("SumInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(26U, 13U), 1, DataType::F32),
+                               }),
+               make("Expected", { true, false, false, false })),
+               input1_info, input2_info, sum_info, expected)
+{
+    const TensorInfo output_info(TensorShape(27U, 13U), 1, DataType::F32);
+    const Status     status = NEAddLayerNormLayer::validate(&input1_info.clone()->set_is_resizable(false), &input2_info.clone()->set_is_resizable(false),
+                                                            nullptr, nullptr, &output_info, &sum_info.clone()->set_is_resizable(false),
+                                                            LayerNormLayerInfo());
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEAddLayerNormLayerFixture = AddLayerNormLayerValidationFixture<Tensor, Accessor, NEAddLayerNormLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAddLayerNormLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(concat(datasets::Small2DShapes(), datasets::Small3DShapes()),
+                               make("DataType", DataType::F16),
+                               make("WithSum", { true, false }),
+                               make("Epsilon", { 1e-5f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+    if(_with_sum)
+    {
+        validate(Accessor(_target_sum), _reference_sum, tolerance_f16);
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEAddLayerNormLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(concat(datasets::Small2DShapes(), datasets::Small3DShapes()),
+                               make("DataType", DataType::F32),
+                               make("WithSum", { true, false }),
+                               make("Epsilon", { 1e-5f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    if(_with_sum)
+    {
+        validate(Accessor(_target_sum), _reference_sum, tolerance_f32);
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEAddLayerNormLayerFixture<float>, framework::DatasetMode::NIGHTLY,
+                       combine(datasets::Large2DShapes(),
+                               make("DataType", DataType::F32),
+                               make("WithSum", { true }),
+                               make("Epsilon", { 1e-5f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    validate(Accessor(_target_sum), _reference_sum, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // AddLayerNormLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
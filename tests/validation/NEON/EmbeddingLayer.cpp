@@ -0,0 +1,108 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/EmbeddingLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float> tolerance_f16(0.02f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-4f);
+
+/** Single and batched sequences, with model depths that are and are not multiples of the vector length */
+const auto EmbeddingDataset = zip(make("TokensShape", { TensorShape(9U),
+                                                        TensorShape(33U, 3U),
+                                                        TensorShape(128U, 2U) }),
+                                  make("DModel", { 64U, 100U, 768U }),
+                                  make("VocabSize", { 50U, 1000U, 3000U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(EmbeddingLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("TokensInfo", { TensorInfo(TensorShape(9U, 2U), 1, DataType::U32),
+                                    TensorInfo(TensorShape(9U, 2U), 1, DataType::U8),  // Ids narrower than 32 bits
+                                    TensorInfo(TensorShape(9U, 2U), 1, DataType::U32), // Sequence longer than the position table
+                                    TensorInfo(TensorShape(9U, 2U), 1, DataType::U32), // Mismatching segment table width
+                                  }),
+               make("PositionTableInfo", { TensorInfo(TensorShape(64U, 16U), 1, DataType::F32),
+                                           TensorInfo(TensorShape(64U, 16U), 1, DataType::F32),
+                                           TensorInfo(TensorShape(64U, 8U), 1, DataType::F32),
+                                           TensorInfo(TensorShape(64U, 16U), 1, DataType::F32),
+                                         }),
+               make("SegmentTableInfo", { TensorInfo(TensorShape(64U, 2U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(64U, 2U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(64U, 2U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(32U, 2U), 1, DataType::F32),
+                                        }),
+               make("Expected", { true, false, false, false })),
+               tokens_info, position_table_info, segment_table_info, expected)
+{
+    const TensorInfo token_table_info(TensorShape(64U, 100U), 1, DataType::F32);
+    const TensorInfo dst_info(TensorShape(64U, 9U, 2U), 1, DataType::F32);
+
+    const Status status = NEEmbeddingLayer::validate(&tokens_info.clone()->set_is_resizable(false), &tokens_info.clone()->set_is_resizable(false),
+                                                     &token_table_info, &segment_table_info.clone()->set_is_resizable(false),
+                                                     &position_table_info.clone()->set_is_resizable(false), nullptr, nullptr, &dst_info,
+                                                     EmbeddingLayerInfo(64U, 100U, 2U, position_table_info.dimension(1)), true);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEEmbeddingLayerFixture = EmbeddingLayerValidationFixture<Tensor, Accessor, NEEmbeddingLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(EmbeddingDataset,
+                               make("PretrainedPositions", { true, false }),
+                               make("LayerNorm", { false, true }),
+                               make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(EmbeddingDataset,
+                               make("PretrainedPositions", { true, false }),
+                               make("LayerNorm", { false, true }),
+                               make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // EmbeddingLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,120 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELayerNormLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/LayerNormLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float> tolerance_f16(0.02f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-4f);
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LayerNormLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(27U, 13U), 1, DataType::F32), // Mismatching gamma width
+                                   TensorInfo(TensorShape(27U, 13U), 1, DataType::F32), // Mismatching gamma data type
+                                   TensorInfo(TensorShape(27U, 13U), 1, DataType::F32), // Mismatching output shape
+                                   TensorInfo(TensorShape(27U, 13U), 1, DataType::F32), // Normalization along Y
+                                 }),
+               make("GammaInfo", { TensorInfo(TensorShape(27U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(13U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(27U), 1, DataType::F16),
+                                   TensorInfo(TensorShape(27U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(27U), 1, DataType::F32),
+                                 }),
+               make("OutputInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(27U, 11U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                  }),
+               make("Axis", { 0, 0, 0, 0, 1 }),
+               make("Expected", { true, false, false, false, false })),
+               input_info, gamma_info, output_info, axis, expected)
+{
+    const Status status = NELayerNormLayer::validate(&input_info.clone()->set_is_resizable(false), &gamma_info.clone()->set_is_resizable(false),
+                                                     &gamma_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false),
+                                                     LayerNormLayerInfo(axis));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NELayerNormLayerFixture = LayerNormLayerValidationFixture<Tensor, Accessor, NELayerNormLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELayerNormLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(concat(datasets::Small2DShapes(), datasets::Small3DShapes()),
+                               make("DataType", DataType::F16),
+                               make("AffineTensors", { true, false }),
+                               make("Epsilon", { 1e-5f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NELayerNormLayerFixture<half>, framework::DatasetMode::NIGHTLY,
+                       combine(datasets::Large2DShapes(),
+                               make("DataType", DataType::F16),
+                               make("AffineTensors", { true, false }),
+                               make("Epsilon", { 1e-5f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELayerNormLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(concat(datasets::Small2DShapes(), datasets::Small3DShapes()),
+                               make("DataType", DataType::F32),
+                               make("AffineTensors", { true, false }),
+                               make("Epsilon", { 1e-5f, 1e-12f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NELayerNormLayerFixture<float>, framework::DatasetMode::NIGHTLY,
+                       combine(datasets::Large2DShapes(),
+                               make("DataType", DataType::F32),
+                               make("AffineTensors", { true, false }),
+                               make("Epsilon", { 1e-5f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // LayerNormLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,91 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELinearLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/LinearLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+RelativeTolerance<half> rel_tolerance_f16(half(0.2f));
+constexpr float         abs_tolerance_f16(0.1f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+RelativeTolerance<float> rel_tolerance_f32(0.01f);
+constexpr float          abs_tolerance_f32(0.0001f);
+/** Tolerance of the int8 dynamically quantized projection, whose error grows with the depth K of the dot products */
+RelativeTolerance<float> rel_tolerance_dynamic_qasymm8_signed(0.05f);
+constexpr float          abs_tolerance_dynamic_qasymm8_signed(0.1f);
+
+/** Inputs of a single row, of one sequence and of a batch of sequences folded into the rows of the GEMM */
+const auto LinearLayerDataset = zip(make("InputShape", { TensorShape(64U, 1U),
+                                                         TensorShape(96U, 17U),
+                                                         TensorShape(33U, 7U, 3U) }),
+                                    make("NumOutputs", { 48U, 128U, 19U }));
+
+const auto ActivationFunctionsDataset = make("ActivationInfo", { ActivationLayerInfo(),
+                                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::GELU) });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LinearLayer)
+
+template <typename T>
+using NELinearLayerFixture = LinearLayerValidationFixture<Tensor, Accessor, NELinearLayer, T>;
+template <typename T>
+using NELinearLayerDynamicQuantizationFixture = LinearLayerDynamicQuantizationValidationFixture<Tensor, Accessor, NELinearLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(LinearLayerDataset, make("DataType", DataType::F16), ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(LinearLayerDataset, make("DataType", DataType::F32), ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE(DynamicQuantization)
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NELinearLayerDynamicQuantizationFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(LinearLayerDataset, make("DataType", DataType::F32), ActivationFunctionsDataset,
+                               make("DynamicQuantizationType", DataType::QASYMM8_SIGNED)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_qasymm8_signed, 0.f, abs_tolerance_dynamic_qasymm8_signed);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // DynamicQuantization
+
+TEST_SUITE_END() // LinearLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
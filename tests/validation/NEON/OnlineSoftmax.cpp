@@ -0,0 +1,121 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "src/cpu/kernels/CpuOnlineSoftmaxKernel.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/NEON/Helper.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/OnlineSoftmaxFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float> tolerance_f16(0.01f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-5f);
+
+/** Rows that are and are not multiples of the vector length, with a mask per element, broadcast along Y, broadcast along Z and absent */
+const auto OnlineSoftmaxShapes = zip(make("Shape", { TensorShape(64U, 9U),
+                                                     TensorShape(33U, 17U, 3U),
+                                                     TensorShape(128U, 128U, 2U),
+                                                     TensorShape(7U, 5U, 4U),
+                                                     TensorShape(300U, 3U) }),
+                                     make("MaskShape", { TensorShape(64U, 9U),
+                                                         TensorShape(33U, 1U, 3U),
+                                                         TensorShape(128U, 128U, 1U),
+                                                         TensorShape(7U, 1U, 1U),
+                                                         TensorShape(300U, 1U) }),
+                                     make("HasMask", { true, true, true, true, false }));
+
+/** Unit scale and the 1 / sqrt(d_head) scale of 64-deep heads */
+const auto OnlineSoftmaxScales = make("Scale", { 1.f, 0.125f });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(OnlineSoftmax)
+
+using CpuOnlineSoftmax = NESynthetizeOperator<cpu::kernels::CpuOnlineSoftmaxKernel>;
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32), // Mask of another width
+                                   TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32), // Mask of another height
+                                   TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32), // Mismatching mask data type
+                                   TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32), // Mismatching output shape
+                                   TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::U8),  // Unsupported data type
+                                   TensorInfo(TensorShape(64U, 9U, 2U, 2U), 1, DataType::F32), // Too many dimensions
+                                 }),
+               make("MaskInfo", { TensorInfo(TensorShape(64U, 1U, 2U), 1, DataType::F32),
+                                  TensorInfo(TensorShape(64U, 9U, 1U), 1, DataType::F32),
+                                  TensorInfo(TensorShape(32U, 9U, 2U), 1, DataType::F32),
+                                  TensorInfo(TensorShape(64U, 3U, 2U), 1, DataType::F32),
+                                  TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F16),
+                                  TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                  TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::U8),
+                                  TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                }),
+               make("OutputInfo", { TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(64U, 8U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(64U, 9U, 2U), 1, DataType::U8),
+                                    TensorInfo(TensorShape(64U, 9U, 2U, 2U), 1, DataType::F32),
+                                  }),
+               make("Expected", { true, true, false, false, false, false, false, false })),
+               input_info, mask_info, output_info, expected)
+{
+    const Status status = CpuOnlineSoftmax::validate(&input_info.clone()->set_is_resizable(false), &mask_info.clone()->set_is_resizable(false),
+                                                     &output_info.clone()->set_is_resizable(false), 1.f);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using CpuOnlineSoftmaxFixture = OnlineSoftmaxValidationFixture<Tensor, Accessor, CpuOnlineSoftmax, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, CpuOnlineSoftmaxFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(OnlineSoftmaxShapes, OnlineSoftmaxScales, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, CpuOnlineSoftmaxFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(OnlineSoftmaxShapes, OnlineSoftmaxScales, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // OnlineSoftmax
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,87 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEPositionalEncodingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/PositionalEncodingLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float> tolerance_f16(0.01f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-5f);
+
+/** Single and batched sequences, with model depths that are and are not multiples of the vector length */
+const auto PositionalEncodingShapes = make("Shape", { TensorShape(64U, 9U),
+                                                      TensorShape(102U, 33U, 3U),
+                                                      TensorShape(512U, 128U),
+                                                      TensorShape(6U, 300U, 2U) });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(PositionalEncodingLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(64U, 9U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(63U, 9U), 1, DataType::F32), // Odd model depth
+                                   TensorInfo(TensorShape(64U, 9U), 1, DataType::F32), // Sequence longer than the encoded length
+                                   TensorInfo(TensorShape(64U, 9U), 1, DataType::U8),  // Unsupported data type
+                                 }),
+               make("SequenceLength", { 9U, 9U, 8U, 9U }),
+               make("Expected", { true, false, false, false })),
+               input_info, seq_len, expected)
+{
+    const Status status = NEPositionalEncodingLayer::validate(&input_info.clone()->set_is_resizable(false), &input_info.clone()->set_is_resizable(false),
+                                                              PositionalEncodingLayerInfo(seq_len, input_info.dimension(0)));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEPositionalEncodingLayerFixture = PositionalEncodingLayerValidationFixture<Tensor, Accessor, NEPositionalEncodingLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPositionalEncodingLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(PositionalEncodingShapes, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPositionalEncodingLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(PositionalEncodingShapes, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // PositionalEncodingLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
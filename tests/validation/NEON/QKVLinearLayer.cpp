@@ -0,0 +1,96 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEQKVLinearLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/QKVLinearLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+RelativeTolerance<half> rel_tolerance_f16(half(0.2f));
+constexpr float         abs_tolerance_f16(0.1f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+RelativeTolerance<float> rel_tolerance_f32(0.01f);
+constexpr float          abs_tolerance_f32(0.0001f);
+
+/** A single token, one sequence and a batch of sequences */
+const auto QKVLinearLayerDataset = zip(make("InputShape", { TensorShape(64U, 1U),
+                                                            TensorShape(96U, 17U),
+                                                            TensorShape(48U, 5U, 3U) }),
+                                       make("NumOutputs", { 64U, 96U, 32U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(QKVLinearLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(64U, 9U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 9U), 1, DataType::F32), // Input width mismatching the weights
+                                   TensorInfo(TensorShape(64U, 9U), 1, DataType::F32), // Output narrower than 3 projections
+                                   TensorInfo(TensorShape(64U, 9U), 1, DataType::S32), // Unsupported data type
+                                 }),
+               make("OutputInfo", { TensorInfo(TensorShape(192U, 9U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(192U, 9U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(64U, 9U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(192U, 9U), 1, DataType::S32),
+                                  }),
+               make("Expected", { true, false, false, false })),
+               input_info, output_info, expected)
+{
+    const TensorInfo weights_info(TensorShape(64U, 64U), 1, input_info.data_type());
+    const TensorInfo bias_info(TensorShape(64U), 1, input_info.data_type());
+    const Status     status = NEQKVLinearLayer::validate(&input_info.clone()->set_is_resizable(false), &weights_info, &bias_info, &weights_info,
+                                                         &bias_info, &weights_info, &bias_info, &output_info.clone()->set_is_resizable(false),
+                                                         LinearLayerInfo(64U));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEQKVLinearLayerFixture = QKVLinearLayerValidationFixture<Tensor, Accessor, NEQKVLinearLayer, T>;
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEQKVLinearLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(QKVLinearLayerDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEQKVLinearLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(QKVLinearLayerDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // QKVLinearLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,285 @@
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEScaleDotProductionAttentionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ScaleDotProductionAttentionFixture.h"
+
+#include <stdexcept>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Tolerance for float operations */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+const AbsoluteTolerance<half> tolerance_f16(half(0.01f));
+const AbsoluteTolerance<half> tolerance_unfused_f16(half(0.02f)); /**< Heads deeper than 256 accumulate more FP16 rounding in the GEMMs */
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+constexpr AbsoluteTolerance<float> tolerance_f32(1e-4f);
+
+/** Configurations run by the fused attention kernel: head depths up to 256 and sequence lengths that are not
+ * multiples of its 4 query rows or 64 key rows tiles
+ */
+const auto FusedAttentionDataset = zip(make("QueryShape", { TensorShape(64U, 5U),
+                                                            TensorShape(96U, 67U),
+                                                            TensorShape(72U, 3U),
+                                                            TensorShape(256U, 130U),
+                                                            TensorShape(128U, 9U, 3U) }),
+                                       make("KeySequenceLength", { 5U, 67U, 70U, 130U, 9U }),
+                                       make("Heads", { 4U, 3U, 2U, 1U, 8U }));
+
+/** Configurations whose head depth exceeds 256, run by the unfused GEMM and softmax fallback: every head is a multi
+ * of the batched assembly GEMMs, with head depths that are not multiples of the vector length, sequence lengths
+ * that are not multiples of the GEMM blocks and a single query row
+ */
+const auto UnfusedAttentionDataset = zip(make("QueryShape", { TensorShape(1024U, 7U),
+                                                              TensorShape(300U, 19U),
+                                                              TensorShape(1040U, 13U),
+                                                              TensorShape(771U, 5U),
+                                                              TensorShape(2056U, 1U) }),
+                                         make("KeySequenceLength", { 7U, 33U, 17U, 70U, 9U }),
+                                         make("Heads", { 2U, 1U, 4U, 3U, 8U }));
+
+/** Additive masks shared by every query row and batch, per batch, and per query row */
+const auto AdditiveMaskDataset = zip(make("QueryShape", { TensorShape(64U, 5U),
+                                                          TensorShape(64U, 5U, 3U),
+                                                          TensorShape(96U, 67U, 2U),
+                                                          TensorShape(64U, 9U, 2U) }),
+                                     make("KeySequenceLength", { 5U, 7U, 67U, 9U }),
+                                     make("Heads", { 4U, 2U, 3U, 8U }),
+                                     make("MaskShape", { TensorShape(5U),
+                                                         TensorShape(7U, 1U, 3U),
+                                                         TensorShape(67U, 67U, 2U),
+                                                         TensorShape(9U, 9U) }));
+
+/** Additive masks applied by the unfused fallback, which only handles a single sequence */
+const auto UnfusedAdditiveMaskDataset = zip(make("QueryShape", { TensorShape(1024U, 7U),
+                                                                 TensorShape(300U, 19U),
+                                                                 TensorShape(1040U, 13U) }),
+                                            make("KeySequenceLength", { 7U, 33U, 17U }),
+                                            make("Heads", { 2U, 1U, 4U }),
+                                            make("MaskShape", { TensorShape(7U, 7U),
+                                                                TensorShape(33U),
+                                                                TensorShape(17U, 13U) }));
+
+/** Empty sequences, full sequences and sequences of mixed lengths within a batch */
+const auto ValidLengthDataset = zip(make("Shape", { TensorShape(64U, 9U),
+                                                    TensorShape(64U, 9U),
+                                                    TensorShape(64U, 70U, 4U),
+                                                    TensorShape(32U, 5U, 3U) }),
+                                    make("Heads", { 4U, 4U, 2U, 1U }),
+                                    make("ValidLengths", { std::vector<int32_t>{ 0 },
+                                                           std::vector<int32_t>{ 9 },
+                                                           std::vector<int32_t>{ 70, 3, 0, 65 },
+                                                           std::vector<int32_t>{ 5, 1, 2 } }));
+
+/** Sequences decoded token by token through key/value caches larger than the sequence and exactly filled by it */
+const auto DecodeDataset = zip(make("Shape", { TensorShape(64U, 6U),
+                                               TensorShape(96U, 9U, 2U) }),
+                               make("Heads", { 4U, 3U }),
+                               make("MaxCacheLength", { 8U, 9U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ScaleDotProductionAttentionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("QueryInfo", { TensorInfo(TensorShape(64U, 5U, 3U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(1024U, 7U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(1024U, 7U, 2U), 1, DataType::F32), // Batched unfused attention
+                                   TensorInfo(TensorShape(96U, 5U), 1, DataType::F32),       // Heads not dividing d_model
+                                 }),
+               make("KeySequenceLength", { 9U, 7U, 7U, 5U }),
+               make("Heads", { 4U, 2U, 2U, 5U }),
+               make("Expected", { true, true, false, false })),
+               query_info, seq_k, h, expected)
+{
+    TensorShape key_shape = query_info.tensor_shape();
+    key_shape.set(1, seq_k);
+    const TensorInfo key_info = query_info.clone()->set_tensor_shape(key_shape);
+
+    const Status status = NEScaleDotProductionAttentionLayer::validate(&query_info.clone()->set_is_resizable(false), &key_info.clone()->set_is_resizable(false),
+                                                                       &key_info.clone()->set_is_resizable(false), nullptr,
+                                                                       &query_info.clone()->set_is_resizable(false),
+                                                                       ScaleDotProductionAttentionLayerInfo(query_info.dimension(0), h));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEScaleDotProductionAttentionLayerFixture = ScaleDotProductionAttentionValidationFixture<Tensor, Accessor, NEScaleDotProductionAttentionLayer, T>;
+template <typename T>
+using NEScaleDotProductionAttentionLayerAdditiveMaskFixture = ScaleDotProductionAttentionAdditiveMaskValidationFixture<Tensor, Accessor, NEScaleDotProductionAttentionLayer, T>;
+template <typename T>
+using NEScaleDotProductionAttentionLayerRunTwiceFixture = ScaleDotProductionAttentionValidationFixture<Tensor, Accessor, NEScaleDotProductionAttentionLayer, T, true>;
+template <typename T>
+using NEScaleDotProductionAttentionLayerAdditiveMaskRunTwiceFixture = ScaleDotProductionAttentionAdditiveMaskValidationFixture<Tensor, Accessor, NEScaleDotProductionAttentionLayer, T, true>;
+template <typename T>
+using NEScaleDotProductionAttentionLayerValidLengthFixture = ScaleDotProductionAttentionValidLengthValidationFixture<Tensor, Accessor, NEScaleDotProductionAttentionLayer, T>;
+template <typename T>
+using NEScaleDotProductionAttentionLayerDecodeFixture = ScaleDotProductionAttentionDecodeValidationFixture<Tensor, Accessor, NEScaleDotProductionAttentionLayer, T>;
+
+TEST_CASE(KeyValueCacheFull, framework::DatasetMode::ALL)
+{
+    const TensorShape token_shape(64U, 1U);
+
+    Tensor query = create_tensor<Tensor>(token_shape, DataType::F32);
+    Tensor key   = create_tensor<Tensor>(token_shape, DataType::F32);
+    Tensor value = create_tensor<Tensor>(token_shape, DataType::F32);
+    Tensor dst   = create_tensor<Tensor>(token_shape, DataType::F32);
+
+    NEScaleDotProductionAttentionLayer attention(nullptr);
+    attention.configure(&query, &key, &value, nullptr, &dst, ScaleDotProductionAttentionLayerInfo(64U, 4U, AttentionMaskType::NONE, 2U));
+
+    query.allocator()->allocate();
+    key.allocator()->allocate();
+    value.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_value(Accessor(query), 0.5f);
+    library->fill_tensor_value(Accessor(key), 0.5f);
+    library->fill_tensor_value(Accessor(value), 0.5f);
+
+    // Two tokens fill the cache, a third one is rejected until a new sequence starts
+    attention.run();
+    attention.run();
+    ARM_COMPUTE_EXPECT(attention.kv_cache_length() == 2U, framework::LogLevel::ERRORS);
+
+    // The check is always on, also in builds without asserts
+    bool cache_full = false;
+    try
+    {
+        attention.run();
+    }
+    catch(const std::runtime_error &)
+    {
+        cache_full = true;
+    }
+    ARM_COMPUTE_EXPECT(cache_full, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(attention.kv_cache_length() == 2U, framework::LogLevel::ERRORS);
+
+    attention.reset_kv_cache();
+    ARM_COMPUTE_EXPECT(attention.kv_cache_length() == 0U, framework::LogLevel::ERRORS);
+    attention.run();
+    ARM_COMPUTE_EXPECT(attention.kv_cache_length() == 1U, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunFused, NEScaleDotProductionAttentionLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(FusedAttentionDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunUnfused, NEScaleDotProductionAttentionLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(UnfusedAttentionDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_unfused_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunUnfusedTwice, NEScaleDotProductionAttentionLayerRunTwiceFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(UnfusedAttentionDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_unfused_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunAdditiveMask, NEScaleDotProductionAttentionLayerAdditiveMaskFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(AdditiveMaskDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunUnfusedAdditiveMask, NEScaleDotProductionAttentionLayerAdditiveMaskFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(UnfusedAdditiveMaskDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_unfused_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunValidLength, NEScaleDotProductionAttentionLayerValidLengthFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(ValidLengthDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunDecode, NEScaleDotProductionAttentionLayerDecodeFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(DecodeDataset, make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunFused, NEScaleDotProductionAttentionLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(FusedAttentionDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunUnfused, NEScaleDotProductionAttentionLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(UnfusedAttentionDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunUnfusedTwice, NEScaleDotProductionAttentionLayerRunTwiceFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(UnfusedAttentionDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunAdditiveMask, NEScaleDotProductionAttentionLayerAdditiveMaskFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(AdditiveMaskDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunUnfusedAdditiveMask, NEScaleDotProductionAttentionLayerAdditiveMaskFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(UnfusedAdditiveMaskDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunUnfusedAdditiveMaskTwice, NEScaleDotProductionAttentionLayerAdditiveMaskRunTwiceFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(UnfusedAdditiveMaskDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunValidLength, NEScaleDotProductionAttentionLayerValidLengthFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(ValidLengthDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunDecode, NEScaleDotProductionAttentionLayerDecodeFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(DecodeDataset, make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // ScaleDotProductionAttentionLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
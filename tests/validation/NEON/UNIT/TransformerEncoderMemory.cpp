@@ -0,0 +1,81 @@
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "support/Cast.h"
+#include "support/ToolchainSupport.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Peak size and number of blobs of the transition memory of @p num_layers stacked encoder blocks
+ *
+ * The transition memory holds the tensors linking the nodes of the graph: it is what grows with depth when the
+ * intermediates of a block are not released before the next block starts.
+ */
+BlobInfo transition_memory(unsigned int num_layers)
+{
+    constexpr unsigned int d_model = 64U;
+    constexpr unsigned int h       = 4U;
+    constexpr unsigned int d_ff    = 256U;
+    constexpr unsigned int seq_len = 16U;
+
+    graph::frontend::Stream stream(0, "transformer_encoder_" + support::cpp11::to_string(num_layers));
+    stream << graph::frontend::InputLayer(graph::TensorDescriptor(TensorShape(d_model, seq_len), DataType::F32), nullptr)
+           << graph::frontend::TransformerEncoderLayer(num_layers, MultiHeadAttentionLayerInfo(d_model, h), d_ff, 1e-12f,
+                                                       [](unsigned int, const std::string &) { return graph::ITensorAccessorUPtr(); })
+           << graph::frontend::OutputLayer(nullptr);
+
+    // Finalize the graph the way Stream::finalize() does, keeping the context to read its memory managers
+    graph::GraphConfig config{};
+    config.num_threads = 1;
+
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+    graph::GraphManager manager;
+    graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+    manager.finalize_graph(stream.graph(), ctx, pm, graph::Target::NEON);
+
+    const graph::MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(graph::Target::NEON);
+    ARM_COMPUTE_ASSERT(mm_ctx != nullptr && mm_ctx->cross_mm != nullptr);
+    const auto *lifetime_mgr = utils::cast::polymorphic_downcast<OffsetLifetimeManager *>(mm_ctx->cross_mm->lifetime_manager());
+    return lifetime_mgr->info();
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(TransformerEncoderMemory)
+
+DATA_TEST_CASE(PeakTransitionMemory, framework::DatasetMode::ALL, make("NumLayers", { 2U, 4U }), num_layers)
+{
+    // Every block releases its intermediates before the next one starts, so stacking blocks reuses the same memory
+    const BlobInfo single_block   = transition_memory(1U);
+    const BlobInfo stacked_blocks = transition_memory(num_layers);
+
+    ARM_COMPUTE_EXPECT(single_block.size != 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stacked_blocks.owners == single_block.owners, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stacked_blocks.size == single_block.size, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // TransformerEncoderMemory
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
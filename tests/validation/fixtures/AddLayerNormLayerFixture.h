@@ -0,0 +1,133 @@
+#ifndef ARM_COMPUTE_TEST_ADD_LAYER_NORM_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_ADD_LAYER_NORM_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/LayerNormLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class AddLayerNormLayerValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the residual addition of two @p shape tensors followed by the normalization of every row of the sum
+     *
+     * @param[in] shape     Shape of the addends and of the outputs
+     * @param[in] data_type Data type of every tensor
+     * @param[in] with_sum  True to also write the pre-normalization sum
+     * @param[in] epsilon   Lower bound of the variance
+     */
+    void setup(TensorShape shape, DataType data_type, bool with_sum, float epsilon)
+    {
+        const LayerNormLayerInfo info(0 /*Window::DimX*/, epsilon);
+
+        _with_sum = with_sum;
+        compute_target(shape, data_type, info);
+        compute_reference(shape, data_type, info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo = -1.f, float hi = 1.f)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    void compute_target(const TensorShape &shape, DataType data_type, const LayerNormLayerInfo &info)
+    {
+        // Create tensors
+        TensorType src1  = create_tensor<TensorType>(shape, data_type);
+        TensorType src2  = create_tensor<TensorType>(shape, data_type);
+        TensorType gamma = create_tensor<TensorType>(TensorShape(shape[0]), data_type);
+        TensorType beta  = create_tensor<TensorType>(TensorShape(shape[0]), data_type);
+        _target          = create_tensor<TensorType>(shape, data_type);
+        _target_sum      = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType add_norm;
+        add_norm.configure(&src1, &src2, &gamma, &beta, &_target, _with_sum ? &_target_sum : nullptr, info);
+
+        ARM_COMPUTE_ASSERT(src1.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(src2.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(_target.info()->is_resizable());
+
+        // Allocate tensors
+        src1.allocator()->allocate();
+        src2.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        _target.allocator()->allocate();
+        _target_sum.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src1.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!src2.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!_target.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src1), 0);
+        fill(AccessorType(src2), 1, 1.f, 3.f);
+        fill(AccessorType(gamma), 2, 0.5f, 1.5f);
+        fill(AccessorType(beta), 3);
+
+        // Compute function
+        add_norm.run();
+    }
+
+    void compute_reference(const TensorShape &shape, DataType data_type, const LayerNormLayerInfo &info)
+    {
+        // Create reference
+        SimpleTensor<T> src1{ shape, data_type };
+        SimpleTensor<T> src2{ shape, data_type };
+        SimpleTensor<T> gamma{ TensorShape(shape[0]), data_type };
+        SimpleTensor<T> beta{ TensorShape(shape[0]), data_type };
+
+        // Fill reference
+        fill(src1, 0);
+        fill(src2, 1, 1.f, 3.f);
+        fill(gamma, 2, 0.5f, 1.5f);
+        fill(beta, 3);
+
+        _reference_sum = reference::arithmetic_operation<T>(reference::ArithmeticOperation::ADD, src1, src2, data_type, ConvertPolicy::SATURATE);
+        _reference     = reference::layer_norm_layer<T>(_reference_sum, gamma, beta, info.epsilon());
+    }
+
+    TensorType      _target{};
+    TensorType      _target_sum{};
+    SimpleTensor<T> _reference{};
+    SimpleTensor<T> _reference_sum{};
+    bool            _with_sum{ false };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_ADD_LAYER_NORM_LAYER_FIXTURE */
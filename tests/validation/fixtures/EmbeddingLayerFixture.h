@@ -0,0 +1,179 @@
+#ifndef ARM_COMPUTE_TEST_EMBEDDING_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_EMBEDDING_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/EmbeddingLayer.h"
+#include "tests/validation/reference/LayerNormLayer.h"
+#include "tests/validation/reference/PositionalEncodingLayer.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class EmbeddingLayerValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the embedding of [seq, batch] token ids, optionally normalized
+     *
+     * @param[in] tokens_shape Shape of the token and segment ids
+     * @param[in] d_model      Width of every embedding table
+     * @param[in] vocab_size   Number of rows of the token table
+     * @param[in] pretrained   True to read the positions from a table, false to use the sinusoidal encoding
+     * @param[in] layer_norm   True to normalize the summed embeddings with per-channel gamma and beta
+     * @param[in] data_type    Data type of the tables and of the output
+     */
+    void setup(TensorShape tokens_shape, unsigned int d_model, unsigned int vocab_size, bool pretrained, bool layer_norm, DataType data_type)
+    {
+        _vocab_size = vocab_size;
+        _pretrained = pretrained;
+
+        // Positions past the sequence are never read
+        const TensorShape token_table_shape(d_model, vocab_size);
+        const TensorShape segment_table_shape(d_model, _num_segments);
+        const TensorShape position_table_shape(d_model, tokens_shape[0] + 3);
+        const EmbeddingLayerInfo emb_info(d_model, vocab_size, _num_segments, position_table_shape[1], pretrained, ConvertPolicy::SATURATE, data_type);
+
+        _target    = compute_target(tokens_shape, token_table_shape, segment_table_shape, position_table_shape, emb_info, layer_norm, data_type);
+        _reference = compute_reference(tokens_shape, token_table_shape, segment_table_shape, position_table_shape, layer_norm, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo = -1.f, float hi = 1.f)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    template <typename U>
+    void fill_ids(U &&tensor, int i, uint32_t num_rows)
+    {
+        std::uniform_int_distribution<uint32_t> distribution(0, num_rows - 1);
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &tokens_shape, const TensorShape &token_table_shape, const TensorShape &segment_table_shape,
+                              const TensorShape &position_table_shape, const EmbeddingLayerInfo &emb_info, bool layer_norm, DataType data_type)
+    {
+        // Create tensors
+        TensorType tokens         = create_tensor<TensorType>(tokens_shape, DataType::U32);
+        TensorType segments       = create_tensor<TensorType>(tokens_shape, DataType::U32);
+        TensorType token_table    = create_tensor<TensorType>(token_table_shape, data_type);
+        TensorType segment_table  = create_tensor<TensorType>(segment_table_shape, data_type);
+        TensorType position_table = create_tensor<TensorType>(position_table_shape, data_type);
+        TensorType gamma          = create_tensor<TensorType>(TensorShape(token_table_shape[0]), data_type);
+        TensorType beta           = create_tensor<TensorType>(TensorShape(token_table_shape[0]), data_type);
+        TensorType dst;
+
+        // Create and configure function
+        FunctionType embedding;
+        embedding.configure(&tokens, &segments, &token_table, &segment_table, _pretrained ? &position_table : nullptr, layer_norm ? &gamma : nullptr,
+                            layer_norm ? &beta : nullptr, &dst, emb_info, layer_norm, LayerNormLayerInfo(0 /*Window::DimX*/, _epsilon));
+
+        ARM_COMPUTE_ASSERT(tokens.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        tokens.allocator()->allocate();
+        segments.allocator()->allocate();
+        token_table.allocator()->allocate();
+        segment_table.allocator()->allocate();
+        position_table.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!tokens.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill_ids(AccessorType(tokens), 0, _vocab_size);
+        fill_ids(AccessorType(segments), 1, _num_segments);
+        fill(AccessorType(token_table), 2);
+        fill(AccessorType(segment_table), 3);
+        fill(AccessorType(position_table), 4);
+        fill(AccessorType(gamma), 5, 0.5f, 1.5f);
+        fill(AccessorType(beta), 6);
+
+        // Compute function, twice since the sinusoidal encoding table is only computed on the first run
+        embedding.run();
+        embedding.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &tokens_shape, const TensorShape &token_table_shape, const TensorShape &segment_table_shape,
+                                      const TensorShape &position_table_shape, bool layer_norm, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<uint32_t> tokens{ tokens_shape, DataType::U32 };
+        SimpleTensor<uint32_t> segments{ tokens_shape, DataType::U32 };
+        SimpleTensor<T>        token_table{ token_table_shape, data_type };
+        SimpleTensor<T>        segment_table{ segment_table_shape, data_type };
+        SimpleTensor<T>        position_table{ position_table_shape, data_type };
+        SimpleTensor<T>        gamma{ TensorShape(token_table_shape[0]), data_type };
+        SimpleTensor<T>        beta{ TensorShape(token_table_shape[0]), data_type };
+
+        // Fill reference
+        fill_ids(tokens, 0, _vocab_size);
+        fill_ids(segments, 1, _num_segments);
+        fill(token_table, 2);
+        fill(segment_table, 3);
+        fill(position_table, 4);
+        fill(gamma, 5, 0.5f, 1.5f);
+        fill(beta, 6);
+
+        SimpleTensor<T> sum{};
+        if(_pretrained)
+        {
+            sum = reference::embedding_layer<T>(tokens, segments, token_table, segment_table, position_table);
+        }
+        else
+        {
+            SimpleTensor<T> no_position{ position_table_shape, data_type };
+            std::fill_n(no_position.data(), no_position.num_elements(), static_cast<T>(0));
+            sum = reference::positional_encoding_layer<T>(reference::embedding_layer<T>(tokens, segments, token_table, segment_table, no_position));
+        }
+        return layer_norm ? reference::layer_norm_layer<T>(sum, gamma, beta, _epsilon) : sum;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    unsigned int    _vocab_size{ 0 };
+    bool            _pretrained{ true };
+    unsigned int    _num_segments{ 2 };
+    float           _epsilon{ 1e-5f };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_EMBEDDING_LAYER_FIXTURE */
@@ -0,0 +1,128 @@
+#ifndef ARM_COMPUTE_TEST_LAYER_NORM_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_LAYER_NORM_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/LayerNormLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LayerNormLayerValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the normalization of every row of a @p shape tensor
+     *
+     * @param[in] shape          Shape of the input and of the output
+     * @param[in] data_type      Data type of every tensor
+     * @param[in] affine_tensors True to pass per-channel gamma and beta tensors, false to use the scalars of the layer info
+     * @param[in] epsilon        Lower bound of the variance
+     */
+    void setup(TensorShape shape, DataType data_type, bool affine_tensors, float epsilon)
+    {
+        const LayerNormLayerInfo info(0 /*Window::DimX*/, epsilon, 1.5f, 0.25f);
+
+        _target    = compute_target(shape, data_type, affine_tensors, info);
+        _reference = compute_reference(shape, data_type, affine_tensors, info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo = -1.f, float hi = 1.f)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &shape, DataType data_type, bool affine_tensors, const LayerNormLayerInfo &info)
+    {
+        // Create tensors
+        TensorType src   = create_tensor<TensorType>(shape, data_type);
+        TensorType gamma = create_tensor<TensorType>(TensorShape(shape[0]), data_type);
+        TensorType beta  = create_tensor<TensorType>(TensorShape(shape[0]), data_type);
+        TensorType dst   = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType norm;
+        norm.configure(&src, affine_tensors ? &gamma : nullptr, affine_tensors ? &beta : nullptr, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors, the input is offset from zero to exercise the shifted statistics
+        fill(AccessorType(src), 0, 2.f, 4.f);
+        fill(AccessorType(gamma), 1, 0.5f, 1.5f);
+        fill(AccessorType(beta), 2);
+
+        // Compute function
+        norm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, DataType data_type, bool affine_tensors, const LayerNormLayerInfo &info)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+        SimpleTensor<T> gamma{ TensorShape(shape[0]), data_type };
+        SimpleTensor<T> beta{ TensorShape(shape[0]), data_type };
+
+        // Fill reference
+        fill(src, 0, 2.f, 4.f);
+        if(affine_tensors)
+        {
+            fill(gamma, 1, 0.5f, 1.5f);
+            fill(beta, 2);
+        }
+        else
+        {
+            std::fill_n(gamma.data(), gamma.num_elements(), static_cast<T>(info.gamma()));
+            std::fill_n(beta.data(), beta.num_elements(), static_cast<T>(info.beta()));
+        }
+
+        return reference::layer_norm_layer<T>(src, gamma, beta, info.epsilon());
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LAYER_NORM_LAYER_FIXTURE */
@@ -0,0 +1,153 @@
+#ifndef ARM_COMPUTE_TEST_LINEAR_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_LINEAR_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/LinearLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerValidationGenericFixture : public framework::Fixture
+{
+public:
+    /** Set up the projection of a [K, M, ...] input on @p num_outputs output channels
+     *
+     * @param[in] input_shape               Shape of the input
+     * @param[in] num_outputs               Number of output channels N
+     * @param[in] data_type                 Data type of every tensor
+     * @param[in] act_info                  Activation fused into the projection
+     * @param[in] dynamic_quantization_type Data type the operands are quantized to on the fly, DataType::UNKNOWN to compute in @p data_type
+     */
+    void setup(TensorShape input_shape, unsigned int num_outputs, DataType data_type, ActivationLayerInfo act_info, DataType dynamic_quantization_type)
+    {
+        const TensorShape weights_shape(input_shape[0], num_outputs);
+        const TensorShape bias_shape(num_outputs);
+        TensorShape       output_shape = input_shape;
+        output_shape.set(0, num_outputs);
+
+        LinearLayerInfo linear_info(num_outputs, weights_shape, bias_shape, act_info);
+        linear_info.set_dynamic_quantization_type(dynamic_quantization_type);
+
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, data_type, linear_info);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, data_type, act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                              DataType data_type, const LinearLayerInfo &linear_info)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, data_type);
+        TensorType weights = create_tensor<TensorType>(weights_shape, data_type);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, data_type);
+        TensorType dst     = create_tensor<TensorType>(output_shape, data_type);
+
+        // Create and configure function
+        FunctionType linear;
+        linear.configure(&src, &weights, &bias, &dst, linear_info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(bias), 2);
+
+        // Compute function
+        linear.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, DataType data_type,
+                                      const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<T> src{ input_shape, data_type };
+        SimpleTensor<T> weights{ weights_shape, data_type };
+        SimpleTensor<T> bias{ bias_shape, data_type };
+
+        // Fill reference
+        fill(src, 0);
+        fill(weights, 1);
+        fill(bias, 2);
+
+        return reference::linear_layer<T>(src, weights, bias, act_info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerValidationFixture : public LinearLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape input_shape, unsigned int num_outputs, DataType data_type, ActivationLayerInfo act_info)
+    {
+        LinearLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(input_shape, num_outputs, data_type, act_info, DataType::UNKNOWN);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class LinearLayerDynamicQuantizationValidationFixture : public LinearLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape input_shape, unsigned int num_outputs, DataType data_type, ActivationLayerInfo act_info, DataType dynamic_quantization_type)
+    {
+        LinearLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(input_shape, num_outputs, data_type, act_info, dynamic_quantization_type);
+    }
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LINEAR_LAYER_FIXTURE */
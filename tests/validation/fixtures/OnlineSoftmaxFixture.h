@@ -0,0 +1,148 @@
+#ifndef ARM_COMPUTE_TEST_ONLINE_SOFTMAX_FIXTURE
+#define ARM_COMPUTE_TEST_ONLINE_SOFTMAX_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/SoftmaxLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename OperatorType, typename T>
+class OnlineSoftmaxValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up softmax(scale * src + mask) along X
+     *
+     * @param[in] shape      Shape of the scores and of the output
+     * @param[in] mask_shape Shape of the additive mask, [shape.x, 1 or shape.y, 1 or shape.z]
+     * @param[in] has_mask   Whether the mask is given to the kernel, @p mask_shape is ignored otherwise
+     * @param[in] scale      Factor applied to the scores before the mask is added
+     * @param[in] data_type  Data type of the scores, of the mask and of the output
+     */
+    void setup(TensorShape shape, TensorShape mask_shape, bool has_mask, float scale, DataType data_type)
+    {
+        _target    = compute_target(shape, mask_shape, has_mask, scale, data_type);
+        _reference = compute_reference(shape, mask_shape, has_mask, scale, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed, float lo, float hi)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, seed);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, seed);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &shape, const TensorShape &mask_shape, bool has_mask, float scale, DataType data_type)
+    {
+        // Create tensors
+        TensorType src  = create_tensor<TensorType>(shape, data_type);
+        TensorType mask = create_tensor<TensorType>(mask_shape, data_type);
+        TensorType dst  = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure operator
+        OperatorType softmax;
+        softmax.configure(src.info(), has_mask ? mask.info() : nullptr, dst.info(), scale);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0, -5.f, 5.f);
+
+        ITensorPack pack{ { arm_compute::TensorType::ACL_SRC_0, &src }, { arm_compute::TensorType::ACL_DST, &dst } };
+        if(has_mask)
+        {
+            mask.allocator()->allocate();
+            fill(AccessorType(mask), 1, -10.f, 0.f);
+            pack.add_const_tensor(arm_compute::TensorType::ACL_SRC_1, &mask);
+        }
+
+        // Compute operator
+        softmax.run(pack);
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, const TensorShape &mask_shape, bool has_mask, float scale, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+        SimpleTensor<T> mask{ mask_shape, data_type };
+
+        // Fill reference
+        fill(src, 0, -5.f, 5.f);
+        if(has_mask)
+        {
+            fill(mask, 1, -10.f, 0.f);
+        }
+
+        // Scale the scores and add the mask, broadcast along Y and Z when those dimensions are 1
+        SimpleTensor<T> scores{ shape, data_type };
+        const int       width     = shape[0];
+        const int       height    = shape[1];
+        const int       depth     = shape.total_size_upper(2);
+        const int       mask_rows = mask_shape[1];
+        for(int z = 0; z < depth; ++z)
+        {
+            for(int y = 0; y < height; ++y)
+            {
+                const int mask_y = (mask_shape[1] > 1) ? y : 0;
+                const int mask_z = (mask_shape[2] > 1) ? z : 0;
+                for(int x = 0; x < width; ++x)
+                {
+                    const int i     = x + (y + z * height) * width;
+                    float     score = static_cast<float>(src[i]) * scale;
+                    if(has_mask)
+                    {
+                        score += static_cast<float>(mask[x + (mask_y + mask_z * mask_rows) * width]);
+                    }
+                    scores[i] = static_cast<T>(score);
+                }
+            }
+        }
+
+        return reference::softmax_layer<T>(scores, 1.f);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_ONLINE_SOFTMAX_FIXTURE */
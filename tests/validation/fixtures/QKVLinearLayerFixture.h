@@ -0,0 +1,144 @@
+#ifndef ARM_COMPUTE_TEST_QKV_LINEAR_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_QKV_LINEAR_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ConcatenateLayer.h"
+#include "tests/validation/reference/LinearLayer.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class QKVLinearLayerValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the query, key and value projections of a [K, M, ...] input on @p num_outputs channels each
+     *
+     * @param[in] input_shape Shape of the input
+     * @param[in] num_outputs Number of output channels of each projection
+     * @param[in] data_type   Data type of every tensor
+     */
+    void setup(TensorShape input_shape, unsigned int num_outputs, DataType data_type)
+    {
+        const TensorShape weights_shape(input_shape[0], num_outputs);
+        const TensorShape bias_shape(num_outputs);
+        TensorShape       output_shape = input_shape;
+        output_shape.set(0, 3 * num_outputs);
+
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape, data_type);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                              DataType data_type)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(input_shape, data_type);
+        TensorType dst = create_tensor<TensorType>(output_shape, data_type);
+
+        std::vector<TensorType> params(6);
+        for(size_t i = 0; i < params.size(); ++i)
+        {
+            params[i] = create_tensor<TensorType>((i % 2 == 0) ? weights_shape : bias_shape, data_type);
+        }
+
+        // Create and configure function
+        FunctionType qkv;
+        qkv.configure(&src, &params[0], &params[1], &params[2], &params[3], &params[4], &params[5], &dst,
+                      LinearLayerInfo(weights_shape[1], weights_shape, bias_shape));
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        for(auto &param : params)
+        {
+            param.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!param.info()->is_resizable());
+        }
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        for(size_t i = 0; i < params.size(); ++i)
+        {
+            fill(AccessorType(params[i]), 1 + i);
+        }
+
+        // Compute function, the second run reads the weights packed by the first one
+        qkv.run();
+        qkv.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
+                                      DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{ input_shape, data_type };
+        fill(src, 0);
+
+        // Query, key and value projections, stacked along X
+        std::vector<SimpleTensor<T>> projections;
+        for(int i = 0; i < 3; ++i)
+        {
+            SimpleTensor<T> weights{ weights_shape, data_type };
+            SimpleTensor<T> bias{ bias_shape, data_type };
+            fill(weights, 1 + 2 * i);
+            fill(bias, 2 + 2 * i);
+            projections.emplace_back(reference::linear_layer<T>(src, weights, bias, ActivationLayerInfo()));
+        }
+
+        SimpleTensor<T> dst{ output_shape, data_type };
+        return reference::concatenate_layer<T>(projections, dst, Window::DimX);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_QKV_LINEAR_LAYER_FIXTURE */
@@ -0,0 +1,369 @@
+#ifndef ARM_COMPUTE_TEST_SCALE_DOT_PRODUCTION_ATTENTION_FIXTURE
+#define ARM_COMPUTE_TEST_SCALE_DOT_PRODUCTION_ATTENTION_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ScaleDotProductionAttention.h"
+
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool run_twice = false>
+class ScaleDotProductionAttentionGenericValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the attention of a [d_model, seq_q, batch] query over [d_model, seq_k, batch] keys and values
+     *
+     * @param[in] query_shape   Shape of the query and of the output
+     * @param[in] seq_k         Number of key and value rows
+     * @param[in] h             Number of heads
+     * @param[in] data_type     Data type of the query, key, value and output
+     * @param[in] mask_type     Type of the attention mask
+     * @param[in] mask_shape    Shape of the additive mask, ignored for the other mask types
+     * @param[in] valid_lengths Valid length of every sequence for valid-length masks, ignored for the other mask types
+     */
+    void setup(TensorShape query_shape, unsigned int seq_k, unsigned int h, DataType data_type, AttentionMaskType mask_type, TensorShape mask_shape,
+               std::vector<int32_t> valid_lengths)
+    {
+        TensorShape key_shape = query_shape;
+        key_shape.set(1, seq_k);
+
+        _mask_type     = mask_type;
+        _valid_lengths = std::move(valid_lengths);
+        if(mask_type == AttentionMaskType::VALID_LENGTH)
+        {
+            mask_shape = TensorShape(_valid_lengths.size());
+        }
+        _mask_data_type = (mask_type == AttentionMaskType::VALID_LENGTH) ? DataType::S32 : data_type;
+
+        _target    = compute_target(query_shape, key_shape, mask_shape, h, data_type);
+        _reference = compute_reference(query_shape, key_shape, mask_shape, h, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo = -1.f, float hi = 1.f)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    template <typename U>
+    void fill_mask(U &&mask)
+    {
+        if(_mask_type == AttentionMaskType::VALID_LENGTH)
+        {
+            for(size_t b = 0; b < _valid_lengths.size(); ++b)
+            {
+                *reinterpret_cast<int32_t *>(mask(Coordinates(b))) = _valid_lengths[b];
+            }
+        }
+        else
+        {
+            fill(mask, 3, -4.f, 0.f);
+        }
+    }
+
+    TensorType compute_target(const TensorShape &query_shape, const TensorShape &key_shape, const TensorShape &mask_shape, unsigned int h, DataType data_type)
+    {
+        const bool has_mask = _mask_type != AttentionMaskType::NONE;
+
+        // Create tensors
+        TensorType query = create_tensor<TensorType>(query_shape, data_type);
+        TensorType key   = create_tensor<TensorType>(key_shape, data_type);
+        TensorType value = create_tensor<TensorType>(key_shape, data_type);
+        TensorType mask  = create_tensor<TensorType>(mask_shape, _mask_data_type);
+        TensorType dst   = create_tensor<TensorType>(query_shape, data_type);
+
+        // Create and configure function
+        FunctionType attention(nullptr);
+        attention.configure(&query, &key, &value, has_mask ? &mask : nullptr, &dst, ScaleDotProductionAttentionLayerInfo(query_shape[0], h, _mask_type));
+
+        ARM_COMPUTE_ASSERT(query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(key.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(value.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        query.allocator()->allocate();
+        key.allocator()->allocate();
+        value.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!key.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!value.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(query), 0);
+        fill(AccessorType(key), 1);
+        fill(AccessorType(value), 2);
+        if(has_mask)
+        {
+            mask.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!mask.info()->is_resizable());
+            fill_mask(AccessorType(mask));
+        }
+
+        if(run_twice)
+        {
+            // Inputs that change between runs must not be served from a previous run
+            attention.run();
+            fill(AccessorType(query), 4);
+            fill(AccessorType(key), 5);
+            fill(AccessorType(value), 6);
+        }
+
+        // Compute function
+        attention.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &query_shape, const TensorShape &key_shape, const TensorShape &mask_shape, unsigned int h, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> query{ query_shape, data_type };
+        SimpleTensor<T> key{ key_shape, data_type };
+        SimpleTensor<T> value{ key_shape, data_type };
+
+        // Fill reference, with the inputs of the last run
+        fill(query, run_twice ? 4 : 0);
+        fill(key, run_twice ? 5 : 1);
+        fill(value, run_twice ? 6 : 2);
+
+        switch(_mask_type)
+        {
+            case AttentionMaskType::ADDITIVE:
+            {
+                SimpleTensor<T> mask{ mask_shape, data_type };
+                fill_mask(mask);
+                return reference::scale_dot_production_attention<T>(query, key, value, mask, h);
+            }
+            case AttentionMaskType::VALID_LENGTH:
+            {
+                SimpleTensor<int32_t> valid_lengths{ mask_shape, DataType::S32 };
+                fill_mask(valid_lengths);
+                return reference::scale_dot_production_attention<T>(query, key, value, valid_lengths, h);
+            }
+            default:
+                return reference::scale_dot_production_attention<T>(query, key, value, h);
+        }
+    }
+
+    TensorType           _target{};
+    SimpleTensor<T>      _reference{};
+    AttentionMaskType    _mask_type{ AttentionMaskType::NONE };
+    DataType             _mask_data_type{ DataType::UNKNOWN };
+    std::vector<int32_t> _valid_lengths{};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool run_twice = false>
+class ScaleDotProductionAttentionValidationFixture : public ScaleDotProductionAttentionGenericValidationFixture<TensorType, AccessorType, FunctionType, T, run_twice>
+{
+public:
+    void setup(TensorShape query_shape, unsigned int seq_k, unsigned int h, DataType data_type)
+    {
+        ScaleDotProductionAttentionGenericValidationFixture<TensorType, AccessorType, FunctionType, T, run_twice>::setup(query_shape, seq_k, h, data_type, AttentionMaskType::NONE,
+                                                                                                             TensorShape(), std::vector<int32_t>());
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool run_twice = false>
+class ScaleDotProductionAttentionAdditiveMaskValidationFixture : public ScaleDotProductionAttentionGenericValidationFixture<TensorType, AccessorType, FunctionType, T, run_twice>
+{
+public:
+    void setup(TensorShape query_shape, unsigned int seq_k, unsigned int h, TensorShape mask_shape, DataType data_type)
+    {
+        ScaleDotProductionAttentionGenericValidationFixture<TensorType, AccessorType, FunctionType, T, run_twice>::setup(query_shape, seq_k, h, data_type, AttentionMaskType::ADDITIVE,
+                                                                                                             mask_shape, std::vector<int32_t>());
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ScaleDotProductionAttentionValidLengthValidationFixture : public ScaleDotProductionAttentionGenericValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape shape, unsigned int h, std::vector<int32_t> valid_lengths, DataType data_type)
+    {
+        ScaleDotProductionAttentionGenericValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(shape, shape[1], h, data_type, AttentionMaskType::VALID_LENGTH,
+                                                                                                             TensorShape(), std::move(valid_lengths));
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ScaleDotProductionAttentionDecodeValidationFixture : public framework::Fixture
+{
+public:
+    /** Set up the token by token decoding of a [d_model, num_tokens, batch] sequence through the key/value cache
+     *
+     * @param[in] shape         Shape of the decoded query, key and value sequences and of the output
+     * @param[in] h             Number of heads
+     * @param[in] max_cache_len Capacity in tokens of the key/value cache, at least the number of tokens
+     * @param[in] data_type     Data type of the query, key, value and output
+     */
+    void setup(TensorShape shape, unsigned int h, unsigned int max_cache_len, DataType data_type)
+    {
+        _target    = compute_target(shape, h, max_cache_len, data_type);
+        _reference = compute_reference(shape, h, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                ARM_COMPUTE_ERROR("Unsupported data type.");
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &shape, unsigned int h, unsigned int max_cache_len, DataType data_type)
+    {
+        TensorShape token_shape = shape;
+        token_shape.set(1, 1);
+
+        // Create tensors
+        TensorType query = create_tensor<TensorType>(token_shape, data_type);
+        TensorType key   = create_tensor<TensorType>(token_shape, data_type);
+        TensorType value = create_tensor<TensorType>(token_shape, data_type);
+        TensorType dst   = create_tensor<TensorType>(token_shape, data_type);
+        TensorType out   = create_tensor<TensorType>(shape, data_type);
+
+        // Create and configure function
+        FunctionType attention(nullptr);
+        attention.configure(&query, &key, &value, nullptr, &dst,
+                            ScaleDotProductionAttentionLayerInfo(shape[0], h, AttentionMaskType::NONE, max_cache_len));
+
+        // Allocate tensors
+        query.allocator()->allocate();
+        key.allocator()->allocate();
+        value.allocator()->allocate();
+        dst.allocator()->allocate();
+        out.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!query.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!out.info()->is_resizable());
+
+        // The whole sequences are generated as in the reference, then fed one token per run
+        SimpleTensor<T> query_seq{ shape, data_type };
+        SimpleTensor<T> key_seq{ shape, data_type };
+        SimpleTensor<T> value_seq{ shape, data_type };
+        fill(query_seq, 0);
+        fill(key_seq, 1);
+        fill(value_seq, 2);
+
+        AccessorType query_acc(query);
+        AccessorType key_acc(key);
+        AccessorType value_acc(value);
+        AccessorType dst_acc(dst);
+        AccessorType out_acc(out);
+
+        const unsigned int batch = shape.total_size_upper(2);
+        for(unsigned int t = 0; t < shape[1]; ++t)
+        {
+            for(unsigned int b = 0; b < batch; ++b)
+            {
+                for(unsigned int x = 0; x < shape[0]; ++x)
+                {
+                    *reinterpret_cast<T *>(query_acc(Coordinates(x, 0, b))) = *reinterpret_cast<const T *>(query_seq(Coordinates(x, t, b)));
+                    *reinterpret_cast<T *>(key_acc(Coordinates(x, 0, b)))   = *reinterpret_cast<const T *>(key_seq(Coordinates(x, t, b)));
+                    *reinterpret_cast<T *>(value_acc(Coordinates(x, 0, b))) = *reinterpret_cast<const T *>(value_seq(Coordinates(x, t, b)));
+                }
+            }
+
+            // Compute function
+            attention.run();
+            ARM_COMPUTE_EXPECT(attention.kv_cache_length() == t + 1, framework::LogLevel::ERRORS);
+
+            for(unsigned int b = 0; b < batch; ++b)
+            {
+                for(unsigned int x = 0; x < shape[0]; ++x)
+                {
+                    *reinterpret_cast<T *>(out_acc(Coordinates(x, t, b))) = *reinterpret_cast<const T *>(dst_acc(Coordinates(x, 0, b)));
+                }
+            }
+        }
+
+        return out;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, unsigned int h, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> query{ shape, data_type };
+        SimpleTensor<T> key{ shape, data_type };
+        SimpleTensor<T> value{ shape, data_type };
+
+        // Fill reference
+        fill(query, 0);
+        fill(key, 1);
+        fill(value, 2);
+
+        // Decoding token t attends to the tokens up to t, which is the whole sequence under a causal mask
+        const unsigned int num_tokens = shape[1];
+        SimpleTensor<T>    causal_mask{ TensorShape(num_tokens, num_tokens), data_type };
+        for(unsigned int q = 0; q < num_tokens; ++q)
+        {
+            for(unsigned int k = 0; k < num_tokens; ++k)
+            {
+                causal_mask[k + q * num_tokens] = (k <= q) ? static_cast<T>(0) : static_cast<T>(-std::numeric_limits<float>::infinity());
+            }
+        }
+
+        return reference::scale_dot_production_attention<T>(query, key, value, causal_mask, h);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCALE_DOT_PRODUCTION_ATTENTION_FIXTURE */
@@ -90,6 +90,9 @@ inline T activate_float(T x, T a, T b, ActivationLayerInfo::ActivationFunction a
         case ActivationLayerInfo::ActivationFunction::GELU:
             ret = x * 0.5f * (1 + erf(x / std::sqrt(2.0f)));
             break;
+        case ActivationLayerInfo::ActivationFunction::GELU_TANH:
+            ret = x * 0.5f * (1 + std::tanh(0.7978845608f * (x + 0.044715f * x * x * x)));
+            break;
         default:
             ARM_COMPUTE_ERROR("Unsupported activation function");
             break;
@@ -0,0 +1,51 @@
+#include "EmbeddingLayer.h"
+
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> embedding_layer(const SimpleTensor<uint32_t> &tokens,
+                                const SimpleTensor<uint32_t> &segments,
+                                const SimpleTensor<T>        &token_table,
+                                const SimpleTensor<T>        &segment_table,
+                                const SimpleTensor<T>        &position_table)
+{
+    const int d_model = token_table.shape()[0];
+    const int seq     = tokens.shape()[0];
+    const int batch   = tokens.shape().total_size_upper(1);
+
+    // Create reference
+    SimpleTensor<T> dst{ TensorShape(d_model, seq, batch), token_table.data_type(), 1 };
+
+    for(int b = 0; b < batch; ++b)
+    {
+        for(int s = 0; s < seq; ++s)
+        {
+            const int token   = static_cast<int>(tokens[s + b * seq]);
+            const int segment = static_cast<int>(segments[s + b * seq]);
+            for(int x = 0; x < d_model; ++x)
+            {
+                const float sum = static_cast<float>(token_table[x + token * d_model]) + static_cast<float>(segment_table[x + segment * d_model])
+                                  + static_cast<float>(position_table[x + s * d_model]);
+                dst[x + (s + b * seq) * d_model] = static_cast<T>(sum);
+            }
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> embedding_layer(const SimpleTensor<uint32_t> &tokens, const SimpleTensor<uint32_t> &segments, const SimpleTensor<float> &token_table,
+                                             const SimpleTensor<float> &segment_table, const SimpleTensor<float> &position_table);
+template SimpleTensor<half> embedding_layer(const SimpleTensor<uint32_t> &tokens, const SimpleTensor<uint32_t> &segments, const SimpleTensor<half> &token_table,
+                                            const SimpleTensor<half> &segment_table, const SimpleTensor<half> &position_table);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,35 @@
+#ifndef ARM_COMPUTE_TEST_EMBEDDING_LAYER_H
+#define ARM_COMPUTE_TEST_EMBEDDING_LAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Sum of the token, segment and position embeddings of every token
+ *
+ * @param[in] tokens         Token ids, shape [seq, batch]
+ * @param[in] segments       Segment ids, shape [seq, batch]
+ * @param[in] token_table    Token embedding table, shape [d_model, vocab_size]
+ * @param[in] segment_table  Segment embedding table, shape [d_model, num_segments]
+ * @param[in] position_table Position embedding table, shape [d_model, max_position]
+ *
+ * @return the embeddings, of shape [d_model, seq, batch]
+ */
+template <typename T>
+SimpleTensor<T> embedding_layer(const SimpleTensor<uint32_t> &tokens,
+                                const SimpleTensor<uint32_t> &segments,
+                                const SimpleTensor<T>        &token_table,
+                                const SimpleTensor<T>        &segment_table,
+                                const SimpleTensor<T>        &position_table);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_EMBEDDING_LAYER_H */
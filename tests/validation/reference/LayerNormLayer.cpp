@@ -0,0 +1,56 @@
+#include "LayerNormLayer.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> layer_norm_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &gamma, const SimpleTensor<T> &beta, float epsilon)
+{
+    // Create reference
+    SimpleTensor<T> dst{ src.shape(), src.data_type(), 1 };
+
+    const int cols = src.shape()[0];
+    const int rows = src.shape().total_size_upper(1);
+
+    for(int i = 0; i < rows; ++i)
+    {
+        // Two pass statistics in float, whatever the storage type
+        float sum = 0.f;
+        for(int j = 0; j < cols; ++j)
+        {
+            sum += static_cast<float>(src[j + i * cols]);
+        }
+        const float mean = sum / static_cast<float>(cols);
+
+        float sum_sq = 0.f;
+        for(int j = 0; j < cols; ++j)
+        {
+            const float diff = static_cast<float>(src[j + i * cols]) - mean;
+            sum_sq += diff * diff;
+        }
+        const float rstd = 1.f / std::sqrt(sum_sq / static_cast<float>(cols) + epsilon);
+
+        for(int j = 0; j < cols; ++j)
+        {
+            const float norm  = (static_cast<float>(src[j + i * cols]) - mean) * rstd;
+            dst[j + i * cols] = static_cast<T>(norm * static_cast<float>(gamma[j]) + static_cast<float>(beta[j]));
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> layer_norm_layer(const SimpleTensor<float> &src, const SimpleTensor<float> &gamma, const SimpleTensor<float> &beta, float epsilon);
+template SimpleTensor<half> layer_norm_layer(const SimpleTensor<half> &src, const SimpleTensor<half> &gamma, const SimpleTensor<half> &beta, float epsilon);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
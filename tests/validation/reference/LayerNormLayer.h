@@ -0,0 +1,30 @@
+#ifndef ARM_COMPUTE_TEST_LAYER_NORM_LAYER_H
+#define ARM_COMPUTE_TEST_LAYER_NORM_LAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Layer normalization along X: dst = (src - mean) / sqrt(var + epsilon) * gamma + beta
+ *
+ * @param[in] src     Input tensor
+ * @param[in] gamma   Per-channel scale, of the width of @p src
+ * @param[in] beta    Per-channel offset, of the width of @p src
+ * @param[in] epsilon Lower bound of the variance
+ *
+ * @return the normalized tensor
+ */
+template <typename T>
+SimpleTensor<T> layer_norm_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &gamma, const SimpleTensor<T> &beta, float epsilon);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LAYER_NORM_LAYER_H */
@@ -0,0 +1,51 @@
+#include "LinearLayer.h"
+
+#include "arm_compute/core/Types.h"
+
+#include "tests/validation/reference/ActivationLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> linear_layer(const SimpleTensor<T> &src,
+                             const SimpleTensor<T> &weights,
+                             const SimpleTensor<T> &bias,
+                             const ActivationLayerInfo &act_info)
+{
+    TensorShape dst_shape = src.shape();
+    dst_shape.set(0, weights.shape()[1]);
+
+    SimpleTensor<T> dst{ dst_shape, src.data_type(), 1 };
+
+    const int k_size = src.shape()[0];
+    const int n_size = weights.shape()[1];
+    const int rows   = src.shape().total_size_upper(1);
+
+    for(int m = 0; m < rows; ++m)
+    {
+        for(int n = 0; n < n_size; ++n)
+        {
+            float acc = static_cast<float>(bias[n]);
+            for(int k = 0; k < k_size; ++k)
+            {
+                acc += static_cast<float>(src[m * k_size + k]) * static_cast<float>(weights[n * k_size + k]);
+            }
+            dst[m * n_size + n] = static_cast<T>(acc);
+        }
+    }
+
+    return act_info.enabled() ? activation_layer<T>(dst, act_info) : dst;
+}
+
+template SimpleTensor<float> linear_layer(const SimpleTensor<float> &src, const SimpleTensor<float> &weights, const SimpleTensor<float> &bias, const ActivationLayerInfo &act_info);
+template SimpleTensor<half> linear_layer(const SimpleTensor<half> &src, const SimpleTensor<half> &weights, const SimpleTensor<half> &bias, const ActivationLayerInfo &act_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,33 @@
+#ifndef ARM_COMPUTE_TEST_LINEAR_LAYER_H
+#define ARM_COMPUTE_TEST_LINEAR_LAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Linear projection dst = src * weights^T + bias, followed by an activation
+ *
+ * @param[in] src      Input of shape [K, M, ...]
+ * @param[in] weights  Weights stored as [in, out], shape [K, N]: every output channel is a row
+ * @param[in] bias     Bias of shape [N]
+ * @param[in] act_info Activation applied to the projection
+ *
+ * @return the output of shape [N, M, ...]
+ */
+template <typename T>
+SimpleTensor<T> linear_layer(const SimpleTensor<T> &src,
+                             const SimpleTensor<T> &weights,
+                             const SimpleTensor<T> &bias,
+                             const ActivationLayerInfo &act_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_LINEAR_LAYER_H */
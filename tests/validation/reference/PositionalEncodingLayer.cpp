@@ -0,0 +1,46 @@
+#include "PositionalEncodingLayer.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> positional_encoding_layer(const SimpleTensor<T> &src)
+{
+    // Create reference
+    SimpleTensor<T> dst{ src.shape(), src.data_type(), 1 };
+
+    const int d_model = src.shape()[0];
+    const int seq     = src.shape()[1];
+    const int batch   = src.shape().total_size_upper(2);
+
+    for(int b = 0; b < batch; ++b)
+    {
+        for(int pos = 0; pos < seq; ++pos)
+        {
+            const int row = (pos + b * seq) * d_model;
+            for(int i = 0; i < d_model / 2; ++i)
+            {
+                const double angle = pos / std::pow(10000.0, 2.0 * i / d_model);
+                dst[row + 2 * i]     = static_cast<T>(static_cast<float>(src[row + 2 * i]) + static_cast<float>(std::sin(angle)));
+                dst[row + 2 * i + 1] = static_cast<T>(static_cast<float>(src[row + 2 * i + 1]) + static_cast<float>(std::cos(angle)));
+            }
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> positional_encoding_layer(const SimpleTensor<float> &src);
+template SimpleTensor<half> positional_encoding_layer(const SimpleTensor<half> &src);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
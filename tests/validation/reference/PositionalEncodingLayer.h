@@ -0,0 +1,29 @@
+#ifndef ARM_COMPUTE_TEST_POSITIONAL_ENCODING_LAYER_H
+#define ARM_COMPUTE_TEST_POSITIONAL_ENCODING_LAYER_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Add the sinusoidal positional encoding to every sequence of embeddings
+ *
+ * Channel 2i of position pos gets sin(pos / 10000^(2i / d_model)) added and channel 2i + 1 the cosine.
+ *
+ * @param[in] src Embeddings of shape [d_model, seq, batch], d_model even
+ *
+ * @return the encoded embeddings, of the shape of @p src
+ */
+template <typename T>
+SimpleTensor<T> positional_encoding_layer(const SimpleTensor<T> &src);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_POSITIONAL_ENCODING_LAYER_H */
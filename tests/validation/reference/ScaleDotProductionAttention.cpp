@@ -0,0 +1,160 @@
+#include "ScaleDotProductionAttention.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Attention of every head, with an optional additive mask or optional valid lengths */
+template <typename T>
+SimpleTensor<T> attention(const SimpleTensor<T>       &query,
+                          const SimpleTensor<T>       &key,
+                          const SimpleTensor<T>       &value,
+                          const SimpleTensor<T>       *mask,
+                          const SimpleTensor<int32_t> *valid_lengths,
+                          unsigned int                 h)
+{
+    SimpleTensor<T> dst{ query.shape(), query.data_type(), 1 };
+
+    const int   d_model = query.shape()[0];
+    const int   seq_q   = query.shape()[1];
+    const int   seq_k   = key.shape()[1];
+    const int   batch   = query.shape().total_size_upper(2);
+    const int   d_head  = d_model / static_cast<int>(h);
+    const float scale   = 1.f / std::sqrt(static_cast<float>(d_head));
+
+    // Additive masks broadcast along the query rows and the batches when those dimensions are 1
+    const int mask_rows    = (mask != nullptr) ? mask->shape()[1] : 1;
+    const int mask_batches = (mask != nullptr) ? mask->shape()[2] : 1;
+
+    std::vector<float> scores(seq_k);
+
+    for(int b = 0; b < batch; ++b)
+    {
+        const int q_offset  = b * seq_q * d_model;
+        const int kv_offset = b * seq_k * d_model;
+
+        int kv_len = seq_k;
+        int q_len  = seq_q;
+        if(valid_lengths != nullptr)
+        {
+            kv_len = std::min(std::max((*valid_lengths)[b], 0), seq_k);
+            q_len  = std::min(std::max((*valid_lengths)[b], 0), seq_q);
+        }
+
+        for(int head = 0; head < static_cast<int>(h); ++head)
+        {
+            const int column = head * d_head;
+            for(int q = 0; q < seq_q; ++q)
+            {
+                T *out = &dst[q_offset + q * d_model + column];
+                if(q >= q_len)
+                {
+                    std::fill_n(out, d_head, static_cast<T>(0));
+                    continue;
+                }
+
+                // Scaled and masked scores of the query row against every valid key row
+                float max_score = -std::numeric_limits<float>::infinity();
+                for(int k = 0; k < kv_len; ++k)
+                {
+                    float dot = 0.f;
+                    for(int d = 0; d < d_head; ++d)
+                    {
+                        dot += static_cast<float>(query[q_offset + q * d_model + column + d]) * static_cast<float>(key[kv_offset + k * d_model + column + d]);
+                    }
+                    scores[k] = dot * scale;
+                    if(mask != nullptr)
+                    {
+                        const int mask_q = (mask_rows > 1) ? q : 0;
+                        const int mask_b = (mask_batches > 1) ? b : 0;
+                        scores[k] += static_cast<float>((*mask)[k + (mask_q + mask_b * mask_rows) * seq_k]);
+                    }
+                    max_score = std::max(max_score, scores[k]);
+                }
+
+                // A row without any attended key is zero
+                if(max_score == -std::numeric_limits<float>::infinity())
+                {
+                    std::fill_n(out, d_head, static_cast<T>(0));
+                    continue;
+                }
+
+                float sum = 0.f;
+                for(int k = 0; k < kv_len; ++k)
+                {
+                    scores[k] = std::exp(scores[k] - max_score);
+                    sum += scores[k];
+                }
+
+                for(int d = 0; d < d_head; ++d)
+                {
+                    float context = 0.f;
+                    for(int k = 0; k < kv_len; ++k)
+                    {
+                        context += scores[k] * static_cast<float>(value[kv_offset + k * d_model + column + d]);
+                    }
+                    out[d] = static_cast<T>(context / sum);
+                }
+            }
+        }
+    }
+    return dst;
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T> &query,
+                                               const SimpleTensor<T> &key,
+                                               const SimpleTensor<T> &value,
+                                               unsigned int           h)
+{
+    return attention<T>(query, key, value, nullptr, nullptr, h);
+}
+
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T> &query,
+                                               const SimpleTensor<T> &key,
+                                               const SimpleTensor<T> &value,
+                                               const SimpleTensor<T> &mask,
+                                               unsigned int           h)
+{
+    return attention<T>(query, key, value, &mask, nullptr, h);
+}
+
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T>       &query,
+                                               const SimpleTensor<T>       &key,
+                                               const SimpleTensor<T>       &value,
+                                               const SimpleTensor<int32_t> &valid_lengths,
+                                               unsigned int                 h)
+{
+    return attention<T>(query, key, value, nullptr, &valid_lengths, h);
+}
+
+template SimpleTensor<float> scale_dot_production_attention(const SimpleTensor<float> &query, const SimpleTensor<float> &key, const SimpleTensor<float> &value, unsigned int h);
+template SimpleTensor<half> scale_dot_production_attention(const SimpleTensor<half> &query, const SimpleTensor<half> &key, const SimpleTensor<half> &value, unsigned int h);
+template SimpleTensor<float> scale_dot_production_attention(const SimpleTensor<float> &query, const SimpleTensor<float> &key, const SimpleTensor<float> &value, const SimpleTensor<float> &mask,
+                                                            unsigned int h);
+template SimpleTensor<half> scale_dot_production_attention(const SimpleTensor<half> &query, const SimpleTensor<half> &key, const SimpleTensor<half> &value, const SimpleTensor<half> &mask,
+                                                           unsigned int h);
+template SimpleTensor<float> scale_dot_production_attention(const SimpleTensor<float> &query, const SimpleTensor<float> &key, const SimpleTensor<float> &value,
+                                                            const SimpleTensor<int32_t> &valid_lengths, unsigned int h);
+template SimpleTensor<half> scale_dot_production_attention(const SimpleTensor<half> &query, const SimpleTensor<half> &key, const SimpleTensor<half> &value,
+                                                           const SimpleTensor<int32_t> &valid_lengths, unsigned int h);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,70 @@
+#ifndef ARM_COMPUTE_TEST_SCALE_DOT_PRODUCTION_ATTENTION_H
+#define ARM_COMPUTE_TEST_SCALE_DOT_PRODUCTION_ATTENTION_H
+
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Multi-head scale dot production attention, softmax(Q * K^T / sqrt(d_head)) * V for every head
+ *
+ * @param[in] query Query of shape [d_model, seq_q, batch]
+ * @param[in] key   Key of shape [d_model, seq_k, batch]
+ * @param[in] value Value of shape [d_model, seq_k, batch]
+ * @param[in] h     Number of heads, each reading d_model / h consecutive columns
+ *
+ * @return the merged heads, of the shape of @p query
+ */
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T> &query,
+                                               const SimpleTensor<T> &key,
+                                               const SimpleTensor<T> &value,
+                                               unsigned int           h);
+
+/** Multi-head scale dot production attention with an additive mask, added to the scaled scores of every head
+ *
+ * @param[in] query Query of shape [d_model, seq_q, batch]
+ * @param[in] key   Key of shape [d_model, seq_k, batch]
+ * @param[in] value Value of shape [d_model, seq_k, batch]
+ * @param[in] mask  Additive mask of shape [seq_k, 1 or seq_q, 1 or batch]
+ * @param[in] h     Number of heads
+ *
+ * @return the merged heads, of the shape of @p query
+ */
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T> &query,
+                                               const SimpleTensor<T> &key,
+                                               const SimpleTensor<T> &value,
+                                               const SimpleTensor<T> &mask,
+                                               unsigned int           h);
+
+/** Multi-head scale dot production attention over sequences padded past their valid length
+ *
+ * Every query row attends to the first valid length key rows of its sequence, the query rows past the valid
+ * length are zero.
+ *
+ * @param[in] query         Query of shape [d_model, seq, batch]
+ * @param[in] key           Key of shape [d_model, seq, batch]
+ * @param[in] value         Value of shape [d_model, seq, batch]
+ * @param[in] valid_lengths Valid length of every sequence, shape [batch]
+ * @param[in] h             Number of heads
+ *
+ * @return the merged heads, of the shape of @p query
+ */
+template <typename T>
+SimpleTensor<T> scale_dot_production_attention(const SimpleTensor<T>       &query,
+                                               const SimpleTensor<T>       &key,
+                                               const SimpleTensor<T>       &value,
+                                               const SimpleTensor<int32_t> &valid_lengths,
+                                               unsigned int                 h);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCALE_DOT_PRODUCTION_ATTENTION_H */
@@ -32,9 +32,11 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #include "utils/ImageLoader.h"
+#include "utils/PackedModel.h"
 #include "utils/TextLoader.h"
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
+#include "utils/WordPieceTokenizer.h"
 
 #include <inttypes.h>
 #include <iomanip>
@@ -154,7 +156,7 @@ void WordPiecePreprocessor::preprocess_typed(ITensor &tensor,Args &&... tokens)
     const T * pad_token     = reinterpret_cast<const T *>(get_nth_elm<0>(tokens...));
     const T * start_token   = reinterpret_cast<const T *>(get_nth_elm<1>(tokens...));
     const T * end_token     = reinterpret_cast<const T *>(get_nth_elm<2>(tokens...));
-    ARM_COMPUTE_UNUSED(pad_token);
+    ARM_COMPUTE_UNUSED(pad_token, start_token, end_token);
 
     /** Read in */
     std::basic_string<T> buffer;
@@ -164,34 +166,13 @@ void WordPiecePreprocessor::preprocess_typed(ITensor &tensor,Args &&... tokens)
                         [&](const Coordinates id){
                             buffer+= *reinterpret_cast<T *>(tensor.ptr_to_element(id));
                         });
-    
-    /** Sepreate into tokens and look up vocab list */
-    std::map<std::basic_string<T>,int> token2id = utils::get_token2id(_vocab_file);
-    std::vector<unsigned int> text_ids;
-    std::vector<std::basic_string<T>> tokens_vec;
-
-    /* Split the text into words */
-    std::basic_string<T> pat = R"([[:punct:]]|[[:alpha:]]+|[[:digit:]]+)";
-    std::regex re(pat);
-    std::smatch m;
-
-    while (std::regex_search(buffer, m, re))
-    {
-        for (std::basic_string<T> x : m)
-        {
-            tokens_vec.push_back(x);
-        }
-        buffer = m.suffix();
-    }
 
-    // [CLS]
-    text_ids.push_back(token2id[start_token]);
-    
-    // Input content
-    utils::find_longest_matching<T>(tokens_vec, token2id, text_ids);
+    /** Sepreate into tokens and look up vocab list, the tokenizer frames the text with [CLS] and [SEP] */
+    std::vector<unsigned int> text_ids;
+    text_ids.reserve(buffer.size() + 2);
+    utils::WordPieceTokenizer::from_file(_vocab_file)
+        ->tokenize(reinterpret_cast<const char *>(buffer.data()), buffer.size() * sizeof(T), text_ids);
 
-    // [SEP]
-    text_ids.push_back(token2id[end_token]);
     /** Write back */
     tensor.info()->set_valid_region(tensor.info()->valid_region().set(0,0,text_ids.size()));
     window.use_tensor_dimensions(tensor.info()->tensor_shape());
@@ -480,6 +461,29 @@ bool TokenAccessor::access_tensor(ITensor &tensor)
     return _already_loaded;
 }
 
+ValidLengthAccessor::ValidLengthAccessor(std::string filename, std::string vocabname, unsigned int seq_len)
+    : _already_loaded(false), _filename(std::move(filename)), _vocabname(std::move(vocabname)), _seq_len(seq_len)
+{
+}
+
+bool ValidLengthAccessor::access_tensor(ITensor &tensor)
+{
+    if (!_already_loaded)
+    {
+        auto textloader = utils::TextLoaderFactory::create(_filename);
+        ARM_COMPUTE_EXIT_ON_MSG(textloader == nullptr, "Unsupported Text type");
+
+        // Open a text feeder from file (ifstream)
+        textloader->open(_filename);
+
+        // Fill tensor with the token count of every sequence
+        textloader->fill_valid_length(tensor, _vocabname, _seq_len);
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
 ValidationInputAccessor::ValidationInputAccessor(const std::string             &image_list,
                                                  std::string                    images_path,
                                                  std::unique_ptr<IPreprocessor> preprocessor,
@@ -951,7 +955,7 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
 }
 
 NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout), _mapping(nullptr)
 {
 }
 
@@ -961,9 +965,56 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     {
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
-        loader.fill_tensor(tensor);
+        auto *cpu_tensor = dynamic_cast<Tensor *>(&tensor);
+        if (cpu_tensor != nullptr)
+        {
+            _mapping = loader.fill_tensor_mapped(*cpu_tensor);
+        }
+        else
+        {
+            loader.fill_tensor(tensor);
+        }
+    }
+
+    _already_loaded = !_already_loaded;
+    return _already_loaded;
+}
+
+PackedModelAccessor::PackedModelAccessor(std::shared_ptr<const utils::PackedModel> model, std::string name)
+    : _already_loaded(false), _model(std::move(model)), _name(std::move(name))
+{
+}
+
+bool PackedModelAccessor::access_tensor(ITensor &tensor)
+{
+    if (!_already_loaded)
+    {
+        _model->fill_tensor(_name, tensor);
     }
 
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+namespace arm_compute
+{
+namespace graph_utils
+{
+std::unique_ptr<graph::ITensorAccessor>
+get_weights_accessor(const std::string &path, const std::string &data_file, DataLayout file_layout)
+{
+    if (path.empty())
+    {
+        return std::make_unique<DummyAccessor>();
+    }
+
+    const auto packed_path = utils::PackedModel::split_path(path + data_file);
+    if (!packed_path.first.empty())
+    {
+        return std::make_unique<PackedModelAccessor>(utils::PackedModel::from_file(packed_path.first),
+                                                     packed_path.second);
+    }
+    return std::make_unique<NumPyBinLoader>(path + data_file, file_layout);
+}
+} // namespace graph_utils
+} // namespace arm_compute
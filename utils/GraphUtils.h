@@ -35,12 +35,18 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
 
 namespace arm_compute
 {
+namespace utils
+{
+class PackedModel;
+class PrivateFileMapping;
+} // namespace utils
 namespace graph_utils
 {
 /** Preprocessor interface **/
@@ -328,6 +334,34 @@ private:
     std::unique_ptr<IPreprocessor> _preprocessor;
 };
 
+/** Valid-length accessor class
+ *
+ * Fills a [batch] S32 tensor with the number of tokens of every sequence of a text file, to be used as the
+ * valid-length attention mask of a graph configured for the maximum sequence length.
+ */
+class ValidLengthAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] filename  Path to text file
+     * @param[in] vocabname Path to vocabulary file
+     * @param[in] seq_len   Sequence length of the token id input, longer sequences are truncated to it
+     */
+    ValidLengthAccessor(std::string filename, std::string vocabname, unsigned int seq_len);
+    /** Allow instances of this class to be move constructed */
+    ValidLengthAccessor(ValidLengthAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    bool              _already_loaded;
+    const std::string _filename;
+    const std::string _vocabname;
+    unsigned int      _seq_len;
+};
+
 
 /** Input Accessor used for network validation */
 class ValidationInputAccessor final : public graph::ITensorAccessor
@@ -508,7 +542,10 @@ private:
     std::random_device::result_type _seed;
 };
 
-/** Numpy Binary loader class*/
+/** Numpy Binary loader class
+ *
+ * @note CPU tensors are filled through a memory mapping of the file, see @ref utils::NPYLoader::fill_tensor_mapped
+ */
 class NumPyBinLoader final : public graph::ITensorAccessor
 {
 public:
@@ -525,9 +562,36 @@ public:
     bool access_tensor(ITensor &tensor) override;
 
 private:
-    bool              _already_loaded;
-    const std::string _filename;
-    const DataLayout  _file_layout;
+    bool                                       _already_loaded;
+    const std::string                          _filename;
+    const DataLayout                           _file_layout;
+    std::shared_ptr<utils::PrivateFileMapping> _mapping; /**< Mapping of the file while it backs the tensor */
+};
+
+/** Packed model loader class
+ *
+ * Fills a tensor from one entry of a model packed by scripts/pack_npy_model.py. All the accessors of a model
+ * share a single mapping of its file, which CPU tensors import as their memory when the layouts match.
+ */
+class PackedModelAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Default Constructor
+     *
+     * @param[in] model Packed model holding the tensor
+     * @param[in] name  Name of the tensor in the model
+     */
+    PackedModelAccessor(std::shared_ptr<const utils::PackedModel> model, std::string name);
+    /** Allows instances to move constructed */
+    PackedModelAccessor(PackedModelAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    bool                                      _already_loaded;
+    std::shared_ptr<const utils::PackedModel> _model; /**< Model whose mapping may back the tensor */
+    const std::string                         _name;
 };
 
 /** Generates appropriate random accessor
@@ -546,7 +610,9 @@ get_random_accessor(PixelValue lower, PixelValue upper, const std::random_device
 
 /** Generates appropriate weights accessor according to the specified path
  *
- * @note If path is empty will generate a DummyAccessor else will generate a NumPyBinLoader
+ * @note If path is empty will generate a DummyAccessor. If a prefix of path + data_file is a model packed by
+ *       scripts/pack_npy_model.py will generate a PackedModelAccessor for the rest of the path, else will generate
+ *       a NumPyBinLoader
  *
  * @param[in] path        Path to the data files
  * @param[in] data_file   Relative path to the data files from path
@@ -554,18 +620,8 @@ get_random_accessor(PixelValue lower, PixelValue upper, const std::random_device
  *
  * @return An appropriate tensor accessor
  */
-inline std::unique_ptr<graph::ITensorAccessor>
-get_weights_accessor(const std::string &path, const std::string &data_file, DataLayout file_layout = DataLayout::NCHW)
-{
-    if (path.empty())
-    {
-        return std::make_unique<DummyAccessor>();
-    }
-    else
-    {
-        return std::make_unique<NumPyBinLoader>(path + data_file, file_layout);
-    }
-}
+std::unique_ptr<graph::ITensorAccessor>
+get_weights_accessor(const std::string &path, const std::string &data_file, DataLayout file_layout = DataLayout::NCHW);
 
 /** Generates appropriate input accessor according to the specified graph parameters
  *
@@ -662,6 +718,27 @@ get_token_accessor(const arm_compute::utils::CommonGraphParams &graph_parameters
     }
 }
 
+/** Generates appropriate valid-length accessor according to the specified graph parameters
+ *
+ * @param[in] graph_parameters Graph parameters
+ * @param[in] seq_len          Sequence length of the token id input
+ *
+ * @return An appropriate tensor accessor
+ */
+inline std::unique_ptr<graph::ITensorAccessor>
+get_valid_length_accessor(const arm_compute::utils::CommonGraphParams &graph_parameters, unsigned int seq_len)
+{
+    if (!graph_parameters.validation_file.empty())
+    {
+        return std::make_unique<DummyAccessor>();
+    }
+    else
+    {
+        return std::make_unique<ValidLengthAccessor>(lower_string(graph_parameters.text),
+                                                     lower_string(graph_parameters.vocabulary), seq_len);
+    }
+}
+
 /** Generates appropriate output accessor according to the specified graph parameters
  *
  * @note If the output accessor is requested to validate the graph then ValidationOutputAccessor is generated
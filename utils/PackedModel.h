@@ -0,0 +1,305 @@
+#ifndef __UTILS_PACKED_MODEL_H__
+#define __UTILS_PACKED_MODEL_H__
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "utils/Utils.h"
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace utils
+{
+/** Read-only view of a packed model: every tensor of a model in a single file
+ *
+ * The file is written by scripts/pack_npy_model.py and is little-endian throughout:
+ *
+ *  - Magic "ACLPACK1", followed by the number of tensors and the alignment of their data, both uint32.
+ *  - One index entry per tensor: uint32 name length and the name, uint8 type string length and the NumPy type
+ *    string, uint32 @ref WeightFormat, uint32 number of dimensions and the uint64 dimensions (X first), then the
+ *    uint64 offset of the data from the start of the file and its uint64 size in bytes.
+ *  - The data of every tensor, starting on a multiple of the alignment.
+ *
+ * The whole file is mapped once. Tensors whose layout matches the data import it as their memory, the others
+ * are filled with a copy.
+ */
+class PackedModel
+{
+public:
+    /** Description of one tensor of the container */
+    struct Entry
+    {
+        std::string  typestring{};                             /**< NumPy type string of the elements */
+        WeightFormat weight_format{WeightFormat::UNSPECIFIED}; /**< Layout of the data, UNSPECIFIED when plain */
+        TensorShape  shape{};                                  /**< Shape of the tensor */
+        size_t       offset{0};                                /**< Offset of the data from the start of the file */
+        size_t       size{0};                                  /**< Size of the data in bytes */
+    };
+
+    /** Map a packed model and read its index
+     *
+     * @param[in] filename Path to the packed model
+     */
+    explicit PackedModel(const std::string &filename) : _mapping(filename), _entries()
+    {
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(!_mapping.is_mapped(), "Failed to map packed model %s", filename.c_str());
+        read_index();
+    }
+    /** Return the packed model stored in a file, mapping the file only on its first request
+     *
+     * @param[in] filename Path to the packed model
+     *
+     * @return Packed model shared by every caller asking for the same file
+     */
+    static std::shared_ptr<const PackedModel> from_file(const std::string &filename)
+    {
+        static std::mutex                                                mtx;
+        static std::map<std::string, std::shared_ptr<const PackedModel>> cache;
+
+        std::lock_guard<std::mutex> lock(mtx);
+        auto                       &model = cache[filename];
+        if (model == nullptr)
+        {
+            model = std::make_shared<const PackedModel>(filename);
+        }
+        return model;
+    }
+    /** Return true if a file starts with the magic of a packed model
+     *
+     * @param[in] filename Path to check
+     */
+    static bool is_packed_model(const std::string &filename)
+    {
+        std::ifstream fs(filename, std::ios::in | std::ios::binary);
+        char          magic[magic_size];
+        return fs.read(magic, magic_size) && std::memcmp(magic, packed_model_magic(), magic_size) == 0;
+    }
+    /** Split a path to a file stored in a packed model into the path of the model and the name of the tensor
+     *
+     * For example "bert.aclpack/layer_0/query_weight.npy" gives {"bert.aclpack", "layer_0/query_weight.npy"} when
+     * bert.aclpack is a packed model, so that the paths built for a directory of NPY files also address the
+     * tensors of a packed model.
+     *
+     * @param[in] path Path to split
+     *
+     * @return The path of the model and the name of the tensor, two empty strings if no prefix of @p path is a
+     *         packed model
+     */
+    static std::pair<std::string, std::string> split_path(const std::string &path)
+    {
+        for (size_t pos = path.find('/', 1); pos != std::string::npos; pos = path.find('/', pos + 1))
+        {
+            const std::string prefix = path.substr(0, pos);
+            if (is_packed_model(prefix))
+            {
+                return std::make_pair(prefix, normalize_name(path.substr(pos + 1)));
+            }
+        }
+        return std::make_pair(std::string(), std::string());
+    }
+    /** Return true if the model holds a tensor
+     *
+     * @param[in] name Name of the tensor
+     */
+    bool has(const std::string &name) const
+    {
+        return _entries.find(normalize_name(name)) != _entries.end();
+    }
+    /** Description of a tensor of the model
+     *
+     * @param[in] name Name of the tensor
+     */
+    const Entry &entry(const std::string &name) const
+    {
+        const auto it = _entries.find(normalize_name(name));
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(it == _entries.end(), "Tensor %s not found in packed model", name.c_str());
+        return it->second;
+    }
+    /** Fill a tensor with the data of one tensor of the model
+     *
+     * A CPU tensor without padding imports the mapped data as its memory when it is suitably aligned, which
+     * the container guarantees for its own alignment. Any other tensor receives a copy.
+     *
+     * @note If the tensor is a CLTensor, the function maps and unmaps the tensor
+     *
+     * @param[in]     name   Name of the tensor in the model
+     * @param[in,out] tensor Tensor to fill, must be allocated with the shape and data type of the entry
+     *
+     * @return True if the tensor now uses the mapped data as its memory, which then lives as long as the model
+     */
+    template <typename T>
+    bool fill_tensor(const std::string &name, T &tensor) const
+    {
+        const Entry       &e    = entry(name);
+        const ITensorInfo &info = *tensor.info();
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(e.typestring != get_typestring(info.data_type()), "Typestrings mismatch for %s",
+                                    name.c_str());
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(detail::have_different_dimensions(e.shape, info.tensor_shape(), 0),
+                                    "Tensor dimensions mismatch for %s", name.c_str());
+        // Pre-packed entries can only be consumed by functions configured for their weight format
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(e.weight_format != WeightFormat::UNSPECIFIED,
+                                    "Tensor %s is pre-packed, only plain tensors can be loaded", name.c_str());
+
+        uint8_t *data = _mapping.data() + e.offset;
+
+        auto *cpu_tensor = dynamic_cast<Tensor *>(&tensor);
+        if (cpu_tensor != nullptr && info.padding().empty())
+        {
+            const size_t alignment =
+                (cpu_tensor->allocator()->alignment() != 0) ? cpu_tensor->allocator()->alignment() : 64;
+            if (reinterpret_cast<uintptr_t>(data) % alignment == 0 &&
+                bool(cpu_tensor->allocator()->import_memory(data)))
+            {
+                return true;
+            }
+        }
+
+        map(tensor, true);
+        if (info.padding().empty())
+        {
+            std::memcpy(tensor.buffer() + info.offset_first_element_in_bytes(), data, e.size);
+        }
+        else
+        {
+            // Copy one row along X at a time into the padded tensor
+            const size_t row_size = info.dimension(0) * info.element_size();
+            Window       window;
+            window.use_tensor_dimensions(info.tensor_shape());
+            window.set(Window::DimX, Window::Dimension(0, 1, 1));
+            execute_window_loop(window,
+                                [&](const Coordinates &id)
+                                {
+                                    std::memcpy(tensor.ptr_to_element(id), data, row_size);
+                                    data += row_size;
+                                });
+        }
+        unmap(tensor);
+        return false;
+    }
+
+private:
+    static constexpr size_t magic_size = 8;
+
+    static const char *packed_model_magic()
+    {
+        return "ACLPACK1";
+    }
+
+    /** Drop the empty and "." components of a name, so that "/layer_0//./w.npy" and "layer_0/w.npy" match */
+    static std::string normalize_name(const std::string &name)
+    {
+        std::string normalized;
+        size_t      begin = 0;
+        while (begin <= name.size())
+        {
+            size_t end = name.find('/', begin);
+            if (end == std::string::npos)
+            {
+                end = name.size();
+            }
+            const std::string component = name.substr(begin, end - begin);
+            if (!component.empty() && component != ".")
+            {
+                normalized += (normalized.empty() ? "" : "/") + component;
+            }
+            begin = end + 1;
+        }
+        return normalized;
+    }
+
+    template <typename U>
+    U read_value(size_t &pos) const
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(pos + sizeof(U) > _mapping.size(), "Truncated packed model index");
+        U value;
+        std::memcpy(&value, _mapping.data() + pos, sizeof(U));
+        pos += sizeof(U);
+        return value;
+    }
+
+    std::string read_string(size_t &pos, size_t length) const
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(pos + length > _mapping.size(), "Truncated packed model index");
+        std::string str(reinterpret_cast<const char *>(_mapping.data() + pos), length);
+        pos += length;
+        return str;
+    }
+
+    /** Size in bytes of one element of a NumPy type string such as "<f4" or "|u1" */
+    static size_t element_size_from_typestring(const std::string &typestring)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(typestring.size() < 3, "Invalid type string %s in packed model",
+                                    typestring.c_str());
+        size_t size = 0;
+        for (size_t i = 2; i < typestring.size(); ++i)
+        {
+            ARM_COMPUTE_EXIT_ON_MSG_VAR(typestring[i] < '0' || typestring[i] > '9',
+                                        "Invalid type string %s in packed model", typestring.c_str());
+            size = size * 10 + static_cast<size_t>(typestring[i] - '0');
+        }
+        return size;
+    }
+
+    void read_index()
+    {
+        size_t pos = 0;
+        ARM_COMPUTE_EXIT_ON_MSG(read_string(pos, magic_size) != packed_model_magic(), "Not a packed model");
+        const auto num_entries = read_value<uint32_t>(pos);
+        const auto alignment   = read_value<uint32_t>(pos);
+        ARM_COMPUTE_UNUSED(alignment);
+
+        for (uint32_t i = 0; i < num_entries; ++i)
+        {
+            const auto        name_length = read_value<uint32_t>(pos);
+            const std::string name        = normalize_name(read_string(pos, name_length));
+
+            Entry      e;
+            const auto typestring_length = read_value<uint8_t>(pos);
+            e.typestring                 = read_string(pos, typestring_length);
+            e.weight_format              = static_cast<WeightFormat>(read_value<uint32_t>(pos));
+            const auto num_dims = read_value<uint32_t>(pos);
+            ARM_COMPUTE_EXIT_ON_MSG(num_dims > TensorShape::num_max_dimensions, "Too many dimensions in packed model");
+            for (uint32_t d = 0; d < num_dims; ++d)
+            {
+                e.shape.set(d, read_value<uint64_t>(pos));
+            }
+            e.offset = read_value<uint64_t>(pos);
+            e.size   = read_value<uint64_t>(pos);
+            ARM_COMPUTE_EXIT_ON_MSG_VAR(e.offset + e.size > _mapping.size(), "Data of %s is out of the file",
+                                        name.c_str());
+            // The copy in fill_tensor() writes e.size bytes, which must be exactly the tensor of the index. Pre-packed
+            // layouts may pad their blocks, so they only need to hold the plain tensor
+            const size_t plain_size = e.shape.total_size() * element_size_from_typestring(e.typestring);
+            if (e.weight_format == WeightFormat::UNSPECIFIED)
+            {
+                ARM_COMPUTE_EXIT_ON_MSG_VAR(e.size != plain_size, "Size of %s does not match its shape and type",
+                                            name.c_str());
+            }
+            else
+            {
+                ARM_COMPUTE_EXIT_ON_MSG_VAR(e.size < plain_size, "Size of %s is smaller than its shape and type",
+                                            name.c_str());
+            }
+            _entries.emplace(name, std::move(e));
+        }
+    }
+
+    PrivateFileMapping           _mapping; /**< Mapping of the whole file, imported tensors point into it */
+    std::map<std::string, Entry> _entries; /**< Index of the tensors, keyed by name */
+};
+} // namespace utils
+} // namespace arm_compute
+
+#endif /* __UTILS_PACKED_MODEL_H__ */
@@ -7,10 +7,13 @@
 #include "arm_compute/core/Types.h"
 
 #include "utils/Utils.h"
+#include "utils/WordPieceTokenizer.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -116,20 +119,24 @@ public:
         ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(&text, TextFormat::UTF8);
         ARM_COMPUTE_ERROR_ON(_feeder.get() == nullptr);
 
-        unsigned char c = 0;
-
         /* read input from text data feeder */
         try
         {
+            std::vector<unsigned char> chars(_length);
+            for (auto &c : chars)
+            {
+                c = _feeder->get();
+            }
+
+            // Every sequence of a batched [length, batch] tensor gets the content of the file
             Window window;
-            window.set(Window::DimX, Window::Dimension(0,_length,1));
+            window.use_tensor_dimensions(text.info()->tensor_shape());
             Iterator out(&text,window);
             execute_window_loop(
                 window,
-                [&](const Coordinates &)
+                [&](const Coordinates &id)
                 {
-                    c = _feeder->get();
-                    *out.ptr() = c;
+                    *out.ptr() = chars[id.x()];
                 },
                 out
             );
@@ -139,78 +146,113 @@ public:
             ARM_COMPUTE_ERROR_VAR("Loading text file: %s", e.what());
         }
     }
-    /** Fill an text tensor with the content of the currently open text file.
+    /** Fill a token id tensor with the content of the currently open text file.
+     *
+     * Sequences shorter than the tensor are padded with [PAD] and longer ones are truncated, so a graph
+     * configured for the maximum sequence length can run any shorter text.
      *
-     * @param[in,out] tensor Text tensor to fill (Must be allocated, and of matching dimensions with the opened text file).
+     * @param[in,out] tensor    Token id tensor to fill, shape [seq, batch] (Must be allocated). One sequence per line when batched.
+     * @param[in]     vocabname Path to the vocabulary file, only loaded on first use
      */
     template <typename T>
     void fill_token(T &tensor, const std::string &vocabname)
     {
-        ARM_COMPUTE_ERROR_ON(!is_open());
-        ARM_COMPUTE_ERROR_ON(_feeder.get() == nullptr);
+        fill_token(tensor, *WordPieceTokenizer::from_file(vocabname));
+    }
+    /** Fill a token id tensor with the content of the currently open text file.
+     *
+     * @param[in,out] tensor    Token id tensor to fill, shape [seq, batch] (Must be allocated). One sequence per line when batched.
+     * @param[in]     tokenizer Tokenizer holding the vocabulary
+     */
+    template <typename T>
+    void fill_token(T &tensor, const WordPieceTokenizer &tokenizer)
+    {
+        const unsigned int seq_len    = tensor.info()->dimension(0);
+        const unsigned int batch_size = tensor.info()->dimension(1);
 
-        /* read input from text data feeder */
-        try
+        const std::vector<std::vector<unsigned int>> sequences_ids = tokenize(tokenizer, batch_size);
+        const unsigned int                           pad_id        = tokenizer.pad_id();
+
+        for (unsigned int b = 0; b < batch_size; ++b)
         {
-            // Readin text file
-            std::basic_string<char> buffer;
-            for(unsigned int i=0; i<_length; i++)
+            const std::vector<unsigned int> &text_ids = sequences_ids[b];
+            for (unsigned int i = 0; i < seq_len; ++i)
             {
-                buffer+=_feeder->get();
+                *reinterpret_cast<unsigned int *>(tensor.ptr_to_element(Coordinates(i, b))) =
+                    (i < text_ids.size()) ? text_ids[i] : pad_id;
             }
+        }
+    }
+    /** Fill a valid-length tensor with the number of tokens of each sequence of the currently open text file.
+     *
+     * @param[in,out] tensor    Valid-length tensor to fill, shape [batch] and data type S32 (Must be allocated).
+     * @param[in]     vocabname Path to the vocabulary file, only loaded on first use
+     * @param[in]     seq_len   Sequence length of the token id tensor, longer sequences are truncated to it
+     */
+    template <typename T>
+    void fill_valid_length(T &tensor, const std::string &vocabname, unsigned int seq_len)
+    {
+        ARM_COMPUTE_ERROR_ON(tensor.info()->data_type() != DataType::S32);
 
-            const char start_token[]        = u8"[CLS]";
-            const char end_token[]          = u8"[SEP]";
+        const unsigned int batch_size = tensor.info()->dimension(0);
 
-            /** Sepreate into tokens and look up vocab list */
-            std::map<std::basic_string<char>,int> token2id = utils::get_token2id(vocabname);
-            std::vector<unsigned int> text_ids;
-            std::vector<std::basic_string<char>> tokens_vec;
+        const std::vector<std::vector<unsigned int>> sequences_ids =
+            tokenize(*WordPieceTokenizer::from_file(vocabname), batch_size);
+        for (unsigned int b = 0; b < batch_size; ++b)
+        {
+            *reinterpret_cast<int32_t *>(tensor.ptr_to_element(Coordinates(b))) =
+                static_cast<int32_t>(std::min<size_t>(sequences_ids[b].size(), seq_len));
+        }
+    }
+protected:
+    /** Split the currently open text file into sequences of token ids, each framed by [CLS] and [SEP]
+     *
+     * @param[in] tokenizer     Tokenizer holding the vocabulary
+     * @param[in] num_sequences Number of sequences to read, one per line of the file when greater than 1
+     *
+     * @return The token ids of every sequence
+     */
+    std::vector<std::vector<unsigned int>> tokenize(const WordPieceTokenizer &tokenizer, unsigned int num_sequences)
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+        ARM_COMPUTE_ERROR_ON(_feeder.get() == nullptr);
+
+        std::vector<std::vector<unsigned int>> sequences_ids(num_sequences);
 
-            /* Split the text into words */
-            std::basic_string<char> pat = R"([[:punct:]]|[[:alpha:]]+|[[:digit:]]+)";
-            std::regex re(pat);
-            std::smatch m;
+        /* read input from text data feeder */
+        try
+        {
+            std::string buffer(_length, '\0');
+            _feeder->get_chuck(reinterpret_cast<uint8_t *>(&buffer[0]), _length);
 
-            while (std::regex_search(buffer, m, re))
+            // A batch takes one sequence per line of the text file, sequences are tokenized in place
+            size_t line_start = 0;
+            for (unsigned int b = 0; b < num_sequences; ++b)
             {
-                for (std::basic_string<char> x : m)
+                size_t line_end = buffer.size();
+                if (num_sequences > 1)
                 {
-                    tokens_vec.push_back(x);
+                    // Skip empty lines
+                    while (line_start < buffer.size() && buffer[line_start] == '\n')
+                    {
+                        ++line_start;
+                    }
+                    ARM_COMPUTE_ERROR_ON_MSG(line_start >= buffer.size(), "Not enough sequences in text file for the batch");
+                    line_end = std::min(buffer.find('\n', line_start), buffer.size());
                 }
-                buffer = m.suffix();
-            }
 
-            // [CLS]
-            text_ids.push_back(token2id[start_token]);
-            
-            // Input content
-            utils::find_longest_matching<char>(tokens_vec, token2id, text_ids);
-
-            // [SEP]
-            text_ids.push_back(token2id[end_token]);
-
-            Window window;
-            window.set(Window::DimX, Window::Dimension(0,tensor.info()->tensor_shape().x(),1));
-            Iterator out(&tensor,window);
-            int i = 0;
-            execute_window_loop(
-                window,
-                [&](const Coordinates &)
-                {
-                    *reinterpret_cast<unsigned int *>(out.ptr()) = text_ids[i];
-                    i++;
-                },
-                out
-            );
-            
+                sequences_ids[b].reserve(line_end - line_start + 2);
+                tokenizer.tokenize(buffer.data() + line_start, line_end - line_start, sequences_ids[b]);
+                line_start = line_end;
+            }
         }
         catch (const std::ifstream::failure &e)
         {
             ARM_COMPUTE_ERROR_VAR("Loading text file: %s", e.what());
         }
+        return sequences_ids;
     }
-protected:
+
     std::unique_ptr<ITextDataFeeder> _feeder;
     unsigned int _length;
 };
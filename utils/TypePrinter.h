@@ -509,6 +509,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const ActivationLayerInfo:
         case ActivationLayerInfo::ActivationFunction::GELU:
             os << "GELU";
             break;
+        case ActivationLayerInfo::ActivationFunction::GELU_TANH:
+            os << "GELU_TANH";
+            break;
 
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
@@ -45,6 +45,7 @@
 #include "arm_compute/runtime/CL/CLTensor.h"
 #endif /* ARM_COMPUTE_CL */
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
@@ -52,9 +53,17 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+
 namespace arm_compute
 {
 namespace utils
@@ -306,12 +315,85 @@ private:
     std::uniform_real_distribution<float> dist;
 };
 
+/** Private memory mapping of a whole file
+ *
+ * The pages are shared with the page cache and only copied when written to, writes never reach the file.
+ *
+ * @note Mapping is not available on Windows and bare metal builds, where @ref is_mapped() is always false.
+ */
+class PrivateFileMapping
+{
+public:
+    /** Map a file
+     *
+     * @param[in] filename File to map
+     */
+    explicit PrivateFileMapping(const std::string &filename)
+    {
+#if !defined(_WIN64) && !defined(BARE_METAL)
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+        struct stat st; // NOLINT
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void *data = ::mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                _data = static_cast<uint8_t *>(data);
+                _size = st.st_size;
+            }
+        }
+        // The mapping stays valid once the descriptor is closed
+        ::close(fd);
+#else  /* !defined(_WIN64) && !defined(BARE_METAL) */
+        ARM_COMPUTE_UNUSED(filename);
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+    }
+    /** Prevent instances of this class from being copied */
+    PrivateFileMapping(const PrivateFileMapping &) = delete;
+    /** Prevent instances of this class from being copied */
+    PrivateFileMapping &operator=(const PrivateFileMapping &) = delete;
+    /** Default destructor, unmaps the file */
+    ~PrivateFileMapping()
+    {
+#if !defined(_WIN64) && !defined(BARE_METAL)
+        if (_data != nullptr)
+        {
+            ::munmap(_data, _size);
+        }
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+    }
+    /** Return true if the file is mapped */
+    bool is_mapped() const
+    {
+        return _data != nullptr;
+    }
+    /** Start of the mapped file */
+    uint8_t *data() const
+    {
+        return _data;
+    }
+    /** Size of the mapped file in bytes */
+    size_t size() const
+    {
+        return _size;
+    }
+
+private:
+    uint8_t *_data{nullptr};
+    size_t   _size{0};
+};
+
 /** Numpy data loader */
 class NPYLoader
 {
 public:
     /** Default constructor */
-    NPYLoader() : _fs(), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW)
+    NPYLoader()
+        : _fs(), _filename(), _data_offset(0), _shape(), _fortran_order(false), _typestring(), _file_layout(DataLayout::NCHW)
     {
     }
 
@@ -334,6 +416,8 @@ public:
             _shape               = header.shape;
             _fortran_order       = header.fortran_order;
             _typestring          = header.dtype.str();
+            _filename            = npy_filename;
+            _data_offset         = _fs.tellg();
 
             std::cout<< npy_filename << std::endl;
             std::cout<< "Shape: ";
@@ -430,10 +514,9 @@ public:
             const size_t end_position = _fs.tellg();
             _fs.seekg(current_position, std::ios_base::beg);
 
-            ARM_COMPUTE_ERROR_ON_MSG((end_position - current_position) <
-                                         tensor.info()->tensor_shape().total_size() * tensor.info()->element_size(),
-                                     "Not enough data in file");
-            ARM_COMPUTE_UNUSED(end_position);
+            ARM_COMPUTE_EXIT_ON_MSG((end_position - current_position) <
+                                        tensor.info()->tensor_shape().total_size() * tensor.info()->element_size(),
+                                    "Not enough data in file");
 
             // Check if the typestring matches the given one
             std::string expect_typestr = get_typestring(tensor.info()->data_type());
@@ -455,45 +538,9 @@ public:
             }
 
             bool are_layouts_different = (_file_layout != tensor.info()->data_layout());
-            
-            // Correct dimensions (Needs to match TensorShape dimension corrections)
-            if (_shape.size() != tensor.info()->tensor_shape().num_dimensions())
-            {
-                for (int i = static_cast<int>(_shape.size()) - 1; i > 0; --i)
-                {
-                    if (_shape[i] == 1)
-                    {
-                        _shape.pop_back();
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-            }
 
-            TensorShape                    permuted_shape = tensor.info()->tensor_shape();
             arm_compute::PermutationVector perm;
-            if (are_layouts_different && tensor.info()->tensor_shape().num_dimensions() > 2)
-            {
-                perm = (tensor.info()->data_layout() == arm_compute::DataLayout::NHWC)
-                           ? arm_compute::PermutationVector(2U, 0U, 1U)
-                           : arm_compute::PermutationVector(1U, 2U, 0U);
-                arm_compute::PermutationVector perm_vec =
-                    (tensor.info()->data_layout() == arm_compute::DataLayout::NCHW)
-                        ? arm_compute::PermutationVector(2U, 0U, 1U)
-                        : arm_compute::PermutationVector(1U, 2U, 0U);
-
-                arm_compute::permute(permuted_shape, perm_vec);
-            }
-
-            // Validate tensor shape
-            ARM_COMPUTE_ERROR_ON_MSG(_shape.size() != tensor.info()->tensor_shape().num_dimensions(),
-                                     "Tensor ranks mismatch");
-            for (size_t i = 0; i < _shape.size(); ++i)
-            {
-                ARM_COMPUTE_ERROR_ON_MSG(permuted_shape[i] != _shape[i], "Tensor dimensions mismatch");
-            }
+            TensorShape                    permuted_shape = check_shape(*tensor.info(), perm);
 
             switch (tensor.info()->data_type())
             {
@@ -576,8 +623,163 @@ public:
 
     }
 
+    /** Fill a CPU tensor with the content of the currently open NPY file through a memory mapping of the file
+     *
+     * When the file holds the elements in the tensor's order, without padding and suitably aligned, the mapped
+     * data is imported as the tensor's memory and nothing is read until the tensor is used. Otherwise the
+     * elements are copied out of the mapping by several threads. Files that need a data type conversion or a
+     * permutation are read with @ref fill_tensor.
+     *
+     * @param[in,out] tensor      Tensor to fill (Must be allocated, and of matching dimensions with the opened NPY).
+     * @param[in]     num_threads (Optional) Number of threads used for the copy. Defaults to 0, one per core
+     *
+     * @return The mapping backing the tensor, which must outlive any use of the tensor, nullptr if the data was copied
+     */
+    std::shared_ptr<PrivateFileMapping> fill_tensor_mapped(Tensor &tensor, unsigned int num_threads = 0)
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+
+        const ITensorInfo &info = *tensor.info();
+        if (_fortran_order || _file_layout != info.data_layout() || _typestring != get_typestring(info.data_type()))
+        {
+            fill_tensor(tensor);
+            return nullptr;
+        }
+
+        auto mapping = std::make_shared<PrivateFileMapping>(_filename);
+        if (!mapping->is_mapped())
+        {
+            fill_tensor(tensor);
+            return nullptr;
+        }
+
+        arm_compute::PermutationVector perm;
+        check_shape(info, perm);
+
+        const size_t data_size = info.tensor_shape().total_size() * info.element_size();
+        ARM_COMPUTE_EXIT_ON_MSG(mapping->size() < _data_offset + data_size, "Not enough data in file");
+        uint8_t *data = mapping->data() + _data_offset;
+
+        // NPY headers are padded so that the data starts on a 64-byte boundary, the default tensor alignment
+        const size_t alignment = (tensor.allocator()->alignment() != 0) ? tensor.allocator()->alignment() : 64;
+        if (info.padding().empty() && reinterpret_cast<uintptr_t>(data) % alignment == 0 &&
+            bool(tensor.allocator()->import_memory(data)))
+        {
+            return mapping;
+        }
+
+        if (num_threads == 0)
+        {
+            num_threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        if (info.padding().empty())
+        {
+            uint8_t *dst = tensor.buffer() + info.offset_first_element_in_bytes();
+            parallel_for(data_size, num_threads, [&](size_t begin, size_t end)
+                         { std::memcpy(dst + begin, data + begin, end - begin); });
+        }
+        else
+        {
+            // Copy one row along X at a time into the padded tensor
+            const TensorShape &shape    = info.tensor_shape();
+            const size_t       row_size = shape.x() * info.element_size();
+            parallel_for(shape.total_size_upper(1), num_threads,
+                         [&](size_t begin, size_t end)
+                         {
+                             for (size_t row = begin; row < end; ++row)
+                             {
+                                 Coordinates id;
+                                 size_t      index = row;
+                                 for (size_t d = 1; d < shape.num_dimensions(); ++d)
+                                 {
+                                     id.set(d, index % shape[d]);
+                                     index /= shape[d];
+                                 }
+                                 std::memcpy(tensor.ptr_to_element(id), data + row * row_size, row_size);
+                             }
+                         });
+        }
+        return nullptr;
+    }
+
 private:
+    /** Check the dimensions of the currently open NPY file against the tensor's
+     *
+     * @param[in]  info Info of the tensor to fill
+     * @param[out] perm Permutation from the layout of the tensor to the layout of the file
+     *
+     * @return The shape of the tensor permuted to the layout of the file
+     */
+    TensorShape check_shape(const ITensorInfo &info, arm_compute::PermutationVector &perm)
+    {
+        const bool are_layouts_different = (_file_layout != info.data_layout());
+
+        // Correct dimensions (Needs to match TensorShape dimension corrections)
+        if (_shape.size() != info.tensor_shape().num_dimensions())
+        {
+            for (int i = static_cast<int>(_shape.size()) - 1; i > 0; --i)
+            {
+                if (_shape[i] == 1)
+                {
+                    _shape.pop_back();
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        TensorShape permuted_shape = info.tensor_shape();
+        if (are_layouts_different && info.tensor_shape().num_dimensions() > 2)
+        {
+            perm = (info.data_layout() == arm_compute::DataLayout::NHWC) ? arm_compute::PermutationVector(2U, 0U, 1U)
+                                                                         : arm_compute::PermutationVector(1U, 2U, 0U);
+            arm_compute::PermutationVector perm_vec = (info.data_layout() == arm_compute::DataLayout::NCHW)
+                                                          ? arm_compute::PermutationVector(2U, 0U, 1U)
+                                                          : arm_compute::PermutationVector(1U, 2U, 0U);
+
+            arm_compute::permute(permuted_shape, perm_vec);
+        }
+
+        // Validate tensor shape, also in release builds: a mismatching file would be read out of bounds
+        ARM_COMPUTE_EXIT_ON_MSG(_shape.size() != info.tensor_shape().num_dimensions(), "Tensor ranks mismatch");
+        for (size_t i = 0; i < _shape.size(); ++i)
+        {
+            ARM_COMPUTE_EXIT_ON_MSG(permuted_shape[i] != _shape[i], "Tensor dimensions mismatch");
+        }
+        return permuted_shape;
+    }
+
+    /** Split [0, @p count) into contiguous ranges and run @p func on each of them in its own thread
+     *
+     * @note @p func must not throw, the workers are noexcept
+     */
+    template <typename F>
+    static void parallel_for(size_t count, unsigned int num_threads, const F &func)
+    {
+        num_threads = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(num_threads, count)));
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads - 1);
+        const size_t chunk = (count + num_threads - 1) / num_threads;
+        for (unsigned int t = 1; t < num_threads; ++t)
+        {
+            const size_t begin = std::min(count, t * chunk);
+            const size_t end   = std::min(count, begin + chunk);
+            workers.emplace_back([&func, begin, end]() noexcept { func(begin, end); });
+        }
+        func(0, std::min(count, chunk));
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
     std::ifstream              _fs;
+    std::string                _filename;
+    size_t                     _data_offset;
     std::vector<unsigned long> _shape;
     bool                       _fortran_order;
     std::string                _typestring;
@@ -910,58 +1112,6 @@ int compare_tensor(ITensor &tensor1, ITensor &tensor2, T tolerance)
     return num_mismatches;
 }
 
-/** Helper function for converting token to id
- * 
- * @param[in] path_vocab    String path to vocab list txt file
- * 
- * @return A map containing token, id
-*/
-std::map<std::string,int> get_token2id(std::string path_vocab);
-
-/** Find longest matching string in vocabulary list and convert it into vector
- *  
- * @note left    right
- *         0 1 2 3 4  
- * 
- * @param[in] tokens_vec    Input text seperated into tokens stored in a vector
- * @param[in] token2id      Token to id vocabulary map
- * @param[in,out] text_ids  Vector stroing converted text id
-*/
-template<typename T>
-void find_longest_matching(std::vector<std::basic_string<T>> &tokens_vec,
-                           std::map<std::basic_string<T>,int> &token2id,
-                           std::vector<unsigned int> &text_ids)
-{
-    unsigned int token_len;
-    unsigned int left,right;
-    std::basic_string<T> token_buffer;
-   for(const auto &token : tokens_vec)
-    {
-        token_buffer = token;
-        token_len = token.size();
-        left = 0;
-    loop:
-        while (left < token_len)
-        {
-            right = token_len;
-            while (right > left)
-            {
-                auto it = token2id.find(token_buffer.substr(left, right - left));
-                if (it != token2id.end())
-                {
-                    text_ids.push_back(it->second);
-                    left = right;
-                    token_buffer = "##" + token_buffer.substr(left, token_len);
-                    goto loop;
-                }
-                right--;
-            }
-            ARM_COMPUTE_ERROR_ON_MSG(right == left, token_buffer.append(" unkown in vocabulary list"));
-            left++;
-        }
-    }
-}
-
 } // namespace utils
 } // namespace arm_compute
 #endif /* __UTILS_UTILS_H__*/
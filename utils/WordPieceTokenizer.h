@@ -0,0 +1,273 @@
+#ifndef __UTILS_WORDPIECE_TOKENIZER_H__
+#define __UTILS_WORDPIECE_TOKENIZER_H__
+
+#include "arm_compute/core/Error.h"
+
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace arm_compute
+{
+namespace utils
+{
+/** WordPiece tokenizer backed by a byte trie of the vocabulary
+ *
+ * The vocabulary is loaded once into a trie whose edges live in a single hash table keyed by (node, byte),
+ * word-initial pieces hang off one root and "##" continuation pieces off another. Text is split into
+ * alphabetic runs, digit runs and single punctuation characters (the same classes as the regex used
+ * before) and each word is matched greedily against the trie in a single pass over its bytes, so
+ * tokenisation does no heap allocation apart from growing the output vector.
+ */
+class WordPieceTokenizer
+{
+public:
+    /** Default constructor, the tokenizer is empty until @ref load is called */
+    WordPieceTokenizer() = default;
+    /** Construct a tokenizer from a vocabulary file
+     *
+     * @param[in] vocab_file Path to the vocabulary file, one "token id" pair per line
+     */
+    explicit WordPieceTokenizer(const std::string &vocab_file)
+    {
+        load(vocab_file);
+    }
+    /** Return a tokenizer for a vocabulary file, loading the file only on its first request
+     *
+     * @param[in] vocab_file Path to the vocabulary file
+     *
+     * @return Tokenizer shared by every caller asking for the same file
+     */
+    static std::shared_ptr<const WordPieceTokenizer> from_file(const std::string &vocab_file)
+    {
+        static std::mutex                                                       mtx;
+        static std::map<std::string, std::shared_ptr<const WordPieceTokenizer>> cache;
+
+        std::lock_guard<std::mutex> lock(mtx);
+        auto                       &tokenizer = cache[vocab_file];
+        if (tokenizer == nullptr)
+        {
+            tokenizer = std::make_shared<const WordPieceTokenizer>(vocab_file);
+        }
+        return tokenizer;
+    }
+    /** Load the vocabulary, replacing any previously loaded one
+     *
+     * @param[in] vocab_file Path to the vocabulary file, one "token id" pair per line
+     */
+    void load(const std::string &vocab_file)
+    {
+        std::ifstream fs(vocab_file, std::ios::in);
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(!fs.is_open(), "Could not open vocabulary file %s", vocab_file.c_str());
+
+        _vocab_file = vocab_file;
+        _edges.clear();
+        _ids.assign(2, -1);
+
+        const std::string continuation_prefix = "##";
+        for (std::string line; std::getline(fs, line);)
+        {
+            const size_t split = line.find(' ');
+            if (split == std::string::npos || split == 0)
+            {
+                continue;
+            }
+            const int id = std::stoi(line.substr(split + 1));
+
+            if (line.compare(0, continuation_prefix.size(), continuation_prefix) == 0 && split > continuation_prefix.size())
+            {
+                insert(continuation_root, line.data() + continuation_prefix.size(), split - continuation_prefix.size(), id);
+            }
+            else
+            {
+                insert(word_root, line.data(), split, id);
+            }
+        }
+
+        _cls_id = token_id("[CLS]");
+        _sep_id = token_id("[SEP]");
+        _pad_id = token_id("[PAD]");
+        _unk_id = token_id("[UNK]");
+    }
+    /** Return true if a vocabulary has been loaded */
+    bool is_loaded() const
+    {
+        return _ids.size() > 2;
+    }
+    /** Look up a whole word-initial token
+     *
+     * @param[in] token Token to look up
+     *
+     * @return Id of the token, -1 if it is not in the vocabulary
+     */
+    int token_id(const std::string &token) const
+    {
+        uint32_t node = word_root;
+        for (const char c : token)
+        {
+            node = child(node, c);
+            if (node == no_node)
+            {
+                return -1;
+            }
+        }
+        return _ids[node];
+    }
+    /** Id of the [PAD] token */
+    unsigned int pad_id() const
+    {
+        return static_cast<unsigned int>(_pad_id);
+    }
+    /** Tokenize a sequence, framing it with [CLS] and [SEP]
+     *
+     * @param[in]     text   Pointer to the UTF-8 text
+     * @param[in]     length Length of the text in bytes
+     * @param[in,out] ids    Vector the token ids are appended to
+     */
+    void tokenize(const char *text, size_t length, std::vector<unsigned int> &ids) const
+    {
+        ARM_COMPUTE_ERROR_ON(!is_loaded());
+
+        ids.push_back(static_cast<unsigned int>(_cls_id));
+
+        size_t pos = 0;
+        while (pos < length)
+        {
+            const unsigned char c = static_cast<unsigned char>(text[pos]);
+            size_t              end;
+            if (std::isalpha(c))
+            {
+                for (end = pos + 1; end < length && std::isalpha(static_cast<unsigned char>(text[end])); ++end)
+                {
+                }
+            }
+            else if (std::isdigit(c))
+            {
+                for (end = pos + 1; end < length && std::isdigit(static_cast<unsigned char>(text[end])); ++end)
+                {
+                }
+            }
+            else if (std::ispunct(c))
+            {
+                end = pos + 1;
+            }
+            else
+            {
+                // Whitespace and bytes outside the classes above only separate words
+                ++pos;
+                continue;
+            }
+            tokenize_word(text + pos, end - pos, ids);
+            pos = end;
+        }
+
+        ids.push_back(static_cast<unsigned int>(_sep_id));
+    }
+    /** Tokenize a batch of sequences
+     *
+     * @param[in] texts Sequences to tokenize
+     *
+     * @return The token ids of every sequence, each framed by [CLS] and [SEP]
+     */
+    std::vector<std::vector<unsigned int>> tokenize_batch(const std::vector<std::string> &texts) const
+    {
+        std::vector<std::vector<unsigned int>> batch_ids(texts.size());
+        for (size_t b = 0; b < texts.size(); ++b)
+        {
+            batch_ids[b].reserve(texts[b].size() + 2);
+            tokenize(texts[b].data(), texts[b].size(), batch_ids[b]);
+        }
+        return batch_ids;
+    }
+
+private:
+    static constexpr uint32_t word_root         = 0;
+    static constexpr uint32_t continuation_root = 1;
+    static constexpr uint32_t no_node           = UINT32_MAX;
+
+    static uint64_t edge_key(uint32_t node, char c)
+    {
+        return (static_cast<uint64_t>(node) << 8) | static_cast<unsigned char>(c);
+    }
+
+    uint32_t child(uint32_t node, char c) const
+    {
+        const auto it = _edges.find(edge_key(node, c));
+        return (it != _edges.end()) ? it->second : no_node;
+    }
+
+    void insert(uint32_t root, const char *token, size_t length, int id)
+    {
+        uint32_t node = root;
+        for (size_t i = 0; i < length; ++i)
+        {
+            const auto it = _edges.emplace(edge_key(node, token[i]), static_cast<uint32_t>(_ids.size()));
+            if (it.second)
+            {
+                _ids.push_back(-1);
+            }
+            node = it.first->second;
+        }
+        _ids[node] = id;
+    }
+
+    /** Greedy longest-match of one word, a word with an unknown piece becomes [UNK] as a whole */
+    void tokenize_word(const char *word, size_t length, std::vector<unsigned int> &ids) const
+    {
+        const size_t first_piece = ids.size();
+
+        size_t   start = 0;
+        uint32_t root  = word_root;
+        while (start < length)
+        {
+            // Walk as deep as the word allows and remember the last node that ends a token
+            int      match_id  = -1;
+            size_t   match_end = start;
+            uint32_t node      = root;
+            for (size_t i = start; i < length; ++i)
+            {
+                node = child(node, word[i]);
+                if (node == no_node)
+                {
+                    break;
+                }
+                if (_ids[node] >= 0)
+                {
+                    match_id  = _ids[node];
+                    match_end = i + 1;
+                }
+            }
+
+            if (match_id < 0)
+            {
+                ARM_COMPUTE_EXIT_ON_MSG_VAR(_unk_id < 0, "Word unknown in vocabulary list and no [UNK] token in %s",
+                                            _vocab_file.c_str());
+                ids.resize(first_piece);
+                ids.push_back(static_cast<unsigned int>(_unk_id));
+                return;
+            }
+
+            ids.push_back(static_cast<unsigned int>(match_id));
+            start = match_end;
+            root  = continuation_root;
+        }
+    }
+
+    std::string                            _vocab_file{}; /**< Path of the loaded vocabulary, for error messages */
+    std::unordered_map<uint64_t, uint32_t> _edges{}; /**< Trie edges, keyed by (parent node, byte) */
+    std::vector<int>                       _ids{};   /**< Token id ending at each node, -1 for inner nodes */
+    int                                    _cls_id{-1};
+    int                                    _sep_id{-1};
+    int                                    _pad_id{-1};
+    int                                    _unk_id{-1};
+};
+} // namespace utils
+} // namespace arm_compute
+
+#endif /* __UTILS_WORDPIECE_TOKENIZER_H__ */